@@ -1,4 +1,5 @@
 // include web_audio/**/*.hh
+#include "web_audio/analyser_node.hh"
 #include "web_audio/analyzer_options.hh"
 #include "web_audio/audio_buffer.hh"
 #include "web_audio/audio_buffer_options.hh"
@@ -16,6 +17,10 @@
 #include "web_audio/audio_param.hh"
 #include "web_audio/audio_param_descriptor.hh"
 #include "web_audio/audio_processing_event_init.hh"
+#include "web_audio/audio_recorder_node.hh"
+#include "web_audio/audio_recorder_options.hh"
+#include "web_audio/audio_recording_callback.hh"
+#include "web_audio/audio_recording_options.hh"
 #include "web_audio/audio_render_capacity.hh"
 #include "web_audio/audio_render_capacity_event_init.hh"
 #include "web_audio/audio_render_capacity_options.hh"
@@ -24,7 +29,10 @@
 #include "web_audio/audio_sink_type.hh"
 #include "web_audio/audio_timestamp.hh"
 #include "web_audio/audio_worklet.hh"
+#include "web_audio/audio_worklet_message.hh"
+#include "web_audio/audio_worklet_node.hh"
 #include "web_audio/audio_worklet_node_options.hh"
+#include "web_audio/audio_worklet_processor.hh"
 #include "web_audio/automation_rate.hh"
 #include "web_audio/base_audio_context.hh"
 #include "web_audio/biquad_filter_node.hh"
@@ -32,44 +40,83 @@
 #include "web_audio/biquad_filter_type.hh"
 #include "web_audio/channel_count_mode.hh"
 #include "web_audio/channel_interpretation.hh"
+#include "web_audio/channel_merger_node.hh"
 #include "web_audio/channel_merger_options.hh"
+#include "web_audio/channel_splitter_node.hh"
 #include "web_audio/channel_splitter_options.hh"
 #include "web_audio/constant_source_node.hh"
 #include "web_audio/constant_source_options.hh"
 #include "web_audio/convolver_node.hh"
 #include "web_audio/convolver_options.hh"
+#include "web_audio/decode_error_callback.hh"
+#include "web_audio/decode_success_callback.hh"
 #include "web_audio/delay_node.hh"
 #include "web_audio/delay_options.hh"
+#include "web_audio/detail/audio_decoder.hh"
+#include "web_audio/detail/audio_file_stream.hh"
 #include "web_audio/detail/audio_graph.hh"
 #include "web_audio/detail/audio_listener_node.hh"
 #include "web_audio/detail/audio_node_input.hh"
 #include "web_audio/detail/audio_node_output.hh"
+#include "web_audio/detail/biquad_kernel.hh"
+#include "web_audio/detail/buffer_resampler.hh"
 #include "web_audio/detail/common.hh"
+#include "web_audio/detail/compressor_kernel.hh"
 #include "web_audio/detail/convolver.hh"
 #include "web_audio/detail/downsampler.hh"
+#include "web_audio/detail/equal_power_panner.hh"
 #include "web_audio/detail/event_queue.hh"
+#include "web_audio/detail/fft.hh"
+#include "web_audio/detail/hrtf_convolver.hh"
+#include "web_audio/detail/hrtf_database.hh"
+#include "web_audio/detail/hrtf_filter_loader.hh"
+#include "web_audio/detail/iir_kernel.hh"
+#include "web_audio/detail/impulse_response_cache.hh"
+#include "web_audio/detail/mapped_audio_data.hh"
 #include "web_audio/detail/math_helper.hh"
 #include "web_audio/detail/message.hh"
 #include "web_audio/detail/message_queue.hh"
+#include "web_audio/detail/mpmc_queue.hh"
+#include "web_audio/detail/oscillator_kernel.hh"
 #include "web_audio/detail/param_collection.hh"
 #include "web_audio/detail/param_event.hh"
+#include "web_audio/detail/polyphase_resampler.hh"
+#include "web_audio/detail/rational_resampler.hh"
+#include "web_audio/detail/realtime_checker.hh"
+#include "web_audio/detail/recording_stream.hh"
+#include "web_audio/detail/render_order.hh"
 #include "web_audio/detail/render_quantum.hh"
+#include "web_audio/detail/resampler.hh"
+#include "web_audio/detail/sample_buffer_pool.hh"
+#include "web_audio/detail/sample_conversion.hh"
+#include "web_audio/detail/snapshot_ring.hh"
+#include "web_audio/detail/spatial_batch.hh"
 #include "web_audio/detail/upsampler.hh"
 #include "web_audio/detail/vec3.hh"
 #include "web_audio/detail/vector_helper.hh"
+#include "web_audio/detail/vector_math.hh"
+#include "web_audio/detail/wav_decoder.hh"
+#include "web_audio/detail/wav_writer.hh"
 #include "web_audio/detail/wave_processing.hh"
+#include "web_audio/detail/wave_shaper_oversampler.hh"
+#include "web_audio/detail/wave_shaper_state.hh"
 #include "web_audio/detail/weak_ptr_helper.hh"
+#include "web_audio/detail/worker_pool.hh"
 #include "web_audio/distance_model_type.hh"
 #include "web_audio/dom_exception.hh"
+#include "web_audio/dynamics_compressor_node.hh"
 #include "web_audio/dynamics_compressor_options.hh"
 #include "web_audio/event_handler.hh"
 #include "web_audio/gain_node.hh"
 #include "web_audio/gain_options.hh"
 #include "web_audio/iir_filter_node.hh"
 #include "web_audio/iir_filter_options.hh"
+#include "web_audio/mapped_audio_buffer_options.hh"
+#include "web_audio/mapped_sample_format.hh"
 #include "web_audio/media_element_audio_source_options.hh"
 #include "web_audio/media_stream_audio_source_options.hh"
 #include "web_audio/media_stream_track_audio_source_options.hh"
+#include "web_audio/message_port.hh"
 #include "web_audio/offline_audio_completion_event_init.hh"
 #include "web_audio/offline_audio_context.hh"
 #include "web_audio/offline_audio_context_options.hh"
@@ -77,14 +124,22 @@
 #include "web_audio/oscillator_options.hh"
 #include "web_audio/oscillator_type.hh"
 #include "web_audio/over_sample_type.hh"
+#include "web_audio/panner_node.hh"
 #include "web_audio/panner_options.hh"
 #include "web_audio/panning_model_type.hh"
 #include "web_audio/periodic_wave.hh"
 #include "web_audio/periodic_wave_constraints.hh"
 #include "web_audio/periodic_wave_options.hh"
 #include "web_audio/promise.hh"
+#include "web_audio/recording_sample_format.hh"
 #include "web_audio/stereo_panner_node.hh"
 #include "web_audio/stereo_panner_options.hh"
+#include "web_audio/streaming_audio_source_node.hh"
+#include "web_audio/streaming_audio_source_options.hh"
+#include "web_audio/voice.hh"
+#include "web_audio/voice_builder.hh"
+#include "web_audio/voice_pool.hh"
+#include "web_audio/voice_pool_options.hh"
 #include "web_audio/wave_shaper_node.hh"
 #include "web_audio/wave_shaper_options.hh"
 // end
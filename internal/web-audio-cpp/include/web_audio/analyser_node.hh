@@ -0,0 +1,108 @@
+#pragma once
+
+#include <complex>
+#include <cstdint>
+#include <mutex>
+#include <optional>
+#include <span>
+#include <vector>
+
+#include "analyzer_options.hh"
+#include "audio_node.hh"
+#include "detail/fft.hh"
+#include "detail/snapshot_ring.hh"
+
+namespace web_audio {
+/**
+ * The rendering thread only down-mixes the input into a ring of recent
+ * samples. The getters snapshot the ring and run the window, FFT and
+ * smoothing on the calling thread.
+ */
+class AnalyserNode : public AudioNode {
+public:
+  static constexpr std::uint32_t kMinFFTSize = 32;
+  static constexpr std::uint32_t kMaxFFTSize = 32768;
+
+  // SPEC: constructor (BaseAudioContext context, optional AnalyserOptions
+  // options = {});
+  static std::shared_ptr<AnalyserNode>
+  create(std::shared_ptr<BaseAudioContext> context,
+         const AnalyzerOptions &options = {});
+
+  // SPEC: undefined getFloatFrequencyData (Float32Array array);
+  void getFloatFrequencyData(std::span<float> array);
+
+  // SPEC: undefined getByteFrequencyData (Uint8Array array);
+  void getByteFrequencyData(std::span<std::uint8_t> array);
+
+  // SPEC: undefined getFloatTimeDomainData (Float32Array array);
+  void getFloatTimeDomainData(std::span<float> array);
+
+  // SPEC: undefined getByteTimeDomainData (Uint8Array array);
+  void getByteTimeDomainData(std::span<std::uint8_t> array);
+
+  // SPEC: attribute unsigned long fftSize;
+  std::uint32_t getFftSize() const;
+
+  void setFftSize(std::uint32_t fftSize);
+
+  // SPEC: readonly attribute unsigned long frequencyBinCount;
+  std::uint32_t getFrequencyBinCount() const;
+
+  // SPEC: attribute double minDecibels;
+  double getMinDecibels() const;
+
+  void setMinDecibels(double minDecibels);
+
+  // SPEC: attribute double maxDecibels;
+  double getMaxDecibels() const;
+
+  void setMaxDecibels(double maxDecibels);
+
+  // SPEC: attribute double smoothingTimeConstant;
+  double getSmoothingTimeConstant() const;
+
+  void setSmoothingTimeConstant(double smoothingTimeConstant);
+
+  void process(const std::vector<detail::RenderQuantum> &inputs,
+               std::vector<detail::RenderQuantum> &outputs,
+               const detail::ParamCollection &params) override;
+
+  /**
+   * Only reads the quantum, which is passed through.
+   */
+  bool processInPlace(detail::RenderQuantum &quantum,
+                      const detail::ParamCollection &params) override;
+
+  WEB_AUDIO_PRIVATE : AnalyserNode();
+
+  /**
+   * Updates the smoothed spectrum unless it is current for the samples in
+   * the ring. Requires mutex_.
+   */
+  void computeFrequencyData();
+
+  /**
+   * Requires mutex_.
+   */
+  void resize(std::uint32_t fftSize);
+
+  detail::SnapshotRing ring_;
+  std::vector<float> mono_;
+
+  // Control thread state, guarded by mutex_. The rendering thread never
+  // takes it.
+  mutable std::mutex mutex_;
+  std::uint32_t fftSize_ = 0;
+  double minDecibels_;
+  double maxDecibels_;
+  double smoothingTimeConstant_;
+  std::optional<detail::RealFFT<float>> fft_;
+  std::vector<float> window_;
+  std::vector<float> timeDomain_;
+  std::vector<std::complex<float>> spectrum_;
+  std::vector<float> smoothed_;
+  // Ring position of the last spectrum, to compute it once per quantum.
+  std::optional<std::uint64_t> analyzedPosition_;
+};
+} // namespace web_audio
\ No newline at end of file
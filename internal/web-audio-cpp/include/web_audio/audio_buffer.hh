@@ -3,11 +3,16 @@
 #include <algorithm>
 #include <cstdint>
 #include <memory>
+#include <mutex>
+#include <span>
+#include <string>
 #include <vector>
 
 #include "audio_buffer_options.hh"
 #include "detail/common.hh"
+#include "detail/mapped_audio_data.hh"
 #include "dom_exception.hh"
+#include "mapped_audio_buffer_options.hh"
 
 namespace web_audio {
 class AudioBuffer : public std::enable_shared_from_this<AudioBuffer> {
@@ -24,12 +29,19 @@ public:
 
   std::uint32_t getNumberOfChannels() const;
 
-  std::vector<float> &getChannelData(std::uint32_t channel) &;
-
+  /**
+   * Channels are shared copy-on-write with copies of this buffer, so reading
+   * a channel never copies it. Write through getWritableChannelData().
+   */
   const std::vector<float> &getChannelData(std::uint32_t channel) const &;
 
   std::vector<float> &&getChannelData(std::uint32_t channel) &&;
 
+  /**
+   * Gives this buffer its own copy of the channel first if it is shared.
+   */
+  std::vector<float> &getWritableChannelData(std::uint32_t channel) &;
+
   void copyFromChannel(std::vector<float> &destination,
                        std::uint32_t channelNumber,
                        std::uint32_t bufferOffset = 0);
@@ -38,10 +50,56 @@ public:
                      std::uint32_t channelNumber,
                      std::uint32_t bufferOffset = 0);
 
+  /**
+   * Returns a buffer with the same content. Takes a reference to each channel
+   * instead of copying the samples; the data is duplicated only when one of
+   * the buffers is written through getWritableChannelData() or
+   * copyToChannel(). A reference obtained from getWritableChannelData() before
+   * the copy must not be written afterwards, just as the spec detaches such
+   * arrays when the content is acquired.
+   */
   std::shared_ptr<AudioBuffer> copy() const;
 
+  /**
+   * Returns true if both buffers still hold the same storage for `channel`.
+   */
+  bool sharesChannelData(const AudioBuffer &other,
+                         std::uint32_t channel) const;
+
   static std::shared_ptr<AudioBuffer> create(const AudioBufferOptions &options);
 
+  /**
+   * Creates a buffer backed by a read-only memory mapping of `path`, so that
+   * samples are paged in by the OS as they are played. getChannelData()
+   * still works, but copies the channel to the heap on first use and so must
+   * not be called while rendering; rendering reads through acquireChannel().
+   */
+  static std::shared_ptr<AudioBuffer>
+  createMapped(const std::string &path,
+               const MappedAudioBufferOptions &options);
+
+  /**
+   * Read-only view of a whole channel for the rendering thread, which never
+   * copies it to the heap or blocks. Frames [startFrame, startFrame + frames)
+   * are readable; for mapped interleaved data other frames may not be
+   * converted yet, and the view is empty if these are not converted either.
+   */
+  std::span<const float> acquireChannel(std::uint32_t channel,
+                                        std::uint32_t startFrame,
+                                        std::uint32_t frames) const;
+
+  /**
+   * Hints that the given frames are about to be played. Only mapped buffers
+   * act on it.
+   */
+  void prefetch(std::uint32_t startFrame, std::uint32_t frames) const;
+
+  /**
+   * Returns how many times acquireChannel() was empty because mapped data
+   * was not converted in time.
+   */
+  std::uint64_t getUnderrunCount() const;
+
   WEB_AUDIO_PRIVATE :
       // [[number of channels]]
       std::uint32_t numberOfChannels_;
@@ -49,7 +107,16 @@ public:
   std::uint32_t length_;
   // [[sample rate]]
   float sampleRate_;
-  // [[internal data]]
-  std::vector<std::vector<float>> channelData_;
+  // [[internal data]] Null for a channel still read from mapped_.
+  mutable std::vector<std::shared_ptr<std::vector<float>>> channelData_;
+  std::shared_ptr<detail::MappedAudioData> mapped_;
+  mutable std::mutex materializeMutex_;
+
+  std::vector<float> &getWritableChannel(std::uint32_t channel);
+
+  /**
+   * Copies a mapped channel into channelData_ if it is not there yet.
+   */
+  void materialize(std::uint32_t channel) const;
 };
 } // namespace web_audio
\ No newline at end of file
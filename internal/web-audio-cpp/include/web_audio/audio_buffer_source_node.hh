@@ -2,6 +2,7 @@
 
 #include "audio_buffer_source_options.hh"
 #include "audio_scheduled_source_node.hh"
+#include "detail/buffer_resampler.hh"
 #include "detail/common.hh"
 
 namespace web_audio {
@@ -24,6 +25,15 @@ public:
   // SPEC: readonly attribute AudioParam detune;
   std::shared_ptr<AudioParam> getDetune() const;
 
+  /**
+   * Interpolation used when the buffer is played off its own frame grid.
+   * Linear by default.
+   */
+  detail::InterpolationQuality getInterpolationQuality() const;
+
+  void setInterpolationQuality(
+      detail::InterpolationQuality interpolationQuality);
+
   // SPEC: attribute boolean loop;
   void setLoop(bool loop);
 
@@ -53,10 +63,13 @@ public:
 
   std::vector<std::shared_ptr<AudioParam>> getParams() const override;
 
+  void resetState() override;
+
   WEB_AUDIO_PRIVATE : AudioBufferSourceNode() = default;
 
   std::shared_ptr<AudioBuffer> buffer_;
-  std::shared_ptr<AudioBuffer> bufferClone_;
+  // Snapshot of the buffer content; shares storage with buffer_.
+  std::shared_ptr<const AudioBuffer> bufferClone_;
   std::shared_ptr<AudioParam> playbackRate_;
   std::shared_ptr<AudioParam> detune_;
   bool loop_ = false;
@@ -66,10 +79,16 @@ public:
   double offset_ = 0.0;
   double duration_ = std::numeric_limits<double>::infinity();
   double stop_ = std::numeric_limits<double>::infinity();
-  double bufferTime_ = 0.0;
+  // Playhead in buffer frames.
+  double bufferPosition_ = 0.0;
   bool started_ = false;
   bool enteredLoop_ = false;
   double bufferTimeElapsed_ = 0.0;
   double dt_;
+  detail::InterpolationQuality interpolationQuality_ =
+      detail::InterpolationQuality::eLinear;
+  std::vector<double> positions_;
+  // [begin, end) frame ranges of the quantum that read the buffer.
+  std::vector<std::pair<std::uint32_t, std::uint32_t>> segments_;
 };
 } // namespace web_audio
\ No newline at end of file
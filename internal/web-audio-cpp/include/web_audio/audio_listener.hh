@@ -4,14 +4,17 @@
 #include <vector>
 
 #include "detail/common.hh"
+#include "detail/spatial_batch.hh"
 
 namespace web_audio {
 class AudioParam;
 class BaseAudioContext;
 class AudioNode;
+class PannerNode;
 
 namespace detail {
 class AudioGraph;
+class AudioListenerNode;
 }
 
 class AudioListener : public std::enable_shared_from_this<AudioListener> {
@@ -43,6 +46,14 @@ public:
   std::shared_ptr<AudioParam> &getUpZ();
   const std::shared_ptr<AudioParam> &getUpZ() const;
 
+  // SPEC: undefined setPosition (float x, float y, float z);
+  void setPosition(float x, float y, float z);
+
+  // SPEC: undefined setOrientation (float x, float y, float z, float xUp,
+  // float yUp, float zUp);
+  void setOrientation(float x, float y, float z, float xUp, float yUp,
+                      float zUp);
+
   /**
    * Returns the context this AudioListener belongs to. Throws if the context
    * has expired.
@@ -62,10 +73,17 @@ public:
   std::weak_ptr<BaseAudioContext> context_;
   std::vector<std::weak_ptr<AudioNode>> inputsIndirect_;
 
+  // Written by the AudioListenerNode before any PannerNode of the quantum is
+  // processed. Holds one basis when the listener is not automated, and one
+  // per frame otherwise.
+  std::vector<detail::ListenerBasis> bases_{detail::ListenerBasis{}};
+
   friend class BaseAudioContext;
   friend class AudioContext;
   friend class OfflineAudioContext;
   friend class AudioNode;
+  friend class PannerNode;
   friend class detail::AudioGraph;
+  friend class detail::AudioListenerNode;
 };
 } // namespace web_audio
\ No newline at end of file
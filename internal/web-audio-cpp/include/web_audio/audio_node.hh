@@ -2,6 +2,7 @@
 
 #include <cstdint>
 #include <memory>
+#include <optional>
 #include <stdexcept>
 #include <unordered_map>
 #include <variant>
@@ -67,8 +68,27 @@ public:
                        std::vector<detail::RenderQuantum> &outputs,
                        const detail::ParamCollection &params) = 0;
 
+  /**
+   * Nodes with one input and one output may override this to render into
+   * their input instead of a separate output; process() is then skipped.
+   * The quantum is the output of the upstream node when this node is its
+   * only reader, so channels are copied only if shared. Returns false,
+   * leaving `quantum` untouched, if process() is needed instead.
+   */
+  virtual bool processInPlace(detail::RenderQuantum &quantum,
+                              const detail::ParamCollection &params);
+
+  /**
+   * Returns the rendering state, such as filter memory or a playhead, to
+   * that of a new node; settings and AudioParams are kept. Called on the
+   * rendering thread when a VoicePool recycles the node.
+   */
+  virtual void resetState();
+
   void disconnectInternal(std::size_t index);
 
+  void markGraphChanged();
+
   /**
    * Must be called from the create() factory method of each
    * derived class.
@@ -77,8 +97,21 @@ public:
 
   virtual std::vector<std::shared_ptr<AudioParam>> getParams() const;
 
+  /**
+   * getParams(), gathered on the first call so that the rendering thread
+   * does not build a vector every quantum. The render loop makes that call
+   * when it orders the nodes after a change of the graph. The AudioParams of
+   * a node do not change once it is created.
+   */
+  const std::vector<std::shared_ptr<AudioParam>> &getRenderParams();
+
 protected:
   std::weak_ptr<BaseAudioContext> context_;
+  // Set by initialize() for the rendering thread, which only runs while the
+  // context is alive and must not lock context_.
+  BaseAudioContext *renderingContext_ = nullptr;
+  float sampleRate_ = 0.0f;
+  std::uint32_t renderQuantumSize_ = 0;
   std::uint32_t numberOfInputs_;
   std::uint32_t numberOfOutputs_;
   std::uint32_t channelCount_;
@@ -88,10 +121,12 @@ protected:
   std::vector<detail::AudioNodeInput> inputs_;
   std::vector<detail::AudioNodeOutput> outputs_;
   std::vector<std::weak_ptr<AudioNode>> inputsIndirect_;
+  std::optional<std::vector<std::shared_ptr<AudioParam>>> renderParams_;
 
   friend class BaseAudioContext;
   friend class AudioContext;
   friend class OfflineAudioContext;
   friend class detail::AudioGraph;
+  friend class Voice;
 };
 } // namespace web_audio
\ No newline at end of file
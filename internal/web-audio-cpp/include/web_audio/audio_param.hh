@@ -5,6 +5,7 @@
 #include <iterator>
 #include <limits>
 #include <memory>
+#include <optional>
 #include <set>
 #include <stdexcept>
 #include <variant>
@@ -24,9 +25,13 @@ class GainNode;
 class ConstantSourceNode;
 class StereoPannerNode;
 class AudioBufferSourceNode;
+class PannerNode;
+class DynamicsCompressorNode;
+class Voice;
 
 namespace detail {
 class AudioGraph;
+class AudioListenerNode;
 }
 
 class AudioParam : public std::enable_shared_from_this<AudioParam> {
@@ -121,6 +126,14 @@ public:
 
   void computeIntrinsicValues(double startTime, std::vector<float> &outputs);
 
+  /**
+   * Returns the value computeIntrinsicValues() would give every one of
+   * `frames` frames from `startTime`, or nothing if the value changes
+   * within them.
+   */
+  std::optional<float> computeConstantIntrinsicValue(double startTime,
+                                                     std::size_t frames);
+
   /**
    * Returns the owner of this AudioParam (either an AudioNode or an
    * AudioListener). Throws if the owner has expired.
@@ -144,8 +157,17 @@ public:
   std::set<detail::ParamEvent, detail::ParamEventLess> events_;
   std::uint32_t eventIndex_ = 0;
   std::weak_ptr<AudioNode> owner_;
+  // Of the context of the owner, so that computing values does not lock
+  // owner_.
+  float sampleRate_ = 0.0f;
   std::vector<detail::AudioNodeInput> inputs_;
 
+  /**
+   * Drops every scheduled event and holds `value` from time zero, without
+   * reading the current time as setValue() does.
+   */
+  void reset(float value, AutomationRate automationRate);
+
   friend class DelayNode;
   friend class detail::AudioGraph;
   friend class AudioNode;
@@ -156,5 +178,10 @@ public:
   friend class ConstantSourceNode;
   friend class StereoPannerNode;
   friend class AudioBufferSourceNode;
+  friend class PannerNode;
+  friend class detail::AudioListenerNode;
+  friend class DynamicsCompressorNode;
+  friend class AudioWorkletNode;
+  friend class Voice;
 };
 } // namespace web_audio
\ No newline at end of file
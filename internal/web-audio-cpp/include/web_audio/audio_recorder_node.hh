@@ -0,0 +1,68 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "audio_node.hh"
+#include "audio_recorder_options.hh"
+#include "detail/recording_stream.hh"
+
+namespace web_audio {
+/**
+ * Records its input to a WAVE file or a callback while passing it through,
+ * in the manner of MediaStreamAudioDestinationNode. Not part of the Web
+ * Audio API. The rendering thread only copies the input into a ring of
+ * recording.bufferDuration seconds; writing happens on an I/O thread, so a
+ * slow disk or callback drops frames, which are counted, rather than
+ * stalling rendering. The channel count is fixed once recording starts.
+ */
+class AudioRecorderNode : public AudioNode {
+public:
+  static std::shared_ptr<AudioRecorderNode>
+  create(std::shared_ptr<BaseAudioContext> context,
+         const AudioRecorderOptions &options);
+
+  ~AudioRecorderNode() noexcept override;
+
+  /**
+   * Ends the recording and waits until everything recorded so far has been
+   * written; the input is still passed through. Rethrows an exception of
+   * the callback, or a std::runtime_error if the file could not be written.
+   */
+  void stop();
+
+  bool isRecording() const;
+
+  /**
+   * Number of quanta that did not fit in the ring.
+   */
+  std::uint64_t getOverflowCount() const;
+
+  std::uint64_t getDroppedFrames() const;
+
+  void setChannelCount(std::uint32_t channelCount) override;
+
+  void setChannelCountMode(ChannelCountMode channelCountMode) override;
+
+  void process(const std::vector<detail::RenderQuantum> &inputs,
+               std::vector<detail::RenderQuantum> &outputs,
+               const detail::ParamCollection &params) override;
+
+  /**
+   * Only reads the quantum, which is passed through.
+   */
+  bool processInPlace(detail::RenderQuantum &quantum,
+                      const detail::ParamCollection &params) override;
+
+  WEB_AUDIO_PRIVATE : AudioRecorderNode() = default;
+
+  std::unique_ptr<detail::RecordingStream> stream_;
+  std::atomic<bool> recording_{true};
+  // Set by the rendering thread while it writes to stream_, so that stop()
+  // can wait for the write to finish.
+  std::atomic<bool> writing_{false};
+  std::vector<const float *> sources_;
+};
+} // namespace web_audio
\ No newline at end of file
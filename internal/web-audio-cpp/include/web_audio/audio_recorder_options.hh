@@ -0,0 +1,10 @@
+#pragma once
+
+#include "audio_node_options.hh"
+#include "audio_recording_options.hh"
+
+namespace web_audio {
+struct AudioRecorderOptions : public AudioNodeOptions {
+  AudioRecordingOptions recording;
+};
+} // namespace web_audio
\ No newline at end of file
@@ -0,0 +1,13 @@
+#pragma once
+
+#include <functional>
+#include <span>
+
+namespace web_audio {
+/**
+ * Receives recorded frames on the I/O thread of the recording, one span per
+ * channel. The spans are only valid during the call.
+ */
+using AudioRecordingCallback =
+    std::function<void(std::span<const std::span<const float>> channels)>;
+} // namespace web_audio
\ No newline at end of file
@@ -0,0 +1,20 @@
+#pragma once
+
+#include <string>
+
+#include "audio_recording_callback.hh"
+#include "recording_sample_format.hh"
+
+namespace web_audio {
+/**
+ * Where rendered frames go: to `callback` if it is set, otherwise to a WAVE
+ * file at `path`.
+ */
+struct AudioRecordingOptions {
+  std::string path;
+  RecordingSampleFormat sampleFormat = RecordingSampleFormat::eFloat32;
+  AudioRecordingCallback callback;
+  // Seconds of audio buffered between the rendering and I/O threads.
+  double bufferDuration = 1;
+};
+} // namespace web_audio
\ No newline at end of file
@@ -23,10 +23,15 @@ public:
 
   /**
    * Returns true if the current time is between the scheduled start time
-   * and stop time.
+   * and stop time. Called on the rendering thread.
    */
   bool isPlaying() const;
 
+  /**
+   * Also allows start() to be called again.
+   */
+  void resetState() override;
+
   WEB_AUDIO_PRIVATE : EventHandler *onended = nullptr;
   // [[source started]]
   bool sourceStarted_ = false;
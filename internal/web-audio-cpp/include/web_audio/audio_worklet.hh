@@ -1,7 +1,51 @@
 #pragma once
 
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "audio_param_descriptor.hh"
+#include "audio_worklet_node_options.hh"
+#include "audio_worklet_processor.hh"
+#include "detail/common.hh"
+
 namespace web_audio {
+using AudioWorkletProcessorFactory =
+    std::function<std::unique_ptr<AudioWorkletProcessor>(
+        const AudioWorkletNodeOptions &options)>;
+
+/**
+ * Processors are native classes rather than scripts, so there is no
+ * addModule(); they are registered here directly, as registerProcessor()
+ * of the AudioWorkletGlobalScope would.
+ */
 class AudioWorklet {
-  // TODO
+public:
+  // SPEC: undefined registerProcessor (DOMString name,
+  // AudioWorkletProcessorConstructor processorCtor);
+  /**
+   * `factory` is called on the control thread for each AudioWorkletNode
+   * named `name`, with the options of the node.
+   */
+  void registerProcessor(
+      const std::string &name, AudioWorkletProcessorFactory factory,
+      std::vector<AudioParamDescriptor> parameterDescriptors = {});
+
+  WEB_AUDIO_PRIVATE : struct Definition {
+    AudioWorkletProcessorFactory factory;
+    std::vector<AudioParamDescriptor> parameterDescriptors;
+  };
+
+  std::optional<Definition> getDefinition(const std::string &name) const;
+
+  // SPEC: node name to processor constructor map
+  std::unordered_map<std::string, Definition> definitions_;
+  mutable std::mutex mutex_;
+
+  friend class AudioWorkletNode;
 };
 } // namespace web_audio
\ No newline at end of file
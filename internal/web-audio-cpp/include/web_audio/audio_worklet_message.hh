@@ -0,0 +1,18 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+namespace web_audio {
+/**
+ * Fixed-size message exchanged through a MessagePort. There is no
+ * structured clone, so messages are plain values that can be copied without
+ * allocating; larger data is passed by `data`, whose lifetime is up to the
+ * sender and receiver.
+ */
+struct AudioWorkletMessage {
+  std::uint32_t type = 0;
+  std::array<double, 4> values{};
+  void *data = nullptr;
+};
+} // namespace web_audio
\ No newline at end of file
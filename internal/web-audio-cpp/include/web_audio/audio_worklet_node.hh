@@ -0,0 +1,95 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "audio_node.hh"
+#include "audio_worklet_node_options.hh"
+#include "audio_worklet_processor.hh"
+#include "message_port.hh"
+
+namespace web_audio {
+/**
+ * Runs a native AudioWorkletProcessor in the graph. The views passed to the
+ * processor are rebuilt every quantum in storage allocated when the node is
+ * created.
+ */
+class AudioWorkletNode : public AudioNode {
+public:
+  static constexpr std::uint32_t kMaxChannelCount = 32;
+
+  // SPEC: constructor (BaseAudioContext context, DOMString name,
+  // optional AudioWorkletNodeOptions options = {});
+  static std::shared_ptr<AudioWorkletNode>
+  create(std::shared_ptr<BaseAudioContext> context, const std::string &name,
+         const AudioWorkletNodeOptions &options = {});
+
+  // SPEC: readonly attribute AudioParamMap parameters;
+  const std::unordered_map<std::string, std::shared_ptr<AudioParam>> &
+  getParameters() const;
+
+  // SPEC: readonly attribute MessagePort port;
+  MessagePort &getPort();
+
+  std::vector<std::shared_ptr<AudioParam>> getParams() const override;
+
+  void process(const std::vector<detail::RenderQuantum> &inputs,
+               std::vector<detail::RenderQuantum> &outputs,
+               const detail::ParamCollection &params) override;
+
+  bool processInPlace(detail::RenderQuantum &quantum,
+                      const detail::ParamCollection &params) override;
+
+  WEB_AUDIO_PRIVATE : AudioWorkletNode() = default;
+
+  /**
+   * Records which inputs have connections. Returns true if any has.
+   */
+  bool updateConnections();
+
+  /**
+   * Whether process() of the processor is due this quantum. Counts the
+   * frames rendered without connected inputs.
+   */
+  bool isActive(bool connected);
+
+  void reserveChannels(std::uint32_t channels);
+
+  /**
+   * Points the parameter views at the values of this quantum.
+   */
+  void setParameterViews(const detail::ParamCollection &params);
+
+  /**
+   * Calls the processor with the views built so far and records its result.
+   */
+  void callProcessor();
+
+  std::unique_ptr<AudioWorkletProcessor> processor_;
+  std::shared_ptr<MessagePort> port_;
+  std::vector<std::shared_ptr<AudioParam>> params_;
+  std::unordered_map<std::string, std::shared_ptr<AudioParam>> parameters_;
+  // Empty if the output channel count follows the input.
+  std::vector<std::uint32_t> outputChannelCount_;
+  bool inPlace_ = false;
+  std::uint64_t tailFrames_ = 0;
+
+  // Rendering thread state.
+  bool keepAlive_ = true;
+  bool failed_ = false;
+  std::uint64_t framesWithoutInputs_ = 0;
+  std::vector<bool> inputConnected_;
+  std::vector<detail::RenderQuantum> outputQuanta_;
+  // kMaxChannelCount channels per input or output, grown if needed.
+  std::size_t channelStride_ = kMaxChannelCount;
+  std::vector<std::span<const float>> inputChannels_;
+  std::vector<std::span<float>> outputChannels_;
+  std::vector<std::span<const std::span<const float>>> inputViews_;
+  std::vector<std::span<const std::span<float>>> outputViews_;
+  std::vector<std::span<const float>> parameterViews_;
+};
+} // namespace web_audio
\ No newline at end of file
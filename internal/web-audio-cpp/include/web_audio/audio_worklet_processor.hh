@@ -0,0 +1,74 @@
+#pragma once
+
+#include <memory>
+#include <span>
+
+#include "detail/common.hh"
+#include "message_port.hh"
+
+namespace web_audio {
+/**
+ * Channels of each input, each channel spanning one render quantum. An
+ * input without connections has no channels.
+ */
+using AudioWorkletInputs =
+    std::span<const std::span<const std::span<const float>>>;
+
+/**
+ * Channels of each output, silent when process() is called.
+ */
+using AudioWorkletOutputs = std::span<const std::span<const std::span<float>>>;
+
+/**
+ * Values of each parameter, in the order of the descriptors it was
+ * registered with. A parameter that is constant over the quantum has a
+ * single value.
+ */
+using AudioWorkletParameters = std::span<const std::span<const float>>;
+
+/**
+ * Native counterpart of the AudioWorkletProcessor of the spec. Created by the
+ * factory registered with AudioWorklet::registerProcessor() when an
+ * AudioWorkletNode is constructed, and afterwards only used on the
+ * rendering thread.
+ */
+class AudioWorkletProcessor {
+public:
+  virtual ~AudioWorkletProcessor() noexcept = default;
+
+  // SPEC: readonly attribute MessagePort port;
+  /**
+   * Entangled with the port of the node. Not available in the constructor.
+   */
+  MessagePort &getPort();
+
+  /**
+   * Renders one quantum. Called on the rendering thread, which must not
+   * block, so implementations should not allocate or lock. The views are
+   * built in storage preallocated by the node. Returning false lets the node
+   * stop calling process() once it has no connected inputs and its tail
+   * time has passed. An exception makes the node output silence from then
+   * on.
+   */
+  virtual bool process(AudioWorkletInputs inputs, AudioWorkletOutputs outputs,
+                       AudioWorkletParameters parameters) = 0;
+
+  /**
+   * Whether process() accepts an output channel that refers to the same
+   * samples as the input channel of the same index. Only used by nodes with
+   * one input and one output whose channel count follows the input, which
+   * then render without a separate output buffer.
+   */
+  virtual bool canProcessInPlace() const;
+
+  /**
+   * Seconds for which process() is still called after the inputs are
+   * disconnected even though it returned false, e.g. to play out a reverb.
+   */
+  virtual double getTailTime() const;
+
+  WEB_AUDIO_PRIVATE : std::shared_ptr<MessagePort> port_;
+
+  friend class AudioWorkletNode;
+};
+} // namespace web_audio
\ No newline at end of file
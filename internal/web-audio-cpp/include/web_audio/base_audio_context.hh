@@ -3,22 +3,34 @@
 #include <atomic>
 #include <cstdint>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <queue>
+#include <string>
 #include <thread>
+#include <vector>
 
 #include "audio_context_state.hh"
 #include "audio_destination_node.hh"
 #include "audio_listener.hh"
 #include "audio_worklet.hh"
+#include "decode_error_callback.hh"
+#include "decode_success_callback.hh"
 #include "detail/audio_graph.hh"
 #include "detail/event_queue.hh"
+#include "detail/hrtf_database.hh"
+#include "detail/impulse_response_cache.hh"
 #include "detail/message.hh"
 #include "detail/message_queue.hh"
+#include "detail/mpmc_queue.hh"
+#include "detail/render_order.hh"
+#include "detail/sample_buffer_pool.hh"
+#include "detail/worker_pool.hh"
 #include "event_handler.hh"
 #include "promise.hh"
 
 namespace web_audio {
+class AudioBuffer;
 class AudioNode;
 
 class BaseAudioContext : public std::enable_shared_from_this<
@@ -42,20 +54,96 @@ public:
 
   // TODO: factories
 
+  // SPEC: Promise<AudioBuffer> decodeAudioData (ArrayBuffer audioData,
+  // optional DecodeSuccessCallback? successCallback,
+  // optional DecodeErrorCallback? errorCallback);
+  /**
+   * Decodes RIFF/WAVE data on a decoding thread and resamples it to the
+   * sample rate of this context. The data is moved in, as the spec detaches
+   * the ArrayBuffer.
+   */
+  Promise<std::shared_ptr<AudioBuffer>>
+  decodeAudioData(std::vector<std::uint8_t> audioData,
+                  DecodeSuccessCallback successCallback = nullptr,
+                  DecodeErrorCallback errorCallback = nullptr);
+
   /**
    * C.f. wgpuInstanceProcessEvents
    */
   void processEvents();
 
+  /**
+   * Background threads shared by nodes that offload work from the rendering
+   * thread. Created on first use.
+   */
+  std::shared_ptr<detail::WorkerPool> getWorkerPool();
+
+  /**
+   * Background threads for decodeAudioData(), kept apart from
+   * getWorkerPool() so that decoding never delays jobs the rendering thread
+   * waits for. Created on first use.
+   */
+  std::shared_ptr<detail::WorkerPool> getDecodingWorkerPool();
+
+  /**
+   * Convolver kernels shared by the ConvolverNodes of this context.
+   */
+  detail::ImpulseResponseCache &getImpulseResponseCache();
+
+  /**
+   * Loads the head-related impulse responses used by PannerNodes whose
+   * panningModel is "HRTF"; see detail::HrtfDatabase for the file format.
+   * Until a dataset is loaded, such panners use equal-power panning.
+   */
+  void loadHrtfDatabase(const std::string &path);
+
+  std::shared_ptr<detail::HrtfDatabase> getHrtfDatabase() const;
+
+  /**
+   * Incremented by every loadHrtfDatabase(), so that the rendering thread can
+   * notice a new dataset without loading the shared pointer.
+   */
+  std::uint32_t getHrtfDatabaseGeneration() const;
+
+  /**
+   * Queues a message for the rendering thread, which handles it with the
+   * graph as it is now.
+   */
   template <typename MessageType> void queueMessage(MessageType &&message) {
+    updateRenderOrder();
     controlMessageQueue_.push(std::forward<MessageType>(message));
   }
 
+  /**
+   * Hands the rendering thread a new order of the nodes if the graph changed
+   * since the last one, and releases what the rendering thread retired.
+   * Called on the control thread after each change of the connections, and
+   * before each message. Nodes that have only been created join the order
+   * with the next of these.
+   */
+  void updateRenderOrder();
+
   WEB_AUDIO_PROTECTED : void initialize(std::uint32_t numberOfChannels);
 
   detail::AudioGraph *getAudioGraph();
 
-  std::optional<detail::RenderQuantum> render();
+  /**
+   * Renders a quantum. The result stays valid until the next call.
+   */
+  const detail::RenderQuantum *render();
+
+  /**
+   * Hands an object the rendering thread is done with to the control
+   * thread, which releases it in updateRenderOrder(), so that the rendering
+   * thread never frees memory.
+   */
+  void retire(std::shared_ptr<const void> object);
+
+  /**
+   * Releases the objects retired by the rendering thread. Called on the
+   * control thread.
+   */
+  void releaseRetired();
 
   void run();
 
@@ -82,8 +170,33 @@ public:
   detail::EventQueue eventQueue_;
   detail::MessageQueue controlMessageQueue_;
   detail::AudioGraph audioGraph_;
+  // Installed on the rendering thread while a quantum is rendered.
+  detail::SampleBufferPool sampleBufferPool_;
+  // The order the rendering thread renders the nodes in.
+  std::shared_ptr<detail::RenderOrder> renderOrder_;
+  // Graph version of the last order handed to the rendering thread. Only
+  // used on the control thread.
+  std::uint64_t renderOrderVersion_ = 0;
+  detail::MpmcQueue<std::shared_ptr<const void>> retired_{256};
   std::unique_ptr<std::thread> renderingThread_;
+  std::shared_ptr<detail::WorkerPool> workerPool_;
+  std::once_flag workerPoolOnce_;
+  std::shared_ptr<detail::WorkerPool> decodingWorkerPool_;
+  std::once_flag decodingWorkerPoolOnce_;
+  detail::ImpulseResponseCache impulseResponseCache_;
+  std::atomic<std::shared_ptr<detail::HrtfDatabase>> hrtfDatabase_;
+  std::atomic<std::uint32_t> hrtfDatabaseGeneration_{0};
+
+  struct DecodingThread {
+    std::thread thread;
+    std::shared_ptr<std::atomic<bool>> finished;
+  };
+
+  // Joined when they are done or when the context is destroyed.
+  std::vector<DecodingThread> decodingThreads_;
+  std::mutex decodingThreadsMutex_;
 
   friend class AudioNode;
+  friend class VoicePool;
 };
 } // namespace web_audio
\ No newline at end of file
@@ -4,6 +4,7 @@
 
 #include "audio_node.hh"
 #include "biquad_filter_options.hh"
+#include "detail/biquad_kernel.hh"
 #include <complex>
 
 namespace web_audio {
@@ -42,10 +43,23 @@ public:
                std::vector<detail::RenderQuantum> &outputs,
                const detail::ParamCollection &params) override;
 
+  bool processInPlace(detail::RenderQuantum &quantum,
+                      const detail::ParamCollection &params) override;
+
+  void resetState() override;
+
   WEB_AUDIO_PRIVATE : BiquadFilterNode() = default;
 
   std::vector<std::shared_ptr<AudioParam>> getParams() const override;
 
+  /**
+   * Computes the coefficients for the param values at `frame`, and stores the
+   * unnormalized ones in a_ and b_.
+   */
+  detail::BiquadCoefficients
+  computeCoefficientsAt(const detail::ParamCollection &params,
+                        std::uint32_t frame, float sampleRate);
+
   void transferTime(const std::tuple<float, float, float> &a,
                     const std::tuple<float, float, float> &b,
                     const std::tuple<float, float, float> &x,
@@ -107,10 +121,12 @@ public:
   std::shared_ptr<AudioParam> Q_;
   std::shared_ptr<AudioParam> gain_;
   BiquadFilterType type_ = BiquadFilterType::eLowpass;
-  // y[n], y[n-1], y[n-2]
-  std::vector<std::tuple<float, float, float>> y_;
-  // x[n], x[n-1], x[n-2]
-  std::vector<std::tuple<float, float, float>> x_;
+  // Frames between exactly computed coefficients under automation.
+  static constexpr std::uint32_t kSubBlockSize = 16;
+  detail::BiquadKernel kernel_;
+  std::vector<detail::BiquadCoefficients> coefficients_;
+  std::vector<const float *> inputChannels_;
+  std::vector<float *> outputChannels_;
   // a0, a1, a2
   std::tuple<float, float, float> a_;
   // b0, b1, b2
@@ -0,0 +1,29 @@
+#pragma once
+
+#include "audio_node.hh"
+#include "channel_merger_options.hh"
+
+namespace web_audio {
+/**
+ * The channels of the output refer to the down-mixed inputs; no samples
+ * are copied.
+ */
+class ChannelMergerNode : public AudioNode {
+public:
+  static constexpr std::uint32_t kMaxNumberOfInputs = 32;
+
+  // SPEC: constructor (BaseAudioContext context, optional
+  // ChannelMergerOptions options = {});
+  static std::shared_ptr<ChannelMergerNode>
+  create(std::shared_ptr<BaseAudioContext> context,
+         const ChannelMergerOptions &options = {});
+
+  void setChannelCount(std::uint32_t channelCount) override;
+
+  void setChannelCountMode(ChannelCountMode channelCountMode) override;
+
+  void process(const std::vector<detail::RenderQuantum> &inputs,
+               std::vector<detail::RenderQuantum> &outputs,
+               const detail::ParamCollection &params) override;
+};
+} // namespace web_audio
\ No newline at end of file
@@ -0,0 +1,31 @@
+#pragma once
+
+#include "audio_node.hh"
+#include "channel_splitter_options.hh"
+
+namespace web_audio {
+/**
+ * Each output refers to a channel of the input; no samples are copied.
+ */
+class ChannelSplitterNode : public AudioNode {
+public:
+  static constexpr std::uint32_t kMaxNumberOfOutputs = 32;
+
+  // SPEC: constructor (BaseAudioContext context, optional
+  // ChannelSplitterOptions options = {});
+  static std::shared_ptr<ChannelSplitterNode>
+  create(std::shared_ptr<BaseAudioContext> context,
+         const ChannelSplitterOptions &options = {});
+
+  void setChannelCount(std::uint32_t channelCount) override;
+
+  void setChannelCountMode(ChannelCountMode channelCountMode) override;
+
+  void setChannelInterpretation(
+      ChannelInterpretation channelInterpretation) override;
+
+  void process(const std::vector<detail::RenderQuantum> &inputs,
+               std::vector<detail::RenderQuantum> &outputs,
+               const detail::ParamCollection &params) override;
+};
+} // namespace web_audio
\ No newline at end of file
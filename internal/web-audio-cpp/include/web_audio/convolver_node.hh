@@ -33,12 +33,15 @@ public:
                const detail::ParamCollection &params) override;
 
   static double
-  calculateNormalizationScale(std::shared_ptr<AudioBuffer> buffer);
+  calculateNormalizationScale(std::shared_ptr<const AudioBuffer> buffer);
 
   WEB_AUDIO_PRIVATE : std::shared_ptr<AudioBuffer> buffer_;
   bool normalize_;
   std::shared_ptr<AudioBuffer> bufferCopy_;
   std::vector<std::vector<std::complex<float>>> bufferFrequency_;
   std::vector<std::unique_ptr<detail::Convolver<float>>> convolvers_;
+  // Output of the cross convolvers of a four-channel response, sized on the
+  // first quantum.
+  std::vector<float> scratch_;
 };
 } // namespace web_audio
\ No newline at end of file
@@ -0,0 +1,10 @@
+#pragma once
+
+#include <functional>
+
+#include "dom_exception.hh"
+
+namespace web_audio {
+// SPEC: callback DecodeErrorCallback = undefined (DOMException error);
+using DecodeErrorCallback = std::function<void(const DOMException &)>;
+} // namespace web_audio
\ No newline at end of file
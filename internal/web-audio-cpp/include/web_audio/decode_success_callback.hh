@@ -0,0 +1,11 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+
+namespace web_audio {
+class AudioBuffer;
+
+// SPEC: callback DecodeSuccessCallback = undefined (AudioBuffer decodedData);
+using DecodeSuccessCallback = std::function<void(std::shared_ptr<AudioBuffer>)>;
+} // namespace web_audio
\ No newline at end of file
@@ -26,6 +26,8 @@ public:
 
   std::vector<std::shared_ptr<AudioParam>> getParams() const override;
 
+  void resetState() override;
+
 public:
   class DelayNodeReader : public AudioNode {
     WEB_AUDIO_PRIVATE : DelayNodeReader() = default;
@@ -38,7 +40,8 @@ public:
     static std::shared_ptr<DelayNodeReader>
     create(std::shared_ptr<DelayNode> delayNode);
 
-    WEB_AUDIO_PRIVATE : std::weak_ptr<DelayNode> delayNode_;
+    // The DelayNode owns this node.
+    WEB_AUDIO_PRIVATE : DelayNode *delayNode_;
   };
 
   class DelayNodeWriter : public AudioNode {
@@ -52,7 +55,8 @@ public:
     static std::shared_ptr<DelayNodeWriter>
     create(std::shared_ptr<DelayNode> delayNode);
 
-    WEB_AUDIO_PRIVATE : std::weak_ptr<DelayNode> delayNode_;
+    // The DelayNode owns this node.
+    WEB_AUDIO_PRIVATE : DelayNode *delayNode_;
   };
 
   WEB_AUDIO_PRIVATE : std::shared_ptr<AudioParam> delayTime_;
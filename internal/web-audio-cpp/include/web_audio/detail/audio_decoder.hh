@@ -0,0 +1,42 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <span>
+
+#include "common.hh"
+#include "worker_pool.hh"
+
+namespace web_audio {
+class AudioBuffer;
+}
+
+namespace web_audio::detail {
+/**
+ * Decodes encoded audio into an AudioBuffer at a given sample rate, as done
+ * by decodeAudioData(). Conversion is split into chunks of frames and
+ * resampling into chunks of each channel, which run in parallel on a
+ * WorkerPool.
+ */
+class AudioDecoder final {
+public:
+  static constexpr std::uint32_t kChunkFrames = 65536;
+
+  /**
+   * Blocks until decoding is done. Must not be called from a thread of
+   * `pool`. Throws std::invalid_argument if `data` cannot be decoded.
+   */
+  static std::shared_ptr<AudioBuffer> decode(std::span<const std::uint8_t> data,
+                                             float sampleRate,
+                                             WorkerPool &pool);
+
+  /**
+   * Runs `body(0)` through `body(count - 1)` on `pool` and waits for them.
+   * Jobs the pool cannot queue run on the calling thread.
+   */
+  static void parallelFor(WorkerPool &pool, std::size_t count,
+                          const std::function<void(std::size_t)> &body);
+};
+} // namespace web_audio::detail
\ No newline at end of file
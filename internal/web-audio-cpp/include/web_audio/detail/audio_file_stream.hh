@@ -0,0 +1,122 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "common.hh"
+#include "mpmc_queue.hh"
+#include "wav_decoder.hh"
+
+namespace web_audio::detail {
+/**
+ * Reads a WAVE file ahead of playback on a background I/O thread. Frames are
+ * converted to float into a fixed ring of blocks, handed to the rendering
+ * thread through lock-free queues, so memory stays bounded by the ring size
+ * whatever the length of the file.
+ */
+class AudioFileStream final {
+public:
+  static constexpr std::uint32_t kBlockFrames = 2048;
+
+  /**
+   * Starts reading at frame 0. Throws std::runtime_error if the file cannot
+   * be opened and std::invalid_argument if it is not a supported WAVE file.
+   */
+  AudioFileStream(const std::string &path, std::uint32_t numberOfBlocks);
+
+  ~AudioFileStream();
+
+  AudioFileStream(const AudioFileStream &) = delete;
+  AudioFileStream &operator=(const AudioFileStream &) = delete;
+
+  const WavFormat &getFormat() const;
+
+  /**
+   * Loops frames [loopStart, loopEnd) once the read position reaches
+   * loopEnd. Applies to frames not read ahead yet.
+   */
+  void setLoop(bool loop, std::uint32_t loopStart, std::uint32_t loopEnd);
+
+  /**
+   * Restarts reading at `frame`. Blocks read ahead from the old position are
+   * dropped by the next read().
+   */
+  void seek(std::uint32_t frame);
+
+  /**
+   * Blocks until the ring is full or the end of the file has been read, so
+   * that playback can start without an underrun.
+   */
+  void prime();
+
+  /**
+   * Copies up to `frames` frames of each channel to `destinations` and
+   * returns how many were available. Never blocks or allocates. Coming up
+   * short before the end of the stream counts as an underrun.
+   */
+  std::uint32_t read(float *const *destinations, std::uint32_t frames);
+
+  /**
+   * True once read() has returned the last frame of a non-looping stream.
+   */
+  bool isFinished() const;
+
+  std::uint64_t getUnderrunCount() const;
+
+  WEB_AUDIO_PRIVATE : struct Block {
+    std::vector<float> samples;
+    std::uint32_t frames = 0;
+    std::uint32_t generation = 0;
+    bool endOfStream = false;
+  };
+
+  void ioLoop();
+
+  /**
+   * Reads the next block from the I/O position. Returns false at the end of
+   * a non-looping stream.
+   */
+  bool fill(Block &block, std::uint32_t generation);
+
+  void release(std::uint32_t block);
+
+  void wake();
+
+  WavFormat format_;
+  std::ifstream file_;
+  std::vector<Block> blocks_;
+  MpmcQueue<std::uint32_t> freeBlocks_;
+  MpmcQueue<std::uint32_t> readyBlocks_;
+
+  std::atomic<bool> loop_{false};
+  std::atomic<std::uint32_t> loopStart_{0};
+  std::atomic<std::uint32_t> loopEnd_{0};
+  std::atomic<std::uint32_t> seekFrame_{0};
+  // Incremented by seek(); blocks of older generations are stale.
+  std::atomic<std::uint32_t> generation_{0};
+  // Generation for which the I/O thread has nothing left to do.
+  std::atomic<std::uint32_t> idleGeneration_{UINT32_MAX};
+  std::atomic<std::uint32_t> signal_{0};
+  std::atomic<bool> stopping_{false};
+  std::atomic<std::uint64_t> underrunCount_{0};
+
+  // I/O thread state.
+  std::uint32_t position_ = 0;
+  bool ended_ = false;
+  std::vector<std::uint8_t> bytes_;
+  std::vector<float> scratch_;
+  std::vector<float *> destinations_;
+
+  // Rendering thread state.
+  std::int64_t currentBlock_ = -1;
+  std::uint32_t blockOffset_ = 0;
+  std::uint32_t readGeneration_ = 0;
+  bool finished_ = false;
+
+  std::thread thread_;
+};
+} // namespace web_audio::detail
\ No newline at end of file
@@ -1,7 +1,10 @@
 #pragma once
 
+#include <atomic>
+#include <cstdint>
 #include <functional>
 #include <memory>
+#include <unordered_map>
 #include <unordered_set>
 #include <vector>
 
@@ -10,6 +13,7 @@
 #include "../audio_node.hh"
 #include "audio_listener_node.hh"
 #include "common.hh"
+#include "render_order.hh"
 
 namespace web_audio::detail {
 class AudioGraph {
@@ -20,6 +24,10 @@ public:
   void initialize(std::shared_ptr<BaseAudioContext> context,
                   std::uint32_t numberOfChannels);
 
+  /**
+   * Adding, removing and looking up a node take constant time, so that
+   * voices can enter and leave the graph cheaply.
+   */
   void addNode(std::shared_ptr<AudioNode> node);
 
   void removeNode(std::shared_ptr<AudioNode> node);
@@ -28,6 +36,17 @@ public:
 
   void clear();
 
+  /**
+   * Records a change of the nodes or of their connections, so that the
+   * rendering thread orders the nodes again.
+   */
+  void markChanged();
+
+  /**
+   * Incremented by every change, starting from 1.
+   */
+  std::uint64_t getVersion() const;
+
   /**
    * Returns the destination nodes connected to this node.
    */
@@ -55,6 +74,13 @@ public:
 
   std::vector<std::shared_ptr<AudioNode>> orderNodes() const;
 
+  /**
+   * Orders the nodes for the rendering thread. Connections from nodes that
+   * are not ordered before their destination, such as the nodes of a cycle,
+   * are left out, as are those from nodes outside the graph.
+   */
+  std::shared_ptr<RenderOrder> createRenderOrder() const;
+
   std::vector<std::shared_ptr<AudioNode>>
   getNextNodes(std::shared_ptr<AudioNode> node) const;
   std::vector<std::shared_ptr<AudioNode>>
@@ -63,7 +89,10 @@ public:
   getPreviousNodes(std::shared_ptr<AudioParam> param) const;
 
   WEB_AUDIO_PRIVATE : std::vector<std::shared_ptr<AudioNode>> nodes_;
+  // Position of each node in nodes_.
+  std::unordered_map<AudioNode *, std::size_t> indices_;
   std::shared_ptr<detail::AudioListenerNode> listenerNode_;
   std::shared_ptr<AudioDestinationNode> destinationNode_;
+  std::atomic<std::uint64_t> version_{1};
 };
 } // namespace web_audio::detail
\ No newline at end of file
@@ -13,6 +13,12 @@ public:
   static std::shared_ptr<AudioListenerNode>
   create(std::shared_ptr<BaseAudioContext> context);
 
+  std::vector<std::shared_ptr<AudioParam>> getParams() const override;
+
+  /**
+   * Derives the listener axes for the quantum, so that PannerNodes read them
+   * instead of recomputing them per source.
+   */
   void process(const std::vector<detail::RenderQuantum> &inputs,
                std::vector<detail::RenderQuantum> &outputs,
                const detail::ParamCollection &params) override;
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "common.hh"
+
+namespace web_audio::detail {
+/**
+ * Biquad coefficients normalized by a0.
+ */
+struct BiquadCoefficients {
+  float b0 = 1.0f;
+  float b1 = 0.0f;
+  float b2 = 0.0f;
+  float a1 = 0.0f;
+  float a2 = 0.0f;
+
+  static BiquadCoefficients interpolate(const BiquadCoefficients &from,
+                                        const BiquadCoefficients &to,
+                                        float t);
+};
+
+/**
+ * Transposed direct form II biquad running all channels at once, four
+ * channels per vector register.
+ */
+class BiquadKernel {
+public:
+  /**
+   * Resizes the per-channel state. Existing channels keep their state; new
+   * channels start silent.
+   */
+  void setNumberOfChannels(std::size_t numberOfChannels);
+
+  std::size_t getNumberOfChannels() const;
+
+  /**
+   * Allocates the state of `numberOfChannels` channels, so that
+   * setNumberOfChannels() up to that many does not allocate.
+   */
+  void reserve(std::size_t numberOfChannels);
+
+  void reset();
+
+  /**
+   * Filters `frames` frames of each channel with fixed coefficients.
+   * `output` may alias `input`.
+   */
+  void process(const BiquadCoefficients &coefficients,
+               const float *const *input, float *const *output,
+               std::size_t frames);
+
+  /**
+   * Filters with one coefficient set per frame.
+   */
+  void process(const BiquadCoefficients *coefficients,
+               const float *const *input, float *const *output,
+               std::size_t frames);
+
+  WEB_AUDIO_PRIVATE : template <typename CoefficientsAt>
+  void processLanes(CoefficientsAt coefficientsAt, const float *const *input,
+                    float *const *output, std::size_t frames);
+
+  std::size_t numberOfChannels_ = 0;
+  // Filter state, padded to a multiple of four channels.
+  std::vector<float> s1_;
+  std::vector<float> s2_;
+};
+} // namespace web_audio::detail
\ No newline at end of file
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "common.hh"
+
+namespace web_audio::detail {
+enum class InterpolationQuality {
+  eLinear,
+  eCubic,
+  eSinc,
+};
+
+/**
+ * Reads a sample buffer at fractional positions, as used for variable-rate
+ * playback. Every mode is interpolating: a position on a sample returns that
+ * sample exactly.
+ */
+class BufferResampler final {
+public:
+  static constexpr std::size_t kSincHalfWidth = 8;
+  static constexpr std::size_t kSincPhases = 512;
+
+  /**
+   * A region that taps past either end of the buffer wrap into, so that
+   * interpolation is continuous across a loop point. An empty region means
+   * taps outside the buffer read as silence.
+   */
+  struct LoopRegion {
+    std::size_t start = 0;
+    std::size_t end = 0;
+  };
+
+  /**
+   * Interpolation reads samples floor(p) - getHalfWidth() + 1 through
+   * floor(p) + getHalfWidth().
+   */
+  static std::size_t getHalfWidth(InterpolationQuality quality);
+
+  /**
+   * Windowed-sinc kernel table, kSincPhases + 1 rows of 2 * kSincHalfWidth
+   * taps. Built on first use; call it before rendering to keep the build off
+   * the rendering thread.
+   */
+  static const std::vector<float> &getSincTable();
+
+  /**
+   * Interpolates `data` at each of `frames` positions, which must lie in
+   * [0, length).
+   */
+  static void process(InterpolationQuality quality, const float *data,
+                      std::size_t length, LoopRegion loop,
+                      const double *positions, float *output,
+                      std::size_t frames);
+
+  WEB_AUDIO_PRIVATE : template <typename Interpolate>
+  static void processWith(Interpolate interpolate, std::size_t halfWidth,
+                          const float *data, std::size_t length,
+                          LoopRegion loop, const double *positions,
+                          float *output, std::size_t frames);
+};
+} // namespace web_audio::detail
\ No newline at end of file
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "common.hh"
+
+namespace web_audio::detail {
+/**
+ * Settings of the compression curve and the envelope, as given by the
+ * DynamicsCompressorNode parameters.
+ */
+struct CompressorParameters {
+  float threshold = -24.0f;
+  float knee = 30.0f;
+  float ratio = 12.0f;
+  float attack = 0.003f;
+  float release = 0.25f;
+};
+
+/**
+ * Feed-forward peak compressor with lookahead for up to kMaxChannels
+ * channels. The detector and the gain computer run once per sub-block of
+ * kSubBlockSize frames on the undelayed input, and the gain is ramped
+ * linearly across each sub-block of the delayed signal.
+ */
+class CompressorKernel final {
+public:
+  static constexpr std::size_t kMaxChannels = 2;
+  static constexpr std::size_t kSubBlockSize = 32;
+  // Lookahead in seconds.
+  static constexpr double kLookahead = 0.006;
+
+  explicit CompressorKernel(float sampleRate);
+
+  /**
+   * Channels added later start with the lookahead of the first channel, as
+   * an up-mix of the delayed signal would.
+   */
+  void setNumberOfChannels(std::size_t numberOfChannels);
+
+  std::size_t getNumberOfChannels() const;
+
+  std::size_t getLookaheadFrames() const;
+
+  /**
+   * Clears the lookahead and releases the gain reduction.
+   */
+  void reset();
+
+  /**
+   * Compresses `frames` frames of each channel. `output` may alias `input`.
+   * Never allocates.
+   */
+  void process(const float *const *input, float *const *output,
+               std::size_t frames, const CompressorParameters &parameters);
+
+  /**
+   * Gain reduction applied at the end of the last block, in decibels. Zero
+   * or negative; the makeup gain is not included.
+   */
+  float getReduction() const;
+
+  /**
+   * Output level in decibels of the static curve for an input level in
+   * decibels: linear below the threshold, a quadratic knee from the
+   * threshold to threshold + knee, and a slope of 1 / ratio above it.
+   */
+  static float computeCurve(float level,
+                            const CompressorParameters &parameters);
+
+  /**
+   * Largest absolute sample among `n` frames of each channel, from
+   * `offset`.
+   */
+  static float detectPeak(const float *const *channels,
+                          std::size_t numberOfChannels, std::size_t offset,
+                          std::size_t n);
+
+  WEB_AUDIO_PRIVATE : void processChunk(const float *const *input,
+                                        float *const *output,
+                                        std::size_t frames,
+                                        const CompressorParameters &parameters,
+                                        float attack, float release,
+                                        float makeup);
+
+  float sampleRate_;
+  std::size_t numberOfChannels_ = 0;
+  std::size_t lookaheadFrames_;
+  // Each delay line holds capacity_ frames twice in a row, so that the
+  // delayed frames of a chunk are always contiguous.
+  std::size_t capacity_;
+  std::size_t position_ = 0;
+  std::vector<std::vector<float>> delayLines_;
+  // Smoothed gain reduction in decibels.
+  float envelope_ = 0.0f;
+  // Linear gain at the end of the last sub-block, with makeup.
+  float gain_ = 1.0f;
+};
+} // namespace web_audio::detail
\ No newline at end of file
@@ -1,75 +1,371 @@
 #pragma once
 
+#include <algorithm>
+#include <atomic>
 #include <complex>
 #include <concepts>
+#include <cstdint>
+#include <memory>
 #include <stdexcept>
 #include <vector>
 
+#include "common.hh"
+#include "fft.hh"
 #include "math_helper.hh"
-#include "vector_helper.hh"
-#include "wave_processing.hh"
+#include "worker_pool.hh"
 
 namespace web_audio::detail {
 /**
- * Convolver using Overlap-Add method.
+ * Impulse response segment split into equally sized partitions and
+ * transformed to the frequency domain. Immutable once constructed, so it can
+ * be shared between convolvers.
  */
-template <std::floating_point T> class Convolver final {
+template <std::floating_point T> class PartitionedImpulseResponse final {
 public:
-  Convolver(std::vector<T> impulseResponse, std::size_t blockSize)
-      : blockSize_(blockSize), impulseResponseSize_(impulseResponse.size()) {
-    fftSize_ =
-        MathHelper::nextPowerOfTwo(blockSize_ + impulseResponse.size() - 1);
-    impulseResponse.resize(fftSize_, static_cast<T>(0));
-    WaveProcessing::fourierTransform(impulseResponse,
-                                     impulseResponseFrequency_);
-    overlapBuffer_.resize(impulseResponseSize_ - 1, static_cast<T>(0));
-  }
+  PartitionedImpulseResponse(const std::vector<T> &impulseResponse,
+                             std::size_t offset, std::size_t length,
+                             std::size_t partitionSize)
+      : partitionSize_(partitionSize),
+        fftSize_(MathHelper::nextPowerOfTwo(partitionSize * 2)),
+        spectrumSize_(fftSize_ / 2 + 1),
+        partitionCount_((length + partitionSize - 1) / partitionSize),
+        spectra_(partitionCount_ * spectrumSize_) {
+    RealFFT<T> fft(fftSize_);
+    std::vector<T> timeBuffer(fftSize_);
 
-  void process(const std::vector<T> &input, std::vector<T> &output) {
-    if (input.size() != blockSize_) {
-      throw std::invalid_argument("Input size must be equal to block size.");
-    }
+    for (std::size_t p = 0; p < partitionCount_; ++p) {
+      std::fill(timeBuffer.begin(), timeBuffer.end(), static_cast<T>(0));
+      auto begin = offset + p * partitionSize_;
+      auto end = std::min({begin + partitionSize_, offset + length,
+                           impulseResponse.size()});
 
-    if (output.size() < blockSize_) {
-      output.resize(blockSize_);
+      if (begin < end) {
+        std::copy(impulseResponse.begin() + begin,
+                  impulseResponse.begin() + end, timeBuffer.begin());
+      }
+
+      fft.forward(timeBuffer.data(), spectra_.data() + p * spectrumSize_);
     }
+  }
+
+  std::size_t getPartitionSize() const { return partitionSize_; }
+
+  std::size_t getFFTSize() const { return fftSize_; }
+
+  std::size_t getSpectrumSize() const { return spectrumSize_; }
 
-    std::vector<T> inputPadded(fftSize_, static_cast<T>(0));
-    std::copy(input.begin(), input.end(), inputPadded.begin());
+  std::size_t getPartitionCount() const { return partitionCount_; }
 
-    std::vector<std::complex<T>> inputFrequency(fftSize_);
-    WaveProcessing::fourierTransform(inputPadded, inputFrequency);
+  const std::complex<T> *getSpectrum(std::size_t partition) const {
+    return spectra_.data() + partition * spectrumSize_;
+  }
+
+  WEB_AUDIO_PRIVATE : std::size_t partitionSize_;
+  std::size_t fftSize_;
+  std::size_t spectrumSize_;
+  std::size_t partitionCount_;
+  std::vector<std::complex<T>> spectra_;
+};
 
-    std::vector<std::complex<T>> outputFrequency(fftSize_);
+/**
+ * Uniformly partitioned overlap-save convolution (UPOLS) with a frequency
+ * domain delay line. Consumes and produces one partition per call.
+ */
+template <std::floating_point T> class PartitionedConvolution final {
+public:
+  explicit PartitionedConvolution(
+      std::shared_ptr<const PartitionedImpulseResponse<T>> impulseResponse)
+      : impulseResponse_(std::move(impulseResponse)),
+        partitionSize_(impulseResponse_->getPartitionSize()),
+        spectrumSize_(impulseResponse_->getSpectrumSize()),
+        partitionCount_(impulseResponse_->getPartitionCount()),
+        fft_(impulseResponse_->getFFTSize()),
+        delayLine_(partitionCount_ * spectrumSize_),
+        window_(impulseResponse_->getFFTSize(), static_cast<T>(0)),
+        accumulator_(spectrumSize_),
+        timeBuffer_(impulseResponse_->getFFTSize()) {}
 
-    for (std::size_t i = 0; i < fftSize_; ++i) {
-      outputFrequency[i] = inputFrequency[i] * impulseResponseFrequency_[i] *
-                           static_cast<T>(fftSize_);
+  std::size_t getPartitionSize() const { return partitionSize_; }
+
+  /**
+   * Consumes `partitionSize` input samples and writes `partitionSize` output
+   * samples.
+   */
+  void process(const T *input, T *output) {
+    std::copy(window_.begin() + partitionSize_, window_.end(),
+              window_.begin());
+    std::copy(input, input + partitionSize_, window_.end() - partitionSize_);
+
+    fft_.forward(window_.data(),
+                 delayLine_.data() + delayLineIndex_ * spectrumSize_);
+
+    std::fill(accumulator_.begin(), accumulator_.end(),
+              std::complex<T>(0, 0));
+
+    for (std::size_t p = 0; p < partitionCount_; ++p) {
+      auto slot = (delayLineIndex_ + partitionCount_ - p) % partitionCount_;
+      const auto *x = delayLine_.data() + slot * spectrumSize_;
+      const auto *h = impulseResponse_->getSpectrum(p);
+
+      for (std::size_t k = 0; k < spectrumSize_; ++k) {
+        accumulator_[k] += std::complex<T>(
+            x[k].real() * h[k].real() - x[k].imag() * h[k].imag(),
+            x[k].real() * h[k].imag() + x[k].imag() * h[k].real());
+      }
     }
 
-    std::vector<std::complex<T>> outputTime(fftSize_);
-    WaveProcessing::inverseFourierTransform(outputFrequency, outputTime);
+    delayLineIndex_ = (delayLineIndex_ + 1) % partitionCount_;
 
-    for (std::size_t i = 0; i < blockSize_; ++i) {
-      T sample =
-          outputTime[i].real() +
-          (i < overlapBuffer_.size() ? overlapBuffer_[i] : static_cast<T>(0));
-      output[i] = sample;
+    fft_.inverse(accumulator_.data(), timeBuffer_.data());
+    std::copy(timeBuffer_.end() - partitionSize_, timeBuffer_.end(), output);
+  }
+
+  WEB_AUDIO_PRIVATE
+      : std::shared_ptr<const PartitionedImpulseResponse<T>> impulseResponse_;
+  std::size_t partitionSize_;
+  std::size_t spectrumSize_;
+  std::size_t partitionCount_;
+  RealFFT<T> fft_;
+  std::vector<std::complex<T>> delayLine_;
+  std::size_t delayLineIndex_ = 0;
+  std::vector<T> window_;
+  std::vector<std::complex<T>> accumulator_;
+  std::vector<T> timeBuffer_;
+};
+
+/**
+ * Partition layout and spectra of an impulse response for a given block size.
+ *
+ * The head of the impulse response uses block-sized partitions. The tail is
+ * split into segments with partitions growing by a factor of four; a segment
+ * with partition size L starts at offset 2L, which leaves one full partition
+ * period for its computation.
+ */
+template <std::floating_point T> class ConvolverKernel final {
+public:
+  static constexpr std::size_t kMaxPartitionSize = 16384;
+
+  ConvolverKernel(const std::vector<T> &impulseResponse,
+                  std::size_t blockSize)
+      : blockSize_(blockSize),
+        impulseResponseSize_(std::max<std::size_t>(impulseResponse.size(), 1)) {
+    if (blockSize_ == 0) {
+      throw std::invalid_argument("Block size must be positive.");
     }
 
-    web_audio::detail::VectorHelper::shiftLeft(overlapBuffer_, blockSize_);
+    auto headSize = std::min(impulseResponseSize_, blockSize_ * 8);
+    head_ = std::make_shared<const PartitionedImpulseResponse<T>>(
+        impulseResponse, 0, headSize, blockSize_);
 
-    for (std::size_t i = 0; i < impulseResponseSize_ - 1; ++i) {
-      overlapBuffer_[i] += outputTime[blockSize_ + i].real();
+    auto start = headSize;
+    auto partitionSize = blockSize_ * 4;
+
+    while (start < impulseResponseSize_) {
+      auto end = partitionSize * 4 <= kMaxPartitionSize
+                     ? std::min(impulseResponseSize_, partitionSize * 8)
+                     : impulseResponseSize_;
+      tails_.push_back(std::make_shared<const PartitionedImpulseResponse<T>>(
+          impulseResponse, start, end - start, partitionSize));
+      start = end;
+      partitionSize *= 4;
     }
+  }
+
+  std::size_t getBlockSize() const { return blockSize_; }
+
+  std::size_t getImpulseResponseSize() const { return impulseResponseSize_; }
+
+  const std::shared_ptr<const PartitionedImpulseResponse<T>> &
+  getHead() const {
+    return head_;
+  }
 
-    return;
+  const std::vector<std::shared_ptr<const PartitionedImpulseResponse<T>>> &
+  getTails() const {
+    return tails_;
   }
 
   WEB_AUDIO_PRIVATE : std::size_t blockSize_;
-  std::size_t fftSize_;
   std::size_t impulseResponseSize_;
-  std::vector<std::complex<T>> impulseResponseFrequency_;
-  std::vector<T> overlapBuffer_;
+  std::shared_ptr<const PartitionedImpulseResponse<T>> head_;
+  std::vector<std::shared_ptr<const PartitionedImpulseResponse<T>>> tails_;
+};
+
+/**
+ * Tail segment of a Convolver, computed one partition at a time as a
+ * WorkerTask. The input block is copied before submission and the result is
+ * double buffered, so the rendering thread never touches state a worker is
+ * using.
+ */
+template <std::floating_point T>
+class ConvolverTailSegment final : public WorkerTask {
+public:
+  enum State : std::uint32_t { kIdle, kQueued, kRunning };
+
+  explicit ConvolverTailSegment(
+      std::shared_ptr<const PartitionedImpulseResponse<T>> impulseResponse)
+      : convolution_(impulseResponse),
+        inputBuffer_(impulseResponse->getPartitionSize()),
+        pendingInput_(impulseResponse->getPartitionSize()),
+        outputs_{std::vector<T>(impulseResponse->getPartitionSize(),
+                                static_cast<T>(0)),
+                 std::vector<T>(impulseResponse->getPartitionSize(),
+                                static_cast<T>(0))} {}
+
+  void run() override {
+    auto expected = static_cast<std::uint32_t>(kQueued);
+
+    if (!state_.compare_exchange_strong(expected, kRunning,
+                                        std::memory_order_acq_rel)) {
+      return;
+    }
+
+    convolution_.process(pendingInput_.data(),
+                         outputs_[1 - readIndex_].data());
+    state_.store(kIdle, std::memory_order_release);
+    state_.notify_all();
+  }
+
+  /**
+   * Adds the current slice of the last completed partition to `output`.
+   */
+  void read(T *output, std::size_t count) {
+    const auto &buffer = outputs_[readIndex_];
+
+    for (std::size_t i = 0; i < count; ++i) {
+      output[i] += buffer[readPosition_ + i];
+    }
+
+    readPosition_ += count;
+  }
+
+  /**
+   * Appends input and returns true once a full partition is buffered.
+   */
+  bool write(const T *input, std::size_t count) {
+    std::copy(input, input + count, inputBuffer_.begin() + writePosition_);
+    writePosition_ += count;
+    return writePosition_ == inputBuffer_.size();
+  }
+
+  /**
+   * Completes the outstanding job, running it on the calling thread if no
+   * worker has claimed it yet.
+   */
+  void finish() {
+    run();
+    waitIdle();
+  }
+
+  /**
+   * Drops the outstanding job unless a worker is already running it.
+   */
+  void cancel() {
+    auto expected = static_cast<std::uint32_t>(kQueued);
+    state_.compare_exchange_strong(expected, kIdle, std::memory_order_acq_rel);
+    waitIdle();
+  }
+
+  /**
+   * Publishes the finished partition and queues the buffered input.
+   */
+  void swap() {
+    readIndex_ = 1 - readIndex_;
+    readPosition_ = 0;
+    pendingInput_.swap(inputBuffer_);
+    writePosition_ = 0;
+    state_.store(kQueued, std::memory_order_release);
+  }
+
+  WEB_AUDIO_PRIVATE : void waitIdle() {
+    auto state = state_.load(std::memory_order_acquire);
+
+    while (state != kIdle) {
+      state_.wait(state, std::memory_order_acquire);
+      state = state_.load(std::memory_order_acquire);
+    }
+  }
+
+  PartitionedConvolution<T> convolution_;
+  std::vector<T> inputBuffer_;
+  std::size_t writePosition_ = 0;
+  std::vector<T> pendingInput_;
+  std::vector<T> outputs_[2];
+  int readIndex_ = 0;
+  std::size_t readPosition_ = 0;
+  std::atomic<std::uint32_t> state_{kIdle};
+};
+
+/**
+ * Convolver using non-uniformly partitioned overlap-save convolution.
+ *
+ * The head partitions are processed on the calling thread, so there is no
+ * added latency. If a WorkerPool is given, tail segments are computed in the
+ * background, and the calling thread only finishes a segment inline when no
+ * worker has picked it up by its deadline. Only the input and delay line state
+ * belongs to the convolver; the kernel may be shared.
+ */
+template <std::floating_point T> class Convolver final {
+public:
+  explicit Convolver(std::shared_ptr<const ConvolverKernel<T>> kernel,
+                     std::shared_ptr<WorkerPool> workerPool = nullptr)
+      : kernel_(std::move(kernel)), blockSize_(kernel_->getBlockSize()),
+        workerPool_(std::move(workerPool)) {
+    head_ = std::make_unique<PartitionedConvolution<T>>(kernel_->getHead());
+
+    for (const auto &tail : kernel_->getTails()) {
+      tails_.push_back(std::make_shared<ConvolverTailSegment<T>>(tail));
+    }
+  }
+
+  Convolver(std::vector<T> impulseResponse, std::size_t blockSize,
+            std::shared_ptr<WorkerPool> workerPool = nullptr)
+      : Convolver(std::make_shared<const ConvolverKernel<T>>(impulseResponse,
+                                                             blockSize),
+                  std::move(workerPool)) {}
+
+  ~Convolver() {
+    for (auto &tail : tails_) {
+      tail->cancel();
+    }
+  }
+
+  Convolver(const Convolver &) = delete;
+  Convolver &operator=(const Convolver &) = delete;
+
+  const std::shared_ptr<const ConvolverKernel<T>> &getKernel() const {
+    return kernel_;
+  }
+
+  void process(const std::vector<T> &input, std::vector<T> &output) {
+    if (input.size() != blockSize_) {
+      throw std::invalid_argument("Input size must be equal to block size.");
+    }
+
+    if (output.size() < blockSize_) {
+      output.resize(blockSize_);
+    }
+
+    head_->process(input.data(), output.data());
+
+    for (auto &tail : tails_) {
+      tail->read(output.data(), blockSize_);
+
+      if (tail->write(input.data(), blockSize_)) {
+        tail->finish();
+        tail->swap();
+
+        if (!workerPool_ || !workerPool_->submit(tail)) {
+          tail->finish();
+        }
+      }
+    }
+  }
+
+  WEB_AUDIO_PRIVATE : std::shared_ptr<const ConvolverKernel<T>> kernel_;
+  std::size_t blockSize_;
+  std::shared_ptr<WorkerPool> workerPool_;
+  std::unique_ptr<PartitionedConvolution<T>> head_;
+  std::vector<std::shared_ptr<ConvolverTailSegment<T>>> tails_;
 };
 } // namespace web_audio::detail
\ No newline at end of file
@@ -4,15 +4,17 @@
 #include <vector>
 
 #include "common.hh"
+#include "resampler.hh"
 
 namespace web_audio::detail {
-class Downsampler {
+class Downsampler : public Resampler {
   WEB_AUDIO_PROTECTED
       : Downsampler(const std::vector<float> &filterCoefficients,
                     std::size_t factor, std::size_t blockSize);
 
 public:
-  void process(const std::vector<float> &input, std::vector<float> &output);
+  void process(const std::vector<float> &input,
+               std::vector<float> &output) override;
 
   WEB_AUDIO_PROTECTED : std::size_t factor_;
   std::size_t filterSize_;
@@ -28,10 +30,14 @@ public:
 class Downsampler2x : public Downsampler {
 public:
   Downsampler2x(std::size_t blockSize);
+
+  static const std::vector<float> &getFilterCoefficients();
 };
 
 class Downsampler4x : public Downsampler {
 public:
   Downsampler4x(std::size_t blockSize);
+
+  static const std::vector<float> &getFilterCoefficients();
 };
 } // namespace web_audio::detail
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <cstddef>
+
+#include "common.hh"
+
+namespace web_audio::detail {
+/**
+ * Equal-power panning of mono and stereo blocks, as specified for
+ * StereoPannerNode. Constant pans compute the gains once; per-frame pans
+ * evaluate them with a polynomial so that the whole loop is vectorized.
+ */
+class EqualPowerPanner final {
+public:
+  static constexpr std::size_t kChunkSize = 64;
+
+  /**
+   * cos(x * pi / 2) for x in [0, 1], within 1e-6 of std::cos.
+   */
+  static void quarterCosine(const float *x, float *output, std::size_t n);
+
+  static void processMono(const float *input, float pan, float *left,
+                          float *right, std::size_t frames);
+
+  static void processMono(const float *input, const float *pan, float *left,
+                          float *right, std::size_t frames);
+
+  static void processStereo(const float *inputLeft, const float *inputRight,
+                            float pan, float *left, float *right,
+                            std::size_t frames);
+
+  static void processStereo(const float *inputLeft, const float *inputRight,
+                            const float *pan, float *left, float *right,
+                            std::size_t frames);
+};
+} // namespace web_audio::detail
\ No newline at end of file
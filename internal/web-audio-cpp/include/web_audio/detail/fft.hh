@@ -0,0 +1,196 @@
+#pragma once
+
+#include <cmath>
+#include <complex>
+#include <concepts>
+#include <cstddef>
+#include <numbers>
+#include <stdexcept>
+#include <vector>
+
+namespace web_audio::detail {
+/**
+ * In-place iterative radix-2 FFT with precomputed twiddle factors and
+ * bit-reversal permutation. Neither transform allocates, so instances can be
+ * used on the rendering thread.
+ */
+template <std::floating_point T> class FFT final {
+public:
+  explicit FFT(std::size_t size) : size_(size) {
+    if (size == 0 || (size & (size - 1)) != 0) {
+      throw std::invalid_argument("FFT size must be a power of two.");
+    }
+
+    twiddles_.resize(size_ / 2);
+
+    for (std::size_t i = 0; i < size_ / 2; ++i) {
+      auto angle = -2.0 * std::numbers::pi * static_cast<double>(i) /
+                   static_cast<double>(size_);
+      twiddles_[i] = std::complex<T>(static_cast<T>(std::cos(angle)),
+                                     static_cast<T>(std::sin(angle)));
+    }
+
+    std::size_t bits = 0;
+
+    while ((std::size_t{1} << bits) < size_) {
+      ++bits;
+    }
+
+    bitReversed_.resize(size_);
+
+    for (std::size_t i = 0; i < size_; ++i) {
+      std::size_t reversed = 0;
+
+      for (std::size_t b = 0; b < bits; ++b) {
+        if (i & (std::size_t{1} << b)) {
+          reversed |= std::size_t{1} << (bits - 1 - b);
+        }
+      }
+
+      bitReversed_[i] = reversed;
+    }
+  }
+
+  std::size_t getSize() const { return size_; }
+
+  /**
+   * Unnormalized forward transform.
+   */
+  void forward(std::complex<T> *data) const { transform(data, false); }
+
+  /**
+   * Inverse transform, scaled by 1/N.
+   */
+  void inverse(std::complex<T> *data) const {
+    transform(data, true);
+
+    const T scale = static_cast<T>(1) / static_cast<T>(size_);
+
+    for (std::size_t i = 0; i < size_; ++i) {
+      data[i] *= scale;
+    }
+  }
+
+private:
+  void transform(std::complex<T> *data, bool inverse) const {
+    for (std::size_t i = 0; i < size_; ++i) {
+      auto j = bitReversed_[i];
+
+      if (i < j) {
+        std::swap(data[i], data[j]);
+      }
+    }
+
+    for (std::size_t length = 2; length <= size_; length <<= 1) {
+      auto half = length / 2;
+      auto stride = size_ / length;
+
+      for (std::size_t start = 0; start < size_; start += length) {
+        for (std::size_t k = 0; k < half; ++k) {
+          auto w = twiddles_[k * stride];
+
+          if (inverse) {
+            w = std::conj(w);
+          }
+
+          auto &a = data[start + k];
+          auto &b = data[start + k + half];
+          // Expanded complex multiply; std::complex operator* has NaN
+          // handling that keeps it from vectorizing.
+          std::complex<T> t(w.real() * b.real() - w.imag() * b.imag(),
+                            w.real() * b.imag() + w.imag() * b.real());
+          b = a - t;
+          a += t;
+        }
+      }
+    }
+  }
+
+  std::size_t size_;
+  std::vector<std::complex<T>> twiddles_;
+  std::vector<std::size_t> bitReversed_;
+};
+
+/**
+ * FFT of real-valued signals, computed with a half-size complex FFT.
+ * A transform of size N produces N / 2 + 1 bins.
+ */
+template <std::floating_point T> class RealFFT final {
+public:
+  explicit RealFFT(std::size_t size)
+      : size_(size), halfSize_(size / 2), fft_(validateSize(size) / 2),
+        scratch_(halfSize_), twiddles_(halfSize_) {
+    for (std::size_t k = 0; k < halfSize_; ++k) {
+      auto angle = -2.0 * std::numbers::pi * static_cast<double>(k) /
+                   static_cast<double>(size_);
+      twiddles_[k] = std::complex<T>(static_cast<T>(std::cos(angle)),
+                                     static_cast<T>(std::sin(angle)));
+    }
+  }
+
+  std::size_t getSize() const { return size_; }
+
+  std::size_t getSpectrumSize() const { return halfSize_ + 1; }
+
+  /**
+   * Unnormalized forward transform of `size` samples into `size / 2 + 1`
+   * bins.
+   */
+  void forward(const T *input, std::complex<T> *output) {
+    for (std::size_t n = 0; n < halfSize_; ++n) {
+      scratch_[n] = std::complex<T>(input[2 * n], input[2 * n + 1]);
+    }
+
+    fft_.forward(scratch_.data());
+
+    const auto z0 = scratch_[0];
+    output[0] = std::complex<T>(z0.real() + z0.imag(), 0);
+    output[halfSize_] = std::complex<T>(z0.real() - z0.imag(), 0);
+
+    for (std::size_t k = 1; k < halfSize_; ++k) {
+      auto a = scratch_[k];
+      auto b = std::conj(scratch_[halfSize_ - k]);
+      auto even = (a + b) * static_cast<T>(0.5);
+      auto odd = (a - b) * std::complex<T>(0, static_cast<T>(-0.5));
+      output[k] = even + twiddles_[k] * odd;
+    }
+  }
+
+  /**
+   * Inverse transform of `size / 2 + 1` bins into `size` samples, scaled by
+   * 1/N so that inverse(forward(x)) == x.
+   */
+  void inverse(const std::complex<T> *input, T *output) {
+    for (std::size_t k = 0; k < halfSize_; ++k) {
+      auto a = input[k];
+      auto b = std::conj(input[halfSize_ - k]);
+      auto even = (a + b) * static_cast<T>(0.5);
+      auto odd = (a - b) * std::conj(twiddles_[k]) * static_cast<T>(0.5);
+      scratch_[k] = even + std::complex<T>(0, 1) * odd;
+    }
+
+    fft_.inverse(scratch_.data());
+
+    for (std::size_t n = 0; n < halfSize_; ++n) {
+      output[2 * n] = scratch_[n].real();
+      output[2 * n + 1] = scratch_[n].imag();
+    }
+  }
+
+private:
+  static std::size_t validateSize(std::size_t size) {
+    if (size < 2 || (size & (size - 1)) != 0) {
+      throw std::invalid_argument(
+          "RealFFT size must be a power of two greater than 1.");
+    }
+
+    return size;
+  }
+
+  std::size_t size_;
+  std::size_t halfSize_;
+  FFT<T> fft_;
+  std::vector<std::complex<T>> scratch_;
+  std::vector<std::complex<T>> twiddles_;
+};
+} // namespace web_audio::detail
\ No newline at end of file
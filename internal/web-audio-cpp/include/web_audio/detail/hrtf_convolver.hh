@@ -0,0 +1,65 @@
+#pragma once
+
+#include <complex>
+#include <cstddef>
+#include <vector>
+
+#include "common.hh"
+#include "fft.hh"
+#include "hrtf_database.hh"
+
+namespace web_audio::detail {
+/**
+ * Binaural convolution of one source with uniformly partitioned overlap-save
+ * convolution. The frequency-domain delay line depends only on the input, so
+ * both ears share it for a mono source, and changing the filter costs only
+ * the extra multiply-adds and inverse transforms of one crossfaded block.
+ */
+class HrtfConvolver final {
+public:
+  /**
+   * `partitionSize` frames are consumed per call; filters must be
+   * partitioned with the same size and have `partitionCount` partitions.
+   */
+  HrtfConvolver(std::size_t partitionSize, std::size_t partitionCount);
+
+  std::size_t getPartitionSize() const;
+
+  std::size_t getPartitionCount() const;
+
+  /**
+   * Convolves a mono source with both ears of `filter`, or the left and
+   * right channels of a stereo source with the left and right ears if
+   * `inputRight` is not null. When `filter` differs from the filter of the
+   * previous call, the output fades linearly from one to the other over the
+   * block, so that filter must still be alive.
+   */
+  void process(const float *inputLeft, const float *inputRight,
+               const HrtfFilter &filter, float *left, float *right);
+
+  WEB_AUDIO_PRIVATE : struct Channel {
+    std::vector<float> window;
+    std::vector<std::complex<float>> delayLine;
+  };
+
+  void push(Channel &channel, const float *input);
+
+  void convolve(const Channel &channel,
+                const PartitionedImpulseResponse<float> &impulseResponse,
+                float *output);
+
+  std::size_t partitionSize_;
+  std::size_t fftSize_;
+  std::size_t spectrumSize_;
+  std::size_t partitionCount_;
+  RealFFT<float> fft_;
+  Channel channels_[2];
+  std::size_t delayLineIndex_ = 0;
+  bool stereo_ = false;
+  const HrtfFilter *filter_ = nullptr;
+  std::vector<std::complex<float>> accumulator_;
+  std::vector<float> timeBuffer_;
+  std::vector<float> fadeLeft_;
+  std::vector<float> fadeRight_;
+};
+} // namespace web_audio::detail
\ No newline at end of file
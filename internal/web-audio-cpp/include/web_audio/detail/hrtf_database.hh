@@ -0,0 +1,127 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "common.hh"
+#include "convolver.hh"
+
+namespace web_audio::detail {
+/**
+ * Left and right ear filters for one direction, partitioned for
+ * HrtfConvolver.
+ */
+struct HrtfFilter {
+  PartitionedImpulseResponse<float> left;
+  PartitionedImpulseResponse<float> right;
+};
+
+/**
+ * Head-related impulse responses measured on a sphere around the listener.
+ *
+ * Datasets are read from a little-endian binary file:
+ *
+ *   char[4] magic "HRIR"
+ *   u32     version, 1
+ *   f32     sample rate
+ *   u32     taps per impulse response
+ *   u32     number of measurements
+ *   then for each measurement:
+ *     f32   azimuth in degrees, 0 in front and 90 to the right
+ *     f32   elevation in degrees, 90 above
+ *     f32   left impulse response [taps]
+ *     f32   right impulse response [taps]
+ *
+ * Angles follow the conventions of the PannerNode azimuth and elevation.
+ * Impulse responses are resampled to the rate of the context on load.
+ */
+class HrtfDatabase final {
+public:
+  // Directions are quantized to this step before filters are interpolated,
+  // so that nearby directions share cached filters.
+  static constexpr float kAngleStep = 2;
+  static constexpr std::size_t kCacheCapacity = 128;
+
+  struct Measurement {
+    float azimuth;
+    float elevation;
+    std::vector<float> left;
+    std::vector<float> right;
+  };
+
+  /**
+   * Takes impulse responses at the rate of the context. Throws
+   * std::invalid_argument if there are none or if their lengths differ.
+   */
+  explicit HrtfDatabase(std::vector<Measurement> measurements);
+
+  /**
+   * Throws std::invalid_argument if `bytes` is not a dataset in the format
+   * above.
+   */
+  static std::shared_ptr<HrtfDatabase>
+  parse(std::span<const std::uint8_t> bytes, float sampleRate);
+
+  /**
+   * Throws std::runtime_error if the file cannot be read and
+   * std::invalid_argument if it is not a dataset.
+   */
+  static std::shared_ptr<HrtfDatabase> load(const std::string &path,
+                                            float sampleRate);
+
+  std::size_t getLength() const;
+
+  std::size_t getMeasurementCount() const;
+
+  /**
+   * Computes the impulse responses for a direction by weighting the three
+   * nearest measurements by their inverse angular distance.
+   */
+  void interpolate(float azimuth, float elevation, float *left,
+                   float *right) const;
+
+  /**
+   * Returns the filter for the direction rounded to kAngleStep, from a
+   * least recently used cache of kCacheCapacity filters. Locks and may
+   * allocate, so the rendering thread goes through HrtfFilterLoader.
+   */
+  std::shared_ptr<const HrtfFilter>
+  getFilter(float azimuth, float elevation, std::size_t partitionSize);
+
+  std::size_t getCacheSize();
+
+  WEB_AUDIO_PRIVATE : struct Key {
+    std::int32_t azimuth;
+    std::int32_t elevation;
+    std::size_t partitionSize;
+
+    bool operator==(const Key &other) const = default;
+  };
+
+  struct KeyHash {
+    std::size_t operator()(const Key &key) const;
+  };
+
+  struct Entry {
+    std::shared_ptr<const HrtfFilter> filter;
+    std::list<Key>::iterator position;
+  };
+
+  std::size_t length_;
+  std::vector<Measurement> measurements_;
+  // Unit vectors of the measurement directions.
+  std::vector<float> directions_;
+
+  std::mutex mutex_;
+  // Most recently used first.
+  std::list<Key> order_;
+  std::unordered_map<Key, Entry, KeyHash> entries_;
+};
+} // namespace web_audio::detail
\ No newline at end of file
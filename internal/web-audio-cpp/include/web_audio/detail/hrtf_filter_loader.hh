@@ -0,0 +1,107 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "common.hh"
+#include "hrtf_convolver.hh"
+#include "hrtf_database.hh"
+
+namespace web_audio {
+class BaseAudioContext;
+}
+
+namespace web_audio::detail {
+/**
+ * Supplies the HRTF filters of one PannerNode without blocking the rendering
+ * thread. Filters are computed on WorkerPool::getBackground() and published
+ * in a few slots, which the rendering thread takes with find(). Slots it is
+ * done with are released on the worker, so that the rendering thread never
+ * allocates or frees a filter or a convolver.
+ */
+class HrtfFilterLoader final {
+public:
+  HrtfFilterLoader(std::weak_ptr<BaseAudioContext> context,
+                   std::size_t partitionSize);
+
+  HrtfFilterLoader(const HrtfFilterLoader &) = delete;
+  HrtfFilterLoader &operator=(const HrtfFilterLoader &) = delete;
+
+  /**
+   * Computes the filter for a direction on the calling thread, so that
+   * rendering can start with it. Not for the rendering thread.
+   */
+  void preload(float azimuth, float elevation);
+
+  /**
+   * Returns the filter for the direction if it is ready. Otherwise requests
+   * it and returns the filter of the previous call, or null if there is none
+   * yet or no dataset has been loaded. For the rendering thread.
+   * `generation` is BaseAudioContext::getHrtfDatabaseGeneration().
+   */
+  const HrtfFilter *find(float azimuth, float elevation,
+                         std::uint32_t generation);
+
+  /**
+   * Returns the convolver for the filters returned by find().
+   */
+  HrtfConvolver &getConvolver();
+
+  WEB_AUDIO_PRIVATE : enum SlotState : std::uint8_t {
+    kFree,
+    kWriting,
+    kReady,
+    kInUse,
+    kRetired,
+  };
+
+  static constexpr std::size_t kSlotCount = 4;
+
+  struct Slot {
+    std::atomic<std::uint8_t> state{kFree};
+    std::uint64_t key = 0;
+    std::shared_ptr<const HrtfFilter> filter;
+    // Set when the filter needs a convolver with another partition count.
+    std::unique_ptr<HrtfConvolver> convolver;
+  };
+
+  /**
+   * Shared with a queued LoadTask, which may outlive the loader.
+   */
+  struct State {
+    std::weak_ptr<BaseAudioContext> context;
+    std::size_t partitionSize;
+    Slot slots[kSlotCount];
+    std::atomic<std::uint64_t> requested{0};
+    std::atomic<bool> scheduled{false};
+    // Partition count of the convolver the rendering thread uses.
+    std::atomic<std::size_t> partitionCount{0};
+
+    /**
+     * Releases retired slots and publishes the filter for `key`. Only runs
+     * while `scheduled` is held, so loads never overlap.
+     */
+    void load(std::uint64_t key);
+  };
+
+  class LoadTask;
+
+  static std::uint64_t makeKey(float azimuth, float elevation,
+                               std::uint32_t generation);
+
+  void request(std::uint64_t key);
+
+  const HrtfFilter *getCurrentFilter() const;
+
+  std::shared_ptr<State> state_;
+  std::shared_ptr<LoadTask> task_;
+
+  // Rendering thread state. The previous slot stays in use for the
+  // crossfade of the quantum after a change.
+  Slot *current_ = nullptr;
+  Slot *previous_ = nullptr;
+  std::unique_ptr<HrtfConvolver> convolver_;
+};
+} // namespace web_audio::detail
\ No newline at end of file
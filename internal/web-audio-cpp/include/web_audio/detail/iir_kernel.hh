@@ -0,0 +1,74 @@
+#pragma once
+
+#include <complex>
+#include <cstddef>
+#include <optional>
+#include <vector>
+
+#include "biquad_kernel.hh"
+#include "common.hh"
+
+namespace web_audio::detail {
+/**
+ * General IIR filter processing all channels at once.
+ *
+ * Filters above second order are factored into cascaded second-order
+ * sections, which keep their precision in float and run through
+ * BiquadKernel. If the factorization is not accurate enough, the filter runs
+ * as a transposed direct form II in double precision instead.
+ */
+class IIRKernel {
+public:
+  IIRKernel(const std::vector<double> &feedforward,
+            const std::vector<double> &feedback);
+
+  void setNumberOfChannels(std::size_t numberOfChannels);
+
+  std::size_t getNumberOfChannels() const;
+
+  /**
+   * Allocates the filter memory of `numberOfChannels` channels, so that
+   * setNumberOfChannels() up to that many does not allocate.
+   */
+  void reserve(std::size_t numberOfChannels);
+
+  /**
+   * Clears the filter memory of every channel.
+   */
+  void reset();
+
+  /**
+   * `output` may alias `input`.
+   */
+  void process(const float *const *input, float *const *output,
+               std::size_t frames);
+
+  bool isCascade() const;
+
+  /**
+   * Factors b(z^-1) / a(z^-1) into second-order sections. Returns nullopt if
+   * the response of the sections deviates from the original.
+   */
+  static std::optional<std::vector<BiquadCoefficients>>
+  toSecondOrderSections(const std::vector<double> &feedforward,
+                        const std::vector<double> &feedback);
+
+  /**
+   * Roots of c[0] x^n + c[1] x^(n-1) + ... + c[n] by the Aberth method.
+   */
+  static std::vector<std::complex<double>>
+  findRoots(const std::vector<double> &coefficients);
+
+  WEB_AUDIO_PRIVATE : std::size_t numberOfChannels_ = 0;
+
+  std::vector<BiquadKernel> sections_;
+  std::vector<BiquadCoefficients> sectionCoefficients_;
+
+  // Direct form fallback; coefficients normalized by a[0].
+  std::size_t order_ = 0;
+  std::vector<double> b_;
+  std::vector<double> a_;
+  // order_ values per channel
+  std::vector<double> state_;
+};
+} // namespace web_audio::detail
\ No newline at end of file
@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "common.hh"
+#include "convolver.hh"
+
+namespace web_audio::detail {
+/**
+ * Context-wide cache of convolver kernels, keyed by impulse response content
+ * and block size. Only weak references are held, so a kernel is released as
+ * soon as the last convolver using it is destroyed. Entries keep the samples
+ * they were built from, so that impulse responses whose hashes collide do
+ * not share a kernel.
+ */
+class ImpulseResponseCache final {
+public:
+  struct Key {
+    std::uint64_t hash;
+    std::size_t length;
+    std::size_t blockSize;
+
+    bool operator==(const Key &other) const = default;
+  };
+
+  /**
+   * Returns a kernel for the impulse response, building it only if no live
+   * kernel with the same content and block size exists.
+   */
+  std::shared_ptr<const ConvolverKernel<float>>
+  acquire(const std::vector<float> &impulseResponse, std::size_t blockSize);
+
+  std::size_t getSize();
+
+  static std::uint64_t hash(const std::vector<float> &impulseResponse);
+
+  WEB_AUDIO_PRIVATE : struct KeyHash {
+    std::size_t operator()(const Key &key) const;
+  };
+
+  struct Entry {
+    std::vector<float> impulseResponse;
+    std::weak_ptr<const ConvolverKernel<float>> kernel;
+  };
+
+  /**
+   * The entry of `key` built from `impulseResponse`, or end().
+   */
+  std::unordered_multimap<Key, Entry, KeyHash>::iterator
+  find(const Key &key, const std::vector<float> &impulseResponse);
+
+  void prune();
+
+  std::mutex mutex_;
+  std::unordered_multimap<Key, Entry, KeyHash> entries_;
+};
+} // namespace web_audio::detail
\ No newline at end of file
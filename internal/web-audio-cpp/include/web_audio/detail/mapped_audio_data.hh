@@ -0,0 +1,128 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "../mapped_sample_format.hh"
+#include "common.hh"
+#include "worker_pool.hh"
+
+namespace web_audio::detail {
+/**
+ * Read-only memory mapping of a file of audio samples. Planar float data is
+ * read in place. Interleaved data is converted into a planar cache in blocks,
+ * ahead of playback on WorkerPool::getBackground(); untouched blocks of the
+ * cache are never committed by the OS.
+ */
+class MappedAudioData final {
+public:
+  static constexpr std::uint32_t kBlockFrames = 16384;
+  // Blocks converted past the last one read on the rendering thread.
+  static constexpr std::uint32_t kReadAheadBlocks = 2;
+
+  /**
+   * Throws std::runtime_error if the file cannot be mapped and
+   * std::invalid_argument if it is too short for the requested layout.
+   */
+  MappedAudioData(const std::string &path, MappedSampleFormat format,
+                  std::uint32_t numberOfChannels, std::uint64_t byteOffset,
+                  std::uint32_t length);
+
+  /**
+   * Returns the number of frames the file holds past `byteOffset`.
+   */
+  static std::uint64_t getAvailableFrames(const std::string &path,
+                                          MappedSampleFormat format,
+                                          std::uint32_t numberOfChannels,
+                                          std::uint64_t byteOffset);
+
+  static std::size_t getSampleSize(MappedSampleFormat format);
+
+  MappedAudioData(const MappedAudioData &) = delete;
+  MappedAudioData &operator=(const MappedAudioData &) = delete;
+  ~MappedAudioData() noexcept;
+
+  std::uint32_t getLength() const;
+
+  std::uint32_t getNumberOfChannels() const;
+
+  /**
+   * Returns the whole channel, with at least frames [startFrame, startFrame +
+   * frames) readable. Converts missing blocks on the calling thread or waits
+   * for the thread converting them, so it must not be called while rendering.
+   */
+  const float *acquire(std::uint32_t channel, std::uint32_t startFrame,
+                       std::uint32_t frames);
+
+  /**
+   * Version of acquire() for the rendering thread, which never blocks. If a
+   * block is not converted yet, counts an underrun, requests the block from
+   * the background pool and returns null.
+   */
+  const float *tryAcquire(std::uint32_t channel, std::uint32_t startFrame,
+                          std::uint32_t frames);
+
+  /**
+   * Returns how many times tryAcquire() found a block not converted yet.
+   */
+  std::uint64_t getUnderrunCount() const;
+
+  /**
+   * Asks the OS to start paging in the file data for the given frames. For
+   * interleaved data, also converts the first block on the calling thread and
+   * requests the rest from the background pool.
+   */
+  void prefetch(std::uint32_t startFrame, std::uint32_t frames);
+
+  WEB_AUDIO_PRIVATE : enum BlockState : std::uint8_t {
+    kEmpty,
+    kConverting,
+    kReady,
+  };
+
+  class ConversionTask;
+
+  /**
+   * Converts the block unless another thread has claimed it. Returns false if
+   * it is still being converted elsewhere.
+   */
+  bool tryConvertBlock(std::size_t block);
+
+  void convertBlock(std::size_t block);
+
+  /**
+   * Asks the background pool to convert blocks [begin, end).
+   */
+  void request(std::size_t begin, std::size_t end);
+
+  void convertRequested();
+
+  void advise(const void *address, std::size_t size) const;
+
+  MappedSampleFormat format_;
+  std::uint32_t numberOfChannels_;
+  std::uint32_t length_;
+  const std::byte *mapping_ = nullptr;
+  std::size_t mappingSize_ = 0;
+  const std::byte *samples_ = nullptr;
+#if defined(_WIN32)
+  void *fileHandle_ = nullptr;
+  void *mappingHandle_ = nullptr;
+#endif
+  // Planar cache for interleaved formats, left uninitialized so that only
+  // the converted blocks take up memory.
+  std::unique_ptr<float[]> converted_;
+  std::unique_ptr<std::atomic<std::uint8_t>[]> blockStates_;
+  std::size_t blockCount_ = 0;
+  // Blocks last requested for conversion.
+  std::atomic<std::size_t> requestBegin_{0};
+  std::atomic<std::size_t> requestEnd_{0};
+  // Built up front, so that requesting conversion does not allocate.
+  std::shared_ptr<ConversionTask> conversionTask_;
+  std::atomic<bool> conversionScheduled_{false};
+  std::atomic<std::uint64_t> underruns_{0};
+};
+} // namespace web_audio::detail
\ No newline at end of file
@@ -4,9 +4,16 @@
 
 namespace web_audio {
 class AudioScheduledSourceNode;
-}
+class Voice;
+class VoicePool;
+} // namespace web_audio
 
 namespace web_audio::detail {
+struct RenderOrder;
+class WaveShaperOversampler;
+struct WaveShaperCurve;
+struct WaveShaperState;
+
 struct MessageAudioScheduledSourceNodeStart {
   double when;
   double offset;
@@ -19,6 +26,42 @@ struct MessageAudioScheduledSourceNodeStop {
   std::shared_ptr<AudioScheduledSourceNode> node;
 };
 
+/**
+ * Message to reset the nodes of a released voice and return it to its pool.
+ * The pool waits for it before it is destroyed.
+ */
+struct MessageVoicePoolRecycle {
+  VoicePool *pool;
+  Voice *voice;
+};
+
+/**
+ * Message to replace the curve of a WaveShaperNode. The previous one is sent
+ * back to the control thread to be released.
+ */
+struct MessageWaveShaperNodeCurve {
+  std::shared_ptr<WaveShaperState> state;
+  std::shared_ptr<const WaveShaperCurve> curve;
+};
+
+/**
+ * Message to replace the oversampler of a WaveShaperNode, which was built on
+ * the control thread. The previous one is sent back to the control thread to
+ * be released.
+ */
+struct MessageWaveShaperNodeOversampler {
+  std::shared_ptr<WaveShaperState> state;
+  std::shared_ptr<WaveShaperOversampler> oversampler;
+};
+
+/**
+ * Message to replace the order the nodes are rendered in. The previous order
+ * is sent back to the control thread to be released.
+ */
+struct MessageRenderOrder {
+  std::shared_ptr<RenderOrder> order;
+};
+
 /**
  * Message to terminate the rendering thread.
  */
@@ -32,5 +75,8 @@ struct MessageBeginRendering {};
 
 using Message = std::variant<MessageAudioScheduledSourceNodeStart,
                              MessageAudioScheduledSourceNodeStop,
-                             MessageTerminate, MessageBeginRendering>;
+                             MessageVoicePoolRecycle, MessageRenderOrder,
+                             MessageWaveShaperNodeCurve,
+                             MessageWaveShaperNodeOversampler, MessageTerminate,
+                             MessageBeginRendering>;
 } // namespace web_audio::detail
\ No newline at end of file
@@ -0,0 +1,110 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <utility>
+
+#include "common.hh"
+
+namespace web_audio::detail {
+/**
+ * Bounded lock-free multi-producer multi-consumer queue (Vyukov). Capacity is
+ * rounded up to a power of two. All storage is allocated in the constructor.
+ */
+template <typename T> class MpmcQueue final {
+public:
+  explicit MpmcQueue(std::size_t capacity) {
+    if (capacity < 2) {
+      capacity = 2;
+    }
+
+    std::size_t size = 1;
+
+    while (size < capacity) {
+      size <<= 1;
+    }
+
+    mask_ = size - 1;
+    cells_ = std::make_unique<Cell[]>(size);
+
+    for (std::size_t i = 0; i < size; ++i) {
+      cells_[i].sequence.store(i, std::memory_order_relaxed);
+    }
+  }
+
+  MpmcQueue(const MpmcQueue &) = delete;
+  MpmcQueue &operator=(const MpmcQueue &) = delete;
+
+  std::size_t getCapacity() const { return mask_ + 1; }
+
+  /**
+   * Returns false without blocking if the queue is full.
+   */
+  template <typename U> bool tryPush(U &&value) {
+    Cell *cell;
+    auto position = enqueuePosition_.load(std::memory_order_relaxed);
+
+    for (;;) {
+      cell = &cells_[position & mask_];
+      auto sequence = cell->sequence.load(std::memory_order_acquire);
+      auto diff = static_cast<std::ptrdiff_t>(sequence) -
+                  static_cast<std::ptrdiff_t>(position);
+
+      if (diff == 0) {
+        if (enqueuePosition_.compare_exchange_weak(
+                position, position + 1, std::memory_order_relaxed)) {
+          break;
+        }
+      } else if (diff < 0) {
+        return false;
+      } else {
+        position = enqueuePosition_.load(std::memory_order_relaxed);
+      }
+    }
+
+    cell->value = std::forward<U>(value);
+    cell->sequence.store(position + 1, std::memory_order_release);
+    return true;
+  }
+
+  std::optional<T> tryPop() {
+    Cell *cell;
+    auto position = dequeuePosition_.load(std::memory_order_relaxed);
+
+    for (;;) {
+      cell = &cells_[position & mask_];
+      auto sequence = cell->sequence.load(std::memory_order_acquire);
+      auto diff = static_cast<std::ptrdiff_t>(sequence) -
+                  static_cast<std::ptrdiff_t>(position + 1);
+
+      if (diff == 0) {
+        if (dequeuePosition_.compare_exchange_weak(
+                position, position + 1, std::memory_order_relaxed)) {
+          break;
+        }
+      } else if (diff < 0) {
+        return std::nullopt;
+      } else {
+        position = dequeuePosition_.load(std::memory_order_relaxed);
+      }
+    }
+
+    std::optional<T> value(std::move(cell->value));
+    cell->value = T();
+    cell->sequence.store(position + mask_ + 1, std::memory_order_release);
+    return value;
+  }
+
+  WEB_AUDIO_PRIVATE : struct Cell {
+    std::atomic<std::size_t> sequence;
+    T value;
+  };
+
+  std::unique_ptr<Cell[]> cells_;
+  std::size_t mask_;
+  alignas(64) std::atomic<std::size_t> enqueuePosition_{0};
+  alignas(64) std::atomic<std::size_t> dequeuePosition_{0};
+};
+} // namespace web_audio::detail
\ No newline at end of file
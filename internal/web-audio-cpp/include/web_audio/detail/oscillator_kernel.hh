@@ -0,0 +1,62 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "common.hh"
+
+namespace web_audio::detail {
+/**
+ * Block oscillator core. The phase is a 32-bit fixed-point fraction of a
+ * cycle, so it wraps exactly and does not drift over long notes. Phases for a
+ * chunk of frames are accumulated first and then evaluated in a branch-free
+ * loop that the compiler can vectorize to the width of the target.
+ */
+class OscillatorKernel final {
+public:
+  static constexpr std::size_t kChunkSize = 64;
+
+  /**
+   * Converts a frequency in cycles per frame to a fixed-point phase
+   * increment. Negative and out-of-range values wrap like the phase does.
+   */
+  static std::uint32_t toPhaseIncrement(double cyclesPerFrame);
+
+  /**
+   * Polynomial approximation of sin(2 pi phase / 2^32), within 1e-6 of
+   * std::sin for every phase.
+   */
+  static void sine(const std::uint32_t *phases, float *output, std::size_t n);
+
+  std::uint32_t getPhase() const;
+
+  void setPhase(std::uint32_t phase);
+
+  void processSine(std::uint32_t increment, float *output, std::size_t frames);
+
+  void processSine(const std::uint32_t *increments, float *output,
+                   std::size_t frames);
+
+  /**
+   * Reads two wavetables of 2^tableBits samples plus a guard sample, with
+   * linear interpolation, and crossfades them by `weight`.
+   */
+  void processTables(const float *table0, const float *table1, float weight,
+                     unsigned tableBits, std::uint32_t increment,
+                     float *output, std::size_t frames);
+
+  void processTables(const float *table0, const float *table1, float weight,
+                     unsigned tableBits, const std::uint32_t *increments,
+                     float *output, std::size_t frames);
+
+  WEB_AUDIO_PRIVATE : template <typename IncrementAt, typename Evaluate>
+  void processChunks(IncrementAt incrementAt, Evaluate evaluate, float *output,
+                     std::size_t frames);
+
+  static void tables(const float *table0, const float *table1, float weight,
+                     unsigned tableBits, const std::uint32_t *phases,
+                     float *output, std::size_t n);
+
+  std::uint32_t phase_ = 0;
+};
+} // namespace web_audio::detail
\ No newline at end of file
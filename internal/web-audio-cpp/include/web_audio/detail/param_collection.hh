@@ -1,6 +1,7 @@
 #pragma once
 
 #include <memory>
+#include <span>
 #include <unordered_map>
 #include <vector>
 
@@ -16,17 +17,42 @@ public:
   ParamCollection() = default;
   ~ParamCollection() noexcept = default;
 
-  float getValue(std::shared_ptr<AudioParam> param, size_t frame) const;
+  float getValue(const std::shared_ptr<AudioParam> &param, size_t frame) const;
 
-  void setValue(std::shared_ptr<AudioParam> param, float value);
+  /**
+   * Returns the values of the param for the quantum, or an empty span if the
+   * param is unknown. Lets nodes read a-rate params without a lookup per
+   * frame.
+   */
+  std::span<const float>
+  getValues(const std::shared_ptr<AudioParam> &param) const;
 
-  void setValues(std::shared_ptr<AudioParam> param,
+  /**
+   * Returns true if the param has the same value for every frame of the
+   * quantum. Decided when the values are set.
+   */
+  bool isConstant(const std::shared_ptr<AudioParam> &param) const;
+
+  void setValue(const std::shared_ptr<AudioParam> &param, float value);
+
+  /**
+   * Sets `frames` copies of `value`, so that getValues() still spans the
+   * quantum.
+   */
+  void setValue(const std::shared_ptr<AudioParam> &param, float value,
+                std::size_t frames);
+
+  void setValues(const std::shared_ptr<AudioParam> &param,
                  const std::vector<float> &values);
 
   void clear();
 
-  WEB_AUDIO_PRIVATE
-      : std::unordered_map<std::shared_ptr<AudioParam>, std::vector<float>>
-            params_;
+  WEB_AUDIO_PRIVATE : struct Values {
+    std::vector<float> values;
+    bool constant;
+  };
+
+  // Keyed by address, so that a lookup does not touch a reference count.
+  std::unordered_map<const AudioParam *, Values> params_;
 };
 } // namespace web_audio::detail
\ No newline at end of file
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "common.hh"
+#include "resampler.hh"
+
+namespace web_audio::detail {
+/**
+ * Interpolating FIR upsampler in polyphase form. Output frame `n * factor + p`
+ * only uses the taps of phase `p`, so the stuffed zeros are never multiplied.
+ * Produces the same output as Upsampler for the same coefficients.
+ */
+class PolyphaseUpsampler : public Resampler {
+public:
+  PolyphaseUpsampler(const std::vector<float> &filterCoefficients,
+                     std::size_t factor, std::size_t blockSize);
+
+  void process(const std::vector<float> &input,
+               std::vector<float> &output) override;
+
+  WEB_AUDIO_PRIVATE : std::size_t factor_;
+  std::size_t inputBlockSize_;
+  std::size_t tapsPerPhase_;
+  // Taps of each phase in reverse order, zero-padded to tapsPerPhase_.
+  std::vector<float> phases_;
+  // The last tapsPerPhase_ - 1 input frames followed by the current block.
+  std::vector<float> history_;
+};
+
+/**
+ * Decimating FIR downsampler that only computes the frames it keeps.
+ * Produces the same output as Downsampler for the same coefficients.
+ */
+class PolyphaseDownsampler : public Resampler {
+public:
+  PolyphaseDownsampler(const std::vector<float> &filterCoefficients,
+                       std::size_t factor, std::size_t blockSize);
+
+  void process(const std::vector<float> &input,
+               std::vector<float> &output) override;
+
+  WEB_AUDIO_PRIVATE : std::size_t factor_;
+  std::size_t inputBlockSize_;
+  // Taps in reverse order.
+  std::vector<float> taps_;
+  // The last taps_.size() - 1 input frames followed by the current block.
+  std::vector<float> history_;
+};
+} // namespace web_audio::detail
\ No newline at end of file
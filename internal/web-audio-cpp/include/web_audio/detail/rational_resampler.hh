@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "common.hh"
+
+namespace web_audio::detail {
+/**
+ * Polyphase windowed-sinc converter between two sample rates related by
+ * L / M. Output frame n is computed from the input around n * M / L with the
+ * phase (n * M) % L, so any range of output frames can be computed
+ * independently of the others, e.g. on several threads.
+ */
+class RationalResampler final {
+public:
+  static constexpr std::size_t kZeroCrossings = 32;
+  static constexpr std::uint32_t kMaxPhases = 4096;
+
+  /**
+   * Rates are rounded to integers. When the reduced ratio needs more than
+   * kMaxPhases phases it is approximated, which is off by well under a cent.
+   */
+  RationalResampler(double sourceRate, double targetRate);
+
+  std::uint32_t getUpFactor() const { return upFactor_; }
+
+  std::uint32_t getDownFactor() const { return downFactor_; }
+
+  std::size_t getTapsPerPhase() const { return tapsPerPhase_; }
+
+  /**
+   * Number of output frames for `inputLength` input frames.
+   */
+  std::size_t getOutputLength(std::size_t inputLength) const;
+
+  /**
+   * Computes output frames [outputStart, outputStart + frames) of `input`,
+   * treating samples outside [0, inputLength) as silence.
+   */
+  void process(const float *input, std::size_t inputLength,
+               std::size_t outputStart, float *output,
+               std::size_t frames) const;
+
+  WEB_AUDIO_PRIVATE : std::uint32_t upFactor_;
+  std::uint32_t downFactor_;
+  // Input samples on each side of the output position.
+  std::size_t halfWidth_;
+  std::size_t tapsPerPhase_;
+  // tapsPerPhase_ taps for each of upFactor_ phases. Tap k of phase p applies
+  // to input sample floor(n * M / L) - halfWidth_ + 1 + k.
+  std::vector<float> phases_;
+};
+} // namespace web_audio::detail
\ No newline at end of file
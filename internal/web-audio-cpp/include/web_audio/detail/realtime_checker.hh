@@ -0,0 +1,108 @@
+#pragma once
+
+#include <cstdint>
+#include <functional>
+#include <string>
+
+#include "common.hh"
+
+namespace web_audio {
+class AudioNode;
+}
+
+namespace web_audio::detail {
+struct RealtimeViolation {
+  // "allocation", "deallocation" or "lock"
+  std::string kind;
+  // Type of the node being processed, or "render loop" for the rendering
+  // work around the nodes.
+  std::string node;
+  // Innermost frame first, one per line.
+  std::string stack;
+  // First sample frame of the render quantum being rendered.
+  std::uint64_t frame;
+};
+
+using RealtimeViolationHandler =
+    std::function<void(const RealtimeViolation &violation)>;
+
+/**
+ * Opt-in detection of heap allocation and mutex locking while a render
+ * quantum is rendered. When built with WEB_AUDIO_REALTIME_CHECKS, the global
+ * operator new and delete, and on Linux pthread_mutex_lock, report to the
+ * checker; otherwise nothing is intercepted and no violation is ever
+ * reported.
+ *
+ * BaseAudioContext::render() is checked as a whole, and violations are
+ * attributed to the node being processed, if any.
+ */
+class RealtimeChecker final {
+public:
+  /**
+   * Marks the current thread as processing `node` for the render quantum
+   * starting at `frame` for its lifetime.
+   */
+  class NodeScope final {
+  public:
+    NodeScope(const AudioNode &node, std::uint64_t frame);
+    ~NodeScope();
+
+    NodeScope(const NodeScope &) = delete;
+    NodeScope &operator=(const NodeScope &) = delete;
+
+    WEB_AUDIO_PRIVATE : const AudioNode *previousNode_;
+    std::uint64_t previousFrame_;
+  };
+
+  /**
+   * Marks the current thread as rendering the render quantum starting at
+   * `frame` for its lifetime.
+   */
+  class RenderScope final {
+  public:
+    explicit RenderScope(std::uint64_t frame);
+    ~RenderScope();
+
+    RenderScope(const RenderScope &) = delete;
+    RenderScope &operator=(const RenderScope &) = delete;
+
+    WEB_AUDIO_PRIVATE : bool previousRendering_;
+    std::uint64_t previousFrame_;
+  };
+
+  /**
+   * Suspends checks on the current thread for its lifetime.
+   */
+  class Exemption final {
+  public:
+    Exemption();
+    ~Exemption();
+
+    Exemption(const Exemption &) = delete;
+    Exemption &operator=(const Exemption &) = delete;
+  };
+
+  /**
+   * Whether the library was built with WEB_AUDIO_REALTIME_CHECKS.
+   */
+  static bool isAvailable();
+
+  static void setEnabled(bool enabled);
+
+  static bool isEnabled();
+
+  /**
+   * Called on the offending thread for each violation. The default handler,
+   * restored by passing nullptr, writes to stderr.
+   */
+  static void setHandler(RealtimeViolationHandler handler);
+
+  static std::uint64_t getViolationCount();
+
+  /**
+   * Reports a violation of `kind` if the current thread is rendering or
+   * processing a node. Called by the interceptors.
+   */
+  static void check(const char *kind);
+};
+} // namespace web_audio::detail
\ No newline at end of file
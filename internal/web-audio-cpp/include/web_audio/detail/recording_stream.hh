@@ -0,0 +1,127 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "../audio_recording_options.hh"
+#include "common.hh"
+#include "mpmc_queue.hh"
+
+namespace web_audio::detail {
+/**
+ * Counterpart of AudioFileStream for writing. The rendering thread copies
+ * frames into a fixed ring of blocks, handed through lock-free queues to a
+ * background I/O thread that passes each full block to a consumer, so
+ * memory stays bounded by the ring size whatever the length of the
+ * recording.
+ */
+class RecordingStream final {
+public:
+  static constexpr std::uint32_t kBlockFrames = 2048;
+
+  using Consumer =
+      std::function<void(const float *const *channels, std::uint32_t frames)>;
+
+  /**
+   * `consumer` and then `finish` run on the I/O thread; `finish` once,
+   * after the last block.
+   */
+  RecordingStream(std::uint32_t numberOfChannels,
+                  std::uint32_t numberOfBlocks, Consumer consumer,
+                  std::function<void()> finish = nullptr);
+
+  /**
+   * Records to the callback or WAVE file of `options`. Throws
+   * std::invalid_argument if neither is given or the format is unsupported,
+   * and std::runtime_error if the file cannot be created.
+   */
+  static std::unique_ptr<RecordingStream>
+  create(const AudioRecordingOptions &options, std::uint32_t numberOfChannels,
+         float sampleRate);
+
+  /**
+   * Calls close(), ignoring what the consumer threw.
+   */
+  ~RecordingStream();
+
+  RecordingStream(const RecordingStream &) = delete;
+  RecordingStream &operator=(const RecordingStream &) = delete;
+
+  std::uint32_t getNumberOfChannels() const;
+
+  /**
+   * Appends `frames` frames of each channel, or silence if `sources` is
+   * null. Never blocks or allocates: frames that do not fit in the ring are
+   * dropped and counted as an overflow. Must only be called from one thread
+   * at a time.
+   */
+  void write(const float *const *sources, std::uint32_t frames);
+
+  /**
+   * Like write(), but waits for the I/O thread instead of dropping frames.
+   * For rendering that is not real-time.
+   */
+  void writeWaiting(const float *const *sources, std::uint32_t frames);
+
+  /**
+   * Hands the frames written so far to the consumer and waits until it and
+   * `finish` have returned. Nothing may be written afterwards. Rethrows the
+   * first exception of the consumer or `finish`, which stops the recording.
+   */
+  void close();
+
+  /**
+   * Number of writes that did not fit in the ring.
+   */
+  std::uint64_t getOverflowCount() const;
+
+  std::uint64_t getDroppedFrames() const;
+
+  WEB_AUDIO_PRIVATE : struct Block {
+    std::vector<float> samples;
+    std::uint32_t frames = 0;
+  };
+
+  void write(const float *const *sources, std::uint32_t frames, bool wait);
+
+  void submit();
+
+  void ioLoop();
+
+  /**
+   * Passes the ready blocks to the consumer and frees them.
+   */
+  void drain();
+
+  void wake();
+
+  std::uint32_t numberOfChannels_;
+  std::vector<Block> blocks_;
+  MpmcQueue<std::uint32_t> freeBlocks_;
+  MpmcQueue<std::uint32_t> readyBlocks_;
+  Consumer consumer_;
+  std::function<void()> finish_;
+
+  std::atomic<std::uint32_t> signal_{0};
+  // Incremented whenever a block is freed.
+  std::atomic<std::uint32_t> released_{0};
+  std::atomic<bool> stopping_{false};
+  std::atomic<std::uint64_t> overflowCount_{0};
+  std::atomic<std::uint64_t> droppedFrames_{0};
+
+  // Writer state.
+  std::int64_t currentBlock_ = -1;
+  bool closed_ = false;
+
+  // I/O thread state.
+  std::vector<const float *> channels_;
+  std::exception_ptr error_;
+
+  std::thread thread_;
+};
+} // namespace web_audio::detail
\ No newline at end of file
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "common.hh"
+#include "param_collection.hh"
+#include "render_quantum.hh"
+
+namespace web_audio {
+class AudioNode;
+class AudioParam;
+} // namespace web_audio
+
+namespace web_audio::detail {
+/**
+ * The nodes of an AudioGraph in processing order, with their connections
+ * resolved to positions in that order and the storage for rendering them.
+ * Built on the control thread by AudioGraph::createRenderOrder() for each
+ * change of the graph and handed to the rendering thread, which never
+ * touches the graph itself. It keeps its nodes and params alive while they
+ * are rendered.
+ */
+struct RenderOrder {
+  /**
+   * Output `sourceIndex` of the node at position `source`, which comes
+   * earlier in the order.
+   */
+  struct Connection {
+    std::uint32_t source;
+    std::uint32_t sourceIndex;
+    std::uint32_t destinationIndex;
+  };
+
+  struct Param {
+    std::shared_ptr<AudioParam> param;
+    std::vector<Connection> connections;
+    // The computed values of the quantum being rendered.
+    RenderQuantum values;
+  };
+
+  struct Node {
+    std::shared_ptr<AudioNode> node;
+    std::vector<Param> params;
+    std::vector<Connection> connections;
+    // The inputs of the quantum being rendered, and whether a connection
+    // has written to each of them yet.
+    std::vector<RenderQuantum> inputs;
+    std::vector<bool> inputsConnected;
+    // Has an entry for every param, so that setting the values of a quantum
+    // does not allocate.
+    ParamCollection paramValues;
+    // The outputs of the quantum being rendered.
+    std::vector<RenderQuantum> results;
+    // How many connections read each output, and how many of those reads are
+    // still to come in the quantum being rendered. The last reader takes the
+    // output over, so that writing to it in place does not copy.
+    std::vector<std::uint32_t> reads;
+    std::vector<std::uint32_t> pendingReads;
+  };
+
+  std::vector<Node> nodes;
+  // Position of the AudioDestinationNode.
+  std::uint32_t destination = 0;
+  // AudioGraph::getVersion() of the graph this order was built from.
+  std::uint64_t version = 0;
+};
+} // namespace web_audio::detail
\ No newline at end of file
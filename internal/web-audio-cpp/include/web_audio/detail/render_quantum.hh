@@ -2,14 +2,31 @@
 
 #include <cmath>
 #include <cstdint>
+#include <memory>
+#include <optional>
 #include <vector>
 
 #include "../channel_interpretation.hh"
 #include "common.hh"
 
 namespace web_audio::detail {
+/**
+ * Channels are reference-counted and shared between copies; a channel is
+ * copied on the first access through a non-const reference while another
+ * quantum refers to it. Copying a quantum, passing it through or routing
+ * its channels therefore never copies samples. A reference obtained from
+ * the non-const operator[] must not be kept across a copy of the quantum.
+ *
+ * A channel may also be constant: a single value whose samples are only
+ * filled in when a consumer reads them per frame.
+ *
+ * Samples written while a SampleBufferPool is installed come from the pool.
+ */
 class RenderQuantum {
 public:
+  // The most channels a node input or output can have.
+  static constexpr std::uint32_t kMaxChannelCount = 32;
+
   RenderQuantum();
   RenderQuantum(std::uint32_t numberOfChannels);
   RenderQuantum(std::uint32_t numberOfChannels, std::uint32_t length);
@@ -25,10 +42,53 @@ public:
 
   std::size_t size() const;
 
+  /**
+   * Makes the quantum `numberOfChannels` silent channels. Unlike assigning
+   * a new quantum, this reuses the storage of the channel list.
+   */
+  void reset(std::uint32_t numberOfChannels);
+
+  /**
+   * Makes room for `numberOfChannels` channels, so that adding channels up
+   * to that many does not allocate.
+   */
+  void reserve(std::uint32_t numberOfChannels);
+
+  /**
+   * Detaches the channel if it is shared. The channel is no longer constant
+   * afterwards.
+   */
   std::vector<float> &operator[](std::uint32_t channel);
 
+  /**
+   * Fills in the samples of a constant channel on first access.
+   */
   const std::vector<float> &operator[](std::uint32_t channel) const;
 
+  /**
+   * Makes `channel` refer to `sourceChannel` of `source` without copying
+   * the samples.
+   */
+  void setChannel(std::uint32_t channel, const RenderQuantum &source,
+                  std::uint32_t sourceChannel);
+
+  /**
+   * Whether the samples of `channel` are also referred to elsewhere.
+   */
+  bool isShared(std::uint32_t channel) const;
+
+  /**
+   * Makes every frame of `channel` equal to `value` without writing samples.
+   */
+  void setConstant(std::uint32_t channel, float value);
+
+  bool isConstant(std::uint32_t channel) const;
+
+  /**
+   * The value of a constant channel.
+   */
+  float getConstant(std::uint32_t channel) const;
+
   void mix(std::uint32_t computedNumberOfChannels,
            ChannelInterpretation channelInterpretation);
 
@@ -37,7 +97,29 @@ public:
 
   std::vector<float> getInterleaved() const;
 
-  WEB_AUDIO_PRIVATE : std::uint32_t length_;
-  std::vector<std::vector<float>> channelData_;
+  WEB_AUDIO_PRIVATE : struct Channel {
+    // Null for a constant channel until it is read per frame.
+    std::shared_ptr<std::vector<float>> samples;
+    std::optional<float> constant;
+    // Whether the samples come from a SampleBufferPool, which holds another
+    // reference to them.
+    bool pooled = false;
+  };
+
+  /**
+   * A channel with samples of unspecified value that nothing else refers to.
+   */
+  Channel createChannel() const;
+
+  /**
+   * A constant zero channel whose samples are shared by all silent channels
+   * of this length.
+   */
+  Channel getSilentChannel() const;
+
+  std::uint32_t length_;
+  // Mutable so that the samples of constant channels can be filled in by
+  // const accessors.
+  mutable std::vector<Channel> channelData_;
 };
 } // namespace web_audio::detail
\ No newline at end of file
@@ -0,0 +1,39 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace web_audio::detail {
+enum class ResamplerType {
+  // Overlap-add FFT convolution.
+  eFFT,
+  // Direct polyphase FIR, skipping stuffed zeros and discarded samples.
+  ePolyphase,
+};
+
+/**
+ * Fixed-ratio resampler processing one block at a time.
+ */
+class Resampler {
+public:
+  virtual ~Resampler() = default;
+
+  virtual void process(const std::vector<float> &input,
+                       std::vector<float> &output) = 0;
+
+  /**
+   * Creates an upsampler by `factor` (2 or 4) with `blockSize` input frames.
+   */
+  static std::unique_ptr<Resampler>
+  createUpsampler(ResamplerType type, std::size_t factor,
+                  std::size_t blockSize);
+
+  /**
+   * Creates a downsampler by `factor` (2 or 4) with `blockSize` input frames.
+   */
+  static std::unique_ptr<Resampler>
+  createDownsampler(ResamplerType type, std::size_t factor,
+                    std::size_t blockSize);
+};
+} // namespace web_audio::detail
\ No newline at end of file
@@ -0,0 +1,56 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "common.hh"
+
+namespace web_audio::detail {
+/**
+ * Sample buffers for the channels of RenderQuantums, reused once no quantum
+ * refers to them, so that rendering stops allocating after the first quanta.
+ * A context installs its pool on the rendering thread with a Scope for each
+ * render quantum; quanta written elsewhere allocate their samples.
+ */
+class SampleBufferPool final {
+public:
+  /**
+   * Makes `pool` the current pool of the calling thread for its lifetime.
+   */
+  class Scope final {
+  public:
+    explicit Scope(SampleBufferPool &pool);
+    ~Scope();
+
+    Scope(const Scope &) = delete;
+    Scope &operator=(const Scope &) = delete;
+
+    WEB_AUDIO_PRIVATE : SampleBufferPool *previous_;
+  };
+
+  SampleBufferPool() = default;
+
+  SampleBufferPool(const SampleBufferPool &) = delete;
+  SampleBufferPool &operator=(const SampleBufferPool &) = delete;
+
+  /**
+   * The pool installed on the calling thread, or null.
+   */
+  static SampleBufferPool *getCurrent();
+
+  /**
+   * Returns a buffer of `length` samples with unspecified contents that no
+   * quantum refers to. The pool keeps a reference of its own.
+   */
+  std::shared_ptr<std::vector<float>> acquire(std::uint32_t length);
+
+  WEB_AUDIO_PRIVATE : using Buffer = std::shared_ptr<std::vector<float>>;
+
+  std::vector<Buffer> buffers_;
+  // Where the next search starts. Buffers tend to be released in the order
+  // they were acquired, so the search usually ends early.
+  std::size_t next_ = 0;
+};
+} // namespace web_audio::detail
\ No newline at end of file
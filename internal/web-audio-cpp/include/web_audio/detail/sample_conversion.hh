@@ -0,0 +1,263 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#include "vector_math.hh"
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define WEB_AUDIO_SAMPLE_CONVERSION_SSE2
+#endif
+
+namespace web_audio::detail {
+/**
+ * Vectorized conversions between little-endian PCM and float, and
+ * (de)interleaving of float frames. Byte pointers have no alignment
+ * requirement.
+ */
+class SampleConversion {
+public:
+  static void fromUint8(const std::uint8_t *source, float *destination,
+                        std::size_t size) {
+    for (std::size_t i = 0; i < size; ++i) {
+      destination[i] = (static_cast<float>(source[i]) - 128.0f) / 128.0f;
+    }
+  }
+
+  static void fromInt16(const std::uint8_t *source, float *destination,
+                        std::size_t size) {
+    constexpr float kScale = 1.0f / 32768.0f;
+    std::size_t i = 0;
+
+#if defined(WEB_AUDIO_SAMPLE_CONVERSION_SSE2)
+    const __m128 scale = _mm_set1_ps(kScale);
+
+    for (; i + 8 <= size; i += 8) {
+      auto packed = _mm_loadu_si128(
+          reinterpret_cast<const __m128i *>(source + i * 2));
+      // Placing each sample in the upper half and shifting back
+      // sign-extends it.
+      auto low = _mm_srai_epi32(_mm_unpacklo_epi16(packed, packed), 16);
+      auto high = _mm_srai_epi32(_mm_unpackhi_epi16(packed, packed), 16);
+      _mm_storeu_ps(destination + i,
+                    _mm_mul_ps(_mm_cvtepi32_ps(low), scale));
+      _mm_storeu_ps(destination + i + 4,
+                    _mm_mul_ps(_mm_cvtepi32_ps(high), scale));
+    }
+#elif defined(WEB_AUDIO_VECTOR_MATH_NEON)
+    for (; i + 8 <= size; i += 8) {
+      auto packed = vreinterpretq_s16_u8(vld1q_u8(source + i * 2));
+      auto low = vcvtq_f32_s32(vmovl_s16(vget_low_s16(packed)));
+      auto high = vcvtq_f32_s32(vmovl_s16(vget_high_s16(packed)));
+      vst1q_f32(destination + i, vmulq_n_f32(low, kScale));
+      vst1q_f32(destination + i + 4, vmulq_n_f32(high, kScale));
+    }
+#endif
+
+    for (; i < size; ++i) {
+      std::int16_t sample;
+      std::memcpy(&sample, source + i * 2, sizeof(sample));
+      destination[i] = sample * kScale;
+    }
+  }
+
+  static void fromInt24(const std::uint8_t *source, float *destination,
+                        std::size_t size) {
+    constexpr float kScale = 1.0f / 2147483648.0f;
+
+    for (std::size_t i = 0; i < size; ++i) {
+      const auto *bytes = source + i * 3;
+      // Assemble in the upper three bytes so that the sign is kept.
+      auto sample = static_cast<std::int32_t>(
+          (static_cast<std::uint32_t>(bytes[0]) << 8) |
+          (static_cast<std::uint32_t>(bytes[1]) << 16) |
+          (static_cast<std::uint32_t>(bytes[2]) << 24));
+      destination[i] = static_cast<float>(sample) * kScale;
+    }
+  }
+
+  static void fromInt32(const std::uint8_t *source, float *destination,
+                        std::size_t size) {
+    constexpr float kScale = 1.0f / 2147483648.0f;
+    std::size_t i = 0;
+
+#if defined(WEB_AUDIO_SAMPLE_CONVERSION_SSE2)
+    const __m128 scale = _mm_set1_ps(kScale);
+
+    for (; i + 4 <= size; i += 4) {
+      auto packed = _mm_loadu_si128(
+          reinterpret_cast<const __m128i *>(source + i * 4));
+      _mm_storeu_ps(destination + i,
+                    _mm_mul_ps(_mm_cvtepi32_ps(packed), scale));
+    }
+#elif defined(WEB_AUDIO_VECTOR_MATH_NEON)
+    for (; i + 4 <= size; i += 4) {
+      auto packed = vreinterpretq_s32_u8(vld1q_u8(source + i * 4));
+      vst1q_f32(destination + i, vmulq_n_f32(vcvtq_f32_s32(packed), kScale));
+    }
+#endif
+
+    for (; i < size; ++i) {
+      std::int32_t sample;
+      std::memcpy(&sample, source + i * 4, sizeof(sample));
+      destination[i] = static_cast<float>(sample) * kScale;
+    }
+  }
+
+  static void fromFloat32(const std::uint8_t *source, float *destination,
+                          std::size_t size) {
+    std::memcpy(destination, source, size * sizeof(float));
+  }
+
+  static void fromFloat64(const std::uint8_t *source, float *destination,
+                          std::size_t size) {
+    std::size_t i = 0;
+
+#if defined(WEB_AUDIO_SAMPLE_CONVERSION_SSE2)
+    for (; i + 4 <= size; i += 4) {
+      auto low = _mm_cvtpd_ps(
+          _mm_loadu_pd(reinterpret_cast<const double *>(source + i * 8)));
+      auto high = _mm_cvtpd_ps(
+          _mm_loadu_pd(reinterpret_cast<const double *>(source + i * 8 + 16)));
+      _mm_storeu_ps(destination + i, _mm_movelh_ps(low, high));
+    }
+#endif
+
+    for (; i < size; ++i) {
+      double sample;
+      std::memcpy(&sample, source + i * 8, sizeof(sample));
+      destination[i] = static_cast<float>(sample);
+    }
+  }
+
+  /**
+   * Clamps to [-1, 1) and rounds to the nearest step.
+   */
+  static void toInt16(const float *source, std::uint8_t *destination,
+                      std::size_t size) {
+    for (std::size_t i = 0; i < size; ++i) {
+      auto sample = static_cast<std::int16_t>(
+          std::lrint(std::clamp(source[i] * 32768.0f, -32768.0f, 32767.0f)));
+      std::memcpy(destination + i * 2, &sample, sizeof(sample));
+    }
+  }
+
+  /**
+   * Clamps to [-1, 1) and rounds to the nearest step.
+   */
+  static void toInt24(const float *source, std::uint8_t *destination,
+                      std::size_t size) {
+    for (std::size_t i = 0; i < size; ++i) {
+      auto sample = static_cast<std::int32_t>(std::lrint(
+          std::clamp(source[i] * 8388608.0f, -8388608.0f, 8388607.0f)));
+      auto *bytes = destination + i * 3;
+      bytes[0] = static_cast<std::uint8_t>(sample);
+      bytes[1] = static_cast<std::uint8_t>(sample >> 8);
+      bytes[2] = static_cast<std::uint8_t>(sample >> 16);
+    }
+  }
+
+  static void toFloat32(const float *source, std::uint8_t *destination,
+                        std::size_t size) {
+    std::memcpy(destination, source, size * sizeof(float));
+  }
+
+  /**
+   * Joins one array per channel into `frames` interleaved frames of
+   * `channels` samples.
+   */
+  static void interleave(const float *const *sources, std::size_t channels,
+                         std::size_t frames, float *destination) {
+    if (channels == 1) {
+      std::memcpy(destination, sources[0], frames * sizeof(float));
+      return;
+    }
+
+    std::size_t i = 0;
+
+    if (channels == 2) {
+      const auto *left = sources[0];
+      const auto *right = sources[1];
+
+#if defined(WEB_AUDIO_VECTOR_MATH_SSE)
+      for (; i + 4 <= frames; i += 4) {
+        auto l = _mm_loadu_ps(left + i);
+        auto r = _mm_loadu_ps(right + i);
+        _mm_storeu_ps(destination + i * 2, _mm_unpacklo_ps(l, r));
+        _mm_storeu_ps(destination + i * 2 + 4, _mm_unpackhi_ps(l, r));
+      }
+#elif defined(WEB_AUDIO_VECTOR_MATH_NEON)
+      for (; i + 4 <= frames; i += 4) {
+        float32x4x2_t pair = {vld1q_f32(left + i), vld1q_f32(right + i)};
+        vst2q_f32(destination + i * 2, pair);
+      }
+#endif
+
+      for (; i < frames; ++i) {
+        destination[i * 2] = left[i];
+        destination[i * 2 + 1] = right[i];
+      }
+
+      return;
+    }
+
+    for (; i < frames; ++i) {
+      for (std::size_t ch = 0; ch < channels; ++ch) {
+        destination[i * channels + ch] = sources[ch][i];
+      }
+    }
+  }
+
+  /**
+   * Splits `frames` interleaved frames of `channels` samples into one array
+   * per channel.
+   */
+  static void deinterleave(const float *source, std::size_t channels,
+                           std::size_t frames, float *const *destinations) {
+    if (channels == 1) {
+      std::memcpy(destinations[0], source, frames * sizeof(float));
+      return;
+    }
+
+    std::size_t i = 0;
+
+    if (channels == 2) {
+      auto *left = destinations[0];
+      auto *right = destinations[1];
+
+#if defined(WEB_AUDIO_VECTOR_MATH_SSE)
+      for (; i + 4 <= frames; i += 4) {
+        auto a = _mm_loadu_ps(source + i * 2);
+        auto b = _mm_loadu_ps(source + i * 2 + 4);
+        _mm_storeu_ps(left + i, _mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0)));
+        _mm_storeu_ps(right + i,
+                      _mm_shuffle_ps(a, b, _MM_SHUFFLE(3, 1, 3, 1)));
+      }
+#elif defined(WEB_AUDIO_VECTOR_MATH_NEON)
+      for (; i + 4 <= frames; i += 4) {
+        auto pair = vld2q_f32(source + i * 2);
+        vst1q_f32(left + i, pair.val[0]);
+        vst1q_f32(right + i, pair.val[1]);
+      }
+#endif
+
+      for (; i < frames; ++i) {
+        left[i] = source[i * 2];
+        right[i] = source[i * 2 + 1];
+      }
+
+      return;
+    }
+
+    for (; i < frames; ++i) {
+      for (std::size_t ch = 0; ch < channels; ++ch) {
+        destinations[ch][i] = source[i * channels + ch];
+      }
+    }
+  }
+};
+} // namespace web_audio::detail
\ No newline at end of file
@@ -0,0 +1,51 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+#include "common.hh"
+
+namespace web_audio::detail {
+/**
+ * Ring of the most recent samples of a signal, written by one thread and
+ * read by any number of others. The writer never blocks; readers copy
+ * without locking and retry if the writer lapped them, like a seqlock.
+ */
+class SnapshotRing final {
+public:
+  /**
+   * `capacity` is rounded up to a power of two.
+   */
+  explicit SnapshotRing(std::size_t capacity);
+
+  std::size_t getCapacity() const;
+
+  /**
+   * Appends `frames` samples, or silence if `samples` is null. Must only be
+   * called from one thread at a time. Never blocks or allocates.
+   */
+  void write(const float *samples, std::size_t frames);
+
+  /**
+   * Number of samples written so far.
+   */
+  std::uint64_t getWritten() const;
+
+  /**
+   * Copies the `frames` most recent samples to `output`, oldest first, with
+   * silence before the first sample written. `frames` must not exceed half
+   * the capacity. Returns the number of samples written at the time of the
+   * snapshot.
+   */
+  std::uint64_t read(float *output, std::size_t frames) const;
+
+  WEB_AUDIO_PRIVATE : std::size_t capacity_;
+  std::unique_ptr<std::atomic<float>[]> samples_;
+  // Position up to which the writer may be overwriting samples.
+  std::atomic<std::uint64_t> claimed_{0};
+  // Position up to which samples are complete.
+  std::atomic<std::uint64_t> written_{0};
+};
+} // namespace web_audio::detail
\ No newline at end of file
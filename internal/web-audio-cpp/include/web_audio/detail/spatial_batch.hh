@@ -0,0 +1,132 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "../distance_model_type.hh"
+#include "common.hh"
+#include "vec3.hh"
+
+namespace web_audio::detail {
+/**
+ * The position and orthonormal axes of an AudioListener, derived once and
+ * shared by every source evaluated against it.
+ */
+struct ListenerBasis {
+  float positionX = 0;
+  float positionY = 0;
+  float positionZ = 0;
+  float rightX = 1;
+  float rightY = 0;
+  float rightZ = 0;
+  float forwardX = 0;
+  float forwardY = 0;
+  float forwardZ = -1;
+  float upX = 0;
+  float upY = 1;
+  float upZ = 0;
+
+  static ListenerBasis create(const Vec3 &position, const Vec3 &forward,
+                              const Vec3 &up);
+};
+
+/**
+ * Evaluates the PannerNode geometry of many sources against one listener.
+ * Sources are kept as a structure of arrays and every step of process() is a
+ * separate pass over all of them, so that the loops vectorize whether the
+ * batch holds the frames of one automated source or the sources of a scene.
+ */
+class SpatialBatch final {
+public:
+  SpatialBatch() = default;
+
+  /**
+   * Allocates `capacity` sources, at the origin, facing +x, with the
+   * PannerOptions defaults, and uses all of them.
+   */
+  explicit SpatialBatch(std::size_t capacity);
+
+  std::size_t getSize() const;
+
+  std::size_t getCapacity() const;
+
+  /**
+   * Uses the first `size` sources, at most the capacity. Does not allocate;
+   * sources keep the values they were last given.
+   */
+  void resize(std::size_t size);
+
+  void setPosition(std::size_t index, float x, float y, float z);
+
+  void setOrientation(std::size_t index, float x, float y, float z);
+
+  void setDistance(std::size_t index, DistanceModelType model,
+                   float refDistance, float maxDistance, float rolloffFactor);
+
+  void setCone(std::size_t index, float innerAngle, float outerAngle,
+               float outerGain);
+
+  /**
+   * Computes the azimuth, elevation and gain of every source.
+   */
+  void process(const ListenerBasis &listener);
+
+  /**
+   * Like process(), with an automated listener: `listeners[i]` is the
+   * listener of source i.
+   */
+  void process(const ListenerBasis *listeners);
+
+  /**
+   * Azimuths in degrees, as specified for PannerNode.
+   */
+  const float *getAzimuths() const;
+
+  /**
+   * Elevations in degrees, as specified for PannerNode.
+   */
+  const float *getElevations() const;
+
+  /**
+   * Products of the distance and cone gains.
+   */
+  const float *getGains() const;
+
+  WEB_AUDIO_PRIVATE : void process(const ListenerBasis *listeners,
+                                   std::size_t stride);
+
+  void computeDirections(const ListenerBasis *listeners, std::size_t stride);
+
+  void computeAngles(const ListenerBasis *listeners, std::size_t stride);
+
+  void computeDistanceGains();
+
+  void computeConeGains();
+
+  std::size_t size_ = 0;
+
+  std::vector<float> positionX_;
+  std::vector<float> positionY_;
+  std::vector<float> positionZ_;
+  std::vector<float> orientationX_;
+  std::vector<float> orientationY_;
+  std::vector<float> orientationZ_;
+  std::vector<DistanceModelType> distanceModel_;
+  std::vector<float> refDistance_;
+  std::vector<float> maxDistance_;
+  std::vector<float> rolloffFactor_;
+  std::vector<float> coneInnerAngle_;
+  std::vector<float> coneOuterAngle_;
+  std::vector<float> coneOuterGain_;
+
+  // Unit vector from the listener to each source, and its length.
+  std::vector<float> directionX_;
+  std::vector<float> directionY_;
+  std::vector<float> directionZ_;
+  std::vector<float> distance_;
+
+  std::vector<float> azimuth_;
+  std::vector<float> elevation_;
+  std::vector<float> gain_;
+};
+} // namespace web_audio::detail
\ No newline at end of file
@@ -4,14 +4,16 @@
 #include <vector>
 
 #include "common.hh"
+#include "resampler.hh"
 
 namespace web_audio::detail {
-class Upsampler {
+class Upsampler : public Resampler {
   WEB_AUDIO_PROTECTED : Upsampler(const std::vector<float> &filterCoefficients,
                                   std::size_t factor, std::size_t blockSize);
 
 public:
-  void process(const std::vector<float> &input, std::vector<float> &output);
+  void process(const std::vector<float> &input,
+               std::vector<float> &output) override;
 
   WEB_AUDIO_PROTECTED : std::size_t factor_;
   std::size_t filterSize_;
@@ -27,10 +29,14 @@ public:
 class Upsampler2x : public Upsampler {
 public:
   Upsampler2x(std::size_t blockSize);
+
+  static const std::vector<float> &getFilterCoefficients();
 };
 
 class Upsampler4x : public Upsampler {
 public:
   Upsampler4x(std::size_t blockSize);
+
+  static const std::vector<float> &getFilterCoefficients();
 };
 } // namespace web_audio::detail
\ No newline at end of file
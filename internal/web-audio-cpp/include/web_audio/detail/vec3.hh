@@ -7,6 +7,12 @@ class Vec3 {
 public:
   Vec3(float x, float y, float z);
 
+  float getX() const;
+
+  float getY() const;
+
+  float getZ() const;
+
   float dot(const Vec3 &v) const;
 
   Vec3 cross(const Vec3 &v) const;
@@ -0,0 +1,174 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+
+#if defined(__SSE__) || defined(_M_X64)
+#include <immintrin.h>
+#define WEB_AUDIO_VECTOR_MATH_SSE
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#define WEB_AUDIO_VECTOR_MATH_NEON
+#endif
+
+namespace web_audio::detail {
+/**
+ * Four float lanes mapped to the native vector register of the target.
+ */
+struct Float4 {
+#if defined(WEB_AUDIO_VECTOR_MATH_SSE)
+  __m128 value;
+
+  static Float4 load(const float *p) { return {_mm_loadu_ps(p)}; }
+
+  static Float4 broadcast(float x) { return {_mm_set1_ps(x)}; }
+
+  void store(float *p) const { _mm_storeu_ps(p, value); }
+
+  friend Float4 operator+(Float4 a, Float4 b) {
+    return {_mm_add_ps(a.value, b.value)};
+  }
+
+  friend Float4 operator-(Float4 a, Float4 b) {
+    return {_mm_sub_ps(a.value, b.value)};
+  }
+
+  friend Float4 operator*(Float4 a, Float4 b) {
+    return {_mm_mul_ps(a.value, b.value)};
+  }
+
+  friend Float4 max(Float4 a, Float4 b) {
+    return {_mm_max_ps(a.value, b.value)};
+  }
+
+  friend Float4 abs(Float4 a) {
+    return {_mm_andnot_ps(_mm_set1_ps(-0.0f), a.value)};
+  }
+
+  float reduceMax() const {
+    auto pairs = _mm_max_ps(value, _mm_movehl_ps(value, value));
+    return _mm_cvtss_f32(_mm_max_ss(pairs, _mm_shuffle_ps(pairs, pairs, 1)));
+  }
+#elif defined(WEB_AUDIO_VECTOR_MATH_NEON)
+  float32x4_t value;
+
+  static Float4 load(const float *p) { return {vld1q_f32(p)}; }
+
+  static Float4 broadcast(float x) { return {vdupq_n_f32(x)}; }
+
+  void store(float *p) const { vst1q_f32(p, value); }
+
+  friend Float4 operator+(Float4 a, Float4 b) {
+    return {vaddq_f32(a.value, b.value)};
+  }
+
+  friend Float4 operator-(Float4 a, Float4 b) {
+    return {vsubq_f32(a.value, b.value)};
+  }
+
+  friend Float4 operator*(Float4 a, Float4 b) {
+    return {vmulq_f32(a.value, b.value)};
+  }
+
+  friend Float4 max(Float4 a, Float4 b) {
+    return {vmaxq_f32(a.value, b.value)};
+  }
+
+  friend Float4 abs(Float4 a) { return {vabsq_f32(a.value)}; }
+
+  float reduceMax() const {
+    auto pair = vpmax_f32(vget_low_f32(value), vget_high_f32(value));
+    return vget_lane_f32(vpmax_f32(pair, pair), 0);
+  }
+#else
+  float value[4];
+
+  static Float4 load(const float *p) { return {{p[0], p[1], p[2], p[3]}}; }
+
+  static Float4 broadcast(float x) { return {{x, x, x, x}}; }
+
+  void store(float *p) const {
+    for (int i = 0; i < 4; ++i) {
+      p[i] = value[i];
+    }
+  }
+
+  friend Float4 operator+(Float4 a, Float4 b) {
+    return {{a.value[0] + b.value[0], a.value[1] + b.value[1],
+             a.value[2] + b.value[2], a.value[3] + b.value[3]}};
+  }
+
+  friend Float4 operator-(Float4 a, Float4 b) {
+    return {{a.value[0] - b.value[0], a.value[1] - b.value[1],
+             a.value[2] - b.value[2], a.value[3] - b.value[3]}};
+  }
+
+  friend Float4 operator*(Float4 a, Float4 b) {
+    return {{a.value[0] * b.value[0], a.value[1] * b.value[1],
+             a.value[2] * b.value[2], a.value[3] * b.value[3]}};
+  }
+
+  friend Float4 max(Float4 a, Float4 b) {
+    return {{std::max(a.value[0], b.value[0]), std::max(a.value[1], b.value[1]),
+             std::max(a.value[2], b.value[2]),
+             std::max(a.value[3], b.value[3])}};
+  }
+
+  friend Float4 abs(Float4 a) {
+    return {{std::fabs(a.value[0]), std::fabs(a.value[1]),
+             std::fabs(a.value[2]), std::fabs(a.value[3])}};
+  }
+
+  float reduceMax() const {
+    return std::max(std::max(value[0], value[1]), std::max(value[2], value[3]));
+  }
+#endif
+};
+
+/**
+ * Vectorized kernels over float arrays. Uses SSE on x86 and NEON on ARM, with a
+ * scalar fallback elsewhere.
+ */
+class VectorMath {
+public:
+  static float dot(const float *a, const float *b, std::size_t size) {
+    std::size_t i = 0;
+    float result = 0.0f;
+
+#if defined(WEB_AUDIO_VECTOR_MATH_SSE)
+    __m128 sum0 = _mm_setzero_ps();
+    __m128 sum1 = _mm_setzero_ps();
+
+    for (; i + 8 <= size; i += 8) {
+      sum0 = _mm_add_ps(sum0,
+                        _mm_mul_ps(_mm_loadu_ps(a + i), _mm_loadu_ps(b + i)));
+      sum1 = _mm_add_ps(
+          sum1, _mm_mul_ps(_mm_loadu_ps(a + i + 4), _mm_loadu_ps(b + i + 4)));
+    }
+
+    alignas(16) float lanes[4];
+    _mm_store_ps(lanes, _mm_add_ps(sum0, sum1));
+    result = (lanes[0] + lanes[1]) + (lanes[2] + lanes[3]);
+#elif defined(WEB_AUDIO_VECTOR_MATH_NEON)
+    float32x4_t sum0 = vdupq_n_f32(0.0f);
+    float32x4_t sum1 = vdupq_n_f32(0.0f);
+
+    for (; i + 8 <= size; i += 8) {
+      sum0 = vmlaq_f32(sum0, vld1q_f32(a + i), vld1q_f32(b + i));
+      sum1 = vmlaq_f32(sum1, vld1q_f32(a + i + 4), vld1q_f32(b + i + 4));
+    }
+
+    float32x4_t sum = vaddq_f32(sum0, sum1);
+    float32x2_t pair = vadd_f32(vget_low_f32(sum), vget_high_f32(sum));
+    result = vget_lane_f32(vpadd_f32(pair, pair), 0);
+#endif
+
+    for (; i < size; ++i) {
+      result += a[i] * b[i];
+    }
+
+    return result;
+  }
+};
+} // namespace web_audio::detail
\ No newline at end of file
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <span>
+
+#include "common.hh"
+
+namespace web_audio::detail {
+enum class WavSampleFormat {
+  eUint8,
+  eInt16,
+  eInt24,
+  eInt32,
+  eFloat32,
+  eFloat64,
+};
+
+/**
+ * Layout of the sample data of a RIFF/WAVE file.
+ */
+struct WavFormat {
+  WavSampleFormat sampleFormat;
+  std::uint32_t numberOfChannels;
+  std::uint32_t sampleRate;
+  std::uint32_t length;
+  std::size_t dataOffset;
+  std::size_t blockAlign;
+};
+
+/**
+ * Decoder for RIFF/WAVE files holding integer PCM (8, 16, 24 or 32 bits) or
+ * IEEE float (32 or 64 bits) samples, including WAVE_FORMAT_EXTENSIBLE.
+ */
+class WavDecoder final {
+public:
+  /**
+   * Throws std::invalid_argument if `data` is not a supported WAVE file.
+   */
+  static WavFormat parse(std::span<const std::uint8_t> data);
+
+  /**
+   * Reads only the chunk headers of `stream`, which must be seekable. The
+   * samples are left in the stream at WavFormat::dataOffset.
+   */
+  static WavFormat parse(std::istream &stream);
+
+  static std::size_t getSampleSize(WavSampleFormat sampleFormat);
+
+  /**
+   * Converts frames [startFrame, startFrame + frames) to float and writes
+   * channel `ch` to `destinations[ch]`. `scratch` must hold
+   * `frames * numberOfChannels` floats.
+   */
+  static void decode(const WavFormat &format,
+                     std::span<const std::uint8_t> data,
+                     std::uint32_t startFrame, std::uint32_t frames,
+                     float *const *destinations, float *scratch);
+};
+} // namespace web_audio::detail
\ No newline at end of file
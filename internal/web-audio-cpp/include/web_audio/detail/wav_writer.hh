@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+#include "common.hh"
+#include "wav_decoder.hh"
+
+namespace web_audio::detail {
+/**
+ * Writes a RIFF/WAVE file whose length is not known in advance. The chunk
+ * sizes are filled in by close(); a file that outgrows the 32-bit sizes of
+ * RIFF becomes RF64 (EBU Tech 3306), for which room is reserved in a JUNK
+ * chunk. Only 16-bit and 24-bit integer and 32-bit float samples are
+ * written.
+ */
+class WavWriter final {
+public:
+  /**
+   * Throws std::invalid_argument for an unsupported format and
+   * std::runtime_error if the file cannot be created.
+   */
+  WavWriter(const std::string &path, WavSampleFormat sampleFormat,
+            std::uint32_t numberOfChannels, std::uint32_t sampleRate);
+
+  /**
+   * Closes the file if close() was not called, ignoring errors.
+   */
+  ~WavWriter();
+
+  WavWriter(const WavWriter &) = delete;
+  WavWriter &operator=(const WavWriter &) = delete;
+
+  /**
+   * Appends `frames` frames, one array per channel. Throws
+   * std::runtime_error if the file cannot be written.
+   */
+  void write(const float *const *sources, std::uint32_t frames);
+
+  /**
+   * Fills in the chunk sizes and closes the file. Throws std::runtime_error
+   * if the file cannot be written.
+   */
+  void close();
+
+  /**
+   * Number of frames written so far.
+   */
+  std::uint64_t getLength() const;
+
+  WEB_AUDIO_PRIVATE : std::ofstream file_;
+  WavSampleFormat sampleFormat_;
+  std::uint32_t numberOfChannels_;
+  std::size_t blockAlign_;
+  std::size_t dataOffset_;
+  std::uint64_t length_ = 0;
+  bool closed_ = false;
+  std::vector<const float *> sources_;
+  std::vector<float> interleaved_;
+  std::vector<std::uint8_t> bytes_;
+};
+} // namespace web_audio::detail
\ No newline at end of file
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "common.hh"
+#include "resampler.hh"
+
+namespace web_audio::detail {
+/**
+ * Per-channel upsamplers and downsamplers of a WaveShaperNode for one
+ * oversampling factor. Built with all of its buffers on the control thread
+ * and handed to the rendering thread, which sends it back to be released
+ * once it is replaced.
+ */
+class WaveShaperOversampler final {
+public:
+  struct Channel {
+    std::unique_ptr<Resampler> upsampler;
+    std::unique_ptr<Resampler> downsampler;
+    std::vector<float> oversampled;
+  };
+
+  WaveShaperOversampler(ResamplerType type, std::size_t factor,
+                        std::size_t blockSize, std::uint32_t numberOfChannels);
+
+  std::size_t getFactor() const;
+
+  std::uint32_t getNumberOfChannels() const;
+
+  /**
+   * Adds channels beyond those the oversampler was built for. This
+   * allocates, so it is only a fallback for nodes that receive more
+   * channels than their channelCount.
+   */
+  void setNumberOfChannels(std::uint32_t numberOfChannels);
+
+  Channel &getChannel(std::uint32_t channel);
+
+  WEB_AUDIO_PRIVATE : Channel createChannel() const;
+
+  ResamplerType type_;
+  std::size_t factor_;
+  std::size_t blockSize_;
+  std::vector<Channel> channels_;
+};
+} // namespace web_audio::detail
\ No newline at end of file
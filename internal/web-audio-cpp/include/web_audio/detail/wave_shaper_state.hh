@@ -0,0 +1,28 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "common.hh"
+#include "wave_shaper_oversampler.hh"
+
+namespace web_audio::detail {
+/**
+ * An immutable curve, shared by the WaveShaperNodes using it.
+ */
+struct WaveShaperCurve {
+  std::vector<float> values;
+  // values[k + 1] - values[k] for each segment
+  std::vector<float> slopes;
+};
+
+/**
+ * What the rendering thread of a WaveShaperNode works with. Messages refer
+ * to it rather than to the node, so that a queued message never holds the
+ * last reference to the node.
+ */
+struct WaveShaperState {
+  std::shared_ptr<const WaveShaperCurve> curve;
+  std::shared_ptr<WaveShaperOversampler> oversampler;
+};
+} // namespace web_audio::detail
\ No newline at end of file
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "common.hh"
+#include "mpmc_queue.hh"
+
+namespace web_audio::detail {
+/**
+ * Unit of work executed by a WorkerPool.
+ */
+class WorkerTask {
+public:
+  virtual ~WorkerTask() = default;
+
+  virtual void run() = 0;
+};
+
+/**
+ * Fixed set of background threads consuming a bounded lock-free queue.
+ * submit() never blocks or allocates, so it may be called from the rendering
+ * thread.
+ */
+class WorkerPool final {
+public:
+  explicit WorkerPool(std::size_t threadCount = getDefaultThreadCount(),
+                      std::size_t capacity = 256);
+
+  ~WorkerPool();
+
+  WorkerPool(const WorkerPool &) = delete;
+  WorkerPool &operator=(const WorkerPool &) = delete;
+
+  /**
+   * Returns false if the queue is full. The caller is expected to run the
+   * task itself in that case.
+   */
+  bool submit(std::shared_ptr<WorkerTask> task);
+
+  std::size_t getThreadCount() const;
+
+  static std::size_t getDefaultThreadCount();
+
+  /**
+   * Process-wide pool for work without a deadline, such as converting mapped
+   * audio data, kept apart from the pools of contexts so that it never delays
+   * their convolvers' tail jobs.
+   */
+  static WorkerPool &getBackground();
+
+  WEB_AUDIO_PRIVATE : void workerLoop();
+
+  MpmcQueue<std::shared_ptr<WorkerTask>> queue_;
+  std::atomic<std::uint32_t> signal_{0};
+  std::atomic<bool> stopping_{false};
+  std::vector<std::thread> threads_;
+};
+} // namespace web_audio::detail
\ No newline at end of file
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include <vector>
+
+#include "audio_node.hh"
+#include "detail/compressor_kernel.hh"
+#include "dynamics_compressor_options.hh"
+
+namespace web_audio {
+/**
+ * Peak compressor with a lookahead of CompressorKernel::kLookahead. The
+ * parameters are k-rate, so the curve is evaluated once per quantum and the
+ * envelope once per sub-block.
+ */
+class DynamicsCompressorNode : public AudioNode {
+public:
+  // SPEC: constructor (BaseAudioContext context, optional
+  // DynamicsCompressorOptions options = {});
+  static std::shared_ptr<DynamicsCompressorNode>
+  create(std::shared_ptr<BaseAudioContext> context,
+         const DynamicsCompressorOptions &options = {});
+
+  // SPEC: readonly attribute AudioParam threshold;
+  std::shared_ptr<AudioParam> getThreshold() const;
+
+  // SPEC: readonly attribute AudioParam knee;
+  std::shared_ptr<AudioParam> getKnee() const;
+
+  // SPEC: readonly attribute AudioParam ratio;
+  std::shared_ptr<AudioParam> getRatio() const;
+
+  // SPEC: readonly attribute float reduction;
+  /**
+   * Written by the rendering thread once per quantum and read without
+   * locking.
+   */
+  float getReduction() const;
+
+  // SPEC: readonly attribute AudioParam attack;
+  std::shared_ptr<AudioParam> getAttack() const;
+
+  // SPEC: readonly attribute AudioParam release;
+  std::shared_ptr<AudioParam> getRelease() const;
+
+  void setChannelCount(std::uint32_t channelCount) override;
+
+  void setChannelCountMode(ChannelCountMode channelCountMode) override;
+
+  std::vector<std::shared_ptr<AudioParam>> getParams() const override;
+
+  void process(const std::vector<detail::RenderQuantum> &inputs,
+               std::vector<detail::RenderQuantum> &outputs,
+               const detail::ParamCollection &params) override;
+
+  bool processInPlace(detail::RenderQuantum &quantum,
+                      const detail::ParamCollection &params) override;
+
+  void resetState() override;
+
+  WEB_AUDIO_PRIVATE : explicit DynamicsCompressorNode(float sampleRate);
+
+  detail::CompressorParameters
+  getParameters(const detail::ParamCollection &params) const;
+
+  std::shared_ptr<AudioParam> threshold_;
+  std::shared_ptr<AudioParam> knee_;
+  std::shared_ptr<AudioParam> ratio_;
+  std::shared_ptr<AudioParam> attack_;
+  std::shared_ptr<AudioParam> release_;
+
+  detail::CompressorKernel kernel_;
+  std::atomic<float> reduction_{0.0f};
+};
+} // namespace web_audio
\ No newline at end of file
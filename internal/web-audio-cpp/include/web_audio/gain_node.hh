@@ -18,6 +18,9 @@ public:
                std::vector<detail::RenderQuantum> &outputs,
                const detail::ParamCollection &params) override;
 
+  bool processInPlace(detail::RenderQuantum &quantum,
+                      const detail::ParamCollection &params) override;
+
   std::vector<std::shared_ptr<AudioParam>> getParams() const override;
 
 private:
@@ -1,8 +1,10 @@
 #pragma once
 
 #include <complex>
+#include <memory>
 
 #include "audio_node.hh"
+#include "detail/iir_kernel.hh"
 #include "iir_filter_options.hh"
 
 namespace web_audio {
@@ -22,22 +24,18 @@ public:
                std::vector<detail::RenderQuantum> &outputs,
                const detail::ParamCollection &params) override;
 
-  WEB_AUDIO_PRIVATE : void transferTime(const std::vector<double> &a,
-                                        const std::vector<double> &b,
-                                        const std::vector<float> &x,
-                                        std::vector<double> &y);
+  void resetState() override;
 
-  void transferFrequency(const std::vector<double> &a,
-                         const std::vector<double> &b,
-                         const std::complex<double> &z,
-                         std::complex<double> &H);
+  WEB_AUDIO_PRIVATE : void transferFrequency(const std::vector<double> &a,
+                                             const std::vector<double> &b,
+                                             const std::complex<double> &z,
+                                             std::complex<double> &H);
 
   WEB_AUDIO_PRIVATE : std::vector<double> feedforward_;
   std::vector<double> feedback_;
 
-  // x[n], x[n-1], x[n-2], ...
-  std::vector<std::vector<float>> x_;
-  // y[n], y[n-1], y[n-2], ...
-  std::vector<std::vector<double>> y_;
+  std::unique_ptr<detail::IIRKernel> kernel_;
+  std::vector<const float *> inputChannels_;
+  std::vector<float *> outputChannels_;
 };
 } // namespace web_audio
\ No newline at end of file
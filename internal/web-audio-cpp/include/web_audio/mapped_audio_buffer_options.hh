@@ -0,0 +1,18 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+
+#include "mapped_sample_format.hh"
+
+namespace web_audio {
+struct MappedAudioBufferOptions {
+  std::uint32_t numberOfChannels = 1;
+  float sampleRate;
+  MappedSampleFormat format = MappedSampleFormat::eFloat32Planar;
+  // Position of the first sample in the file, e.g. past a header.
+  std::uint64_t byteOffset = 0;
+  // Frames per channel. Defaults to as many as the file holds.
+  std::optional<std::uint32_t> length;
+};
+} // namespace web_audio
\ No newline at end of file
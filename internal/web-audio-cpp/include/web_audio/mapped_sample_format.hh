@@ -0,0 +1,16 @@
+#pragma once
+
+namespace web_audio {
+/**
+ * Layout of the sample data in a file mapped by AudioBuffer::createMapped().
+ * Samples are little-endian.
+ */
+enum class MappedSampleFormat {
+  // One block of 32-bit floats per channel, read in place.
+  eFloat32Planar,
+  // Frames of 32-bit floats, converted to planar on first read.
+  eFloat32Interleaved,
+  // Frames of signed 16-bit integers, converted to planar on first read.
+  eInt16Interleaved,
+};
+}
\ No newline at end of file
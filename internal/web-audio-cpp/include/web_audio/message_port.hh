@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <utility>
+
+#include "audio_worklet_message.hh"
+#include "detail/common.hh"
+#include "detail/mpmc_queue.hh"
+
+namespace web_audio {
+/**
+ * One end of a channel between the control thread and the rendering thread.
+ * Both directions are bounded queues allocated when the ports are created,
+ * so posting and receiving never block or allocate and are safe on the
+ * rendering thread. There is no onmessage; messages are polled.
+ */
+class MessagePort {
+public:
+  static constexpr std::size_t kDefaultCapacity = 256;
+
+  /**
+   * Creates two entangled ports; each receives what the other posts.
+   */
+  static std::pair<std::shared_ptr<MessagePort>, std::shared_ptr<MessagePort>>
+  createPair(std::size_t capacity = kDefaultCapacity);
+
+  // SPEC: undefined postMessage(any message, sequence<object> transfer);
+  /**
+   * Returns false, dropping the message, if the queue toward the other port
+   * is full.
+   */
+  bool postMessage(const AudioWorkletMessage &message);
+
+  /**
+   * Returns the oldest message posted by the other port, if any.
+   */
+  std::optional<AudioWorkletMessage> receiveMessage();
+
+  WEB_AUDIO_PRIVATE : using Queue = detail::MpmcQueue<AudioWorkletMessage>;
+
+  MessagePort(std::shared_ptr<Queue> incoming, std::shared_ptr<Queue> outgoing);
+
+  std::shared_ptr<Queue> incoming_;
+  std::shared_ptr<Queue> outgoing_;
+};
+} // namespace web_audio
\ No newline at end of file
@@ -2,11 +2,14 @@
 
 #include <cstdint>
 #include <memory>
+#include <vector>
 
 #include "audio_buffer.hh"
+#include "audio_recording_options.hh"
 #include "base_audio_context.hh"
 #include "detail/common.hh"
 #include "detail/message_queue.hh"
+#include "detail/recording_stream.hh"
 #include "event_handler.hh"
 #include "offline_audio_context_options.hh"
 #include "promise.hh"
@@ -18,6 +21,15 @@ public:
   virtual ~OfflineAudioContext() = default;
 
   Promise<std::shared_ptr<AudioBuffer>> startRendering();
+
+  /**
+   * Renders like startRendering(), but hands the rendered frames to the
+   * callback or WAVE file of `options` as they are rendered instead of
+   * collecting them in an AudioBuffer, so that memory does not grow with
+   * the length. Rendering waits for the I/O thread when it falls behind.
+   * The promise is resolved once everything has been written.
+   */
+  Promise<void> startRendering(const AudioRecordingOptions &options);
   Promise<void> resume();
   Promise<void> suspend(double suspendTime);
   std::uint32_t getLength() const;
@@ -32,6 +44,16 @@ public:
 
   void process() override;
 
+  void copyRendered(const detail::RenderQuantum &rendered,
+                    std::uint64_t frame);
+
+  /**
+   * Hands the frames of `rendered` that are within the length to the
+   * recording.
+   */
+  void writeRecording(const detail::RenderQuantum &rendered,
+                      std::uint64_t frame);
+
   WEB_AUDIO_PRIVATE :
       // [[rendering started]]
       bool renderingStarted_ = false;
@@ -41,5 +63,9 @@ public:
   EventHandler *oncomplete_ = nullptr;
   std::shared_ptr<PromiseInternal<std::shared_ptr<AudioBuffer>>>
       renderingPromiseInternal_;
+  // Set instead of renderedBuffer_ when rendering to a recording.
+  std::unique_ptr<detail::RecordingStream> recordingStream_;
+  std::shared_ptr<PromiseInternal<void>> recordingPromiseInternal_;
+  std::vector<const float *> recordingSources_;
 };
 } // namespace web_audio
\ No newline at end of file
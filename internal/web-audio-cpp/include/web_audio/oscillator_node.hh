@@ -1,7 +1,9 @@
 #pragma once
 
 #include "audio_scheduled_source_node.hh"
+#include "detail/oscillator_kernel.hh"
 #include "oscillator_options.hh"
+#include "periodic_wave.hh"
 
 namespace web_audio {
 class OscillatorNode : public AudioScheduledSourceNode {
@@ -35,10 +37,32 @@ public:
 
   std::vector<std::shared_ptr<AudioParam>> getParams() const override;
 
-  WEB_AUDIO_PRIVATE : OscillatorType type_;
+  void resetState() override;
+
+  WEB_AUDIO_PRIVATE : void
+  processAutomated(const detail::ParamCollection &params, float sampleRate,
+                   float *output, std::uint32_t frames);
+
+  void render(float frequency, std::uint32_t increment, float *output,
+              std::uint32_t frames);
+
+  void render(float peakFrequency, const std::uint32_t *increments,
+              float *output, std::uint32_t frames);
+
+  /**
+   * Frames per wavetable selection while frequency or detune is automated.
+   */
+  static constexpr std::uint32_t kSubBlockSize = 16;
+
+  OscillatorType type_;
   std::shared_ptr<AudioParam> frequency_;
   std::shared_ptr<AudioParam> detune_;
   std::shared_ptr<PeriodicWave> periodicWave_;
-  float phase_ = 0;
+  /**
+   * The wave being played: periodicWave_ for "custom", otherwise a
+   * band-limited built-in wave.
+   */
+  std::shared_ptr<PeriodicWave> wave_;
+  detail::OscillatorKernel kernel_;
 };
-} // namespace web_audio
+} // namespace web_audio
\ No newline at end of file
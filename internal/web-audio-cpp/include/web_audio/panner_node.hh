@@ -0,0 +1,145 @@
+#pragma once
+
+#include <memory>
+#include <vector>
+
+#include "audio_node.hh"
+#include "detail/hrtf_filter_loader.hh"
+#include "detail/spatial_batch.hh"
+#include "panner_options.hh"
+
+namespace web_audio {
+class AudioListener;
+
+class PannerNode : public AudioNode {
+public:
+  // SPEC: constructor (BaseAudioContext context, optional PannerOptions
+  // options = {});
+  static std::shared_ptr<PannerNode>
+  create(std::shared_ptr<BaseAudioContext> context,
+         const PannerOptions &options = {});
+
+  // SPEC: attribute PanningModelType panningModel;
+  PanningModelType getPanningModel() const;
+
+  void setPanningModel(PanningModelType panningModel);
+
+  // SPEC: readonly attribute AudioParam positionX;
+  std::shared_ptr<AudioParam> getPositionX() const;
+
+  // SPEC: readonly attribute AudioParam positionY;
+  std::shared_ptr<AudioParam> getPositionY() const;
+
+  // SPEC: readonly attribute AudioParam positionZ;
+  std::shared_ptr<AudioParam> getPositionZ() const;
+
+  // SPEC: readonly attribute AudioParam orientationX;
+  std::shared_ptr<AudioParam> getOrientationX() const;
+
+  // SPEC: readonly attribute AudioParam orientationY;
+  std::shared_ptr<AudioParam> getOrientationY() const;
+
+  // SPEC: readonly attribute AudioParam orientationZ;
+  std::shared_ptr<AudioParam> getOrientationZ() const;
+
+  // SPEC: attribute DistanceModelType distanceModel;
+  DistanceModelType getDistanceModel() const;
+
+  void setDistanceModel(DistanceModelType distanceModel);
+
+  // SPEC: attribute double refDistance;
+  double getRefDistance() const;
+
+  void setRefDistance(double refDistance);
+
+  // SPEC: attribute double maxDistance;
+  double getMaxDistance() const;
+
+  void setMaxDistance(double maxDistance);
+
+  // SPEC: attribute double rolloffFactor;
+  double getRolloffFactor() const;
+
+  void setRolloffFactor(double rolloffFactor);
+
+  // SPEC: attribute double coneInnerAngle;
+  double getConeInnerAngle() const;
+
+  void setConeInnerAngle(double coneInnerAngle);
+
+  // SPEC: attribute double coneOuterAngle;
+  double getConeOuterAngle() const;
+
+  void setConeOuterAngle(double coneOuterAngle);
+
+  // SPEC: attribute double coneOuterGain;
+  double getConeOuterGain() const;
+
+  void setConeOuterGain(double coneOuterGain);
+
+  // SPEC: undefined setPosition (float x, float y, float z);
+  void setPosition(float x, float y, float z);
+
+  // SPEC: undefined setOrientation (float x, float y, float z);
+  void setOrientation(float x, float y, float z);
+
+  void setChannelCount(std::uint32_t channelCount) override;
+
+  void setChannelCountMode(ChannelCountMode channelCountMode) override;
+
+  std::vector<std::shared_ptr<AudioParam>> getParams() const override;
+
+  /**
+   * When the source and the listener are not automated within the quantum,
+   * the geometry is evaluated once; otherwise every frame is a source of one
+   * SpatialBatch pass. "HRTF" panning needs a dataset loaded with
+   * BaseAudioContext::loadHrtfDatabase() and uses equal-power panning
+   * without one. Filters for new directions are computed in the background;
+   * until one is ready, the previous filter is kept.
+   */
+  void process(const std::vector<detail::RenderQuantum> &inputs,
+               std::vector<detail::RenderQuantum> &outputs,
+               const detail::ParamCollection &params) override;
+
+  /**
+   * Maps an azimuth in degrees to the pan of the equal-power panning
+   * algorithm, in [-1, 1].
+   */
+  static float azimuthToPan(float azimuth);
+
+  WEB_AUDIO_PRIVATE : void fillBatch(const detail::ParamCollection &params,
+                                     std::size_t size);
+
+  void processHrtf(const detail::HrtfFilter &filter,
+                   const detail::RenderQuantum &input, float *left,
+                   float *right);
+
+  /**
+   * Computes the current azimuth and elevation from the values of the
+   * params, on the control thread.
+   */
+  void computeDirection(float &azimuth, float &elevation) const;
+
+  PanningModelType panningModel_;
+  DistanceModelType distanceModel_;
+  double refDistance_;
+  double maxDistance_;
+  double rolloffFactor_;
+  double coneInnerAngle_;
+  double coneOuterAngle_;
+  double coneOuterGain_;
+
+  std::shared_ptr<AudioParam> positionX_;
+  std::shared_ptr<AudioParam> positionY_;
+  std::shared_ptr<AudioParam> positionZ_;
+  std::shared_ptr<AudioParam> orientationX_;
+  std::shared_ptr<AudioParam> orientationY_;
+  std::shared_ptr<AudioParam> orientationZ_;
+
+  // Owned by the context, which outlives rendering.
+  AudioListener *listener_ = nullptr;
+  detail::SpatialBatch batch_;
+  std::vector<float> pan_;
+  std::unique_ptr<detail::HrtfFilterLoader> hrtfLoader_;
+};
+} // namespace web_audio
\ No newline at end of file
@@ -7,6 +7,7 @@
 #include "base_audio_context.hh"
 #include "detail/common.hh"
 #include "dom_exception.hh"
+#include "oscillator_type.hh"
 #include "periodic_wave_options.hh"
 
 namespace web_audio {
@@ -27,8 +28,28 @@ public:
   create(std::shared_ptr<BaseAudioContext> context,
          const PeriodicWaveOptions &options = {});
 
+  /**
+   * Samples the full-band table. Playback should use selectTables() instead.
+   */
   float getSample(float phase) const;
 
+  /**
+   * Two adjacent band-limited tables to crossfade between. Both tables are
+   * free of partials above Nyquist at the requested frequency. Each has
+   * getTableSize() + 1 samples, the last repeating the first.
+   */
+  struct TableSelection {
+    const float *table0;
+    const float *table1;
+    float weight;
+  };
+
+  TableSelection selectTables(float frequency) const;
+
+  std::size_t getTableSize() const;
+
+  std::size_t getNumberOfLevels() const;
+
   WEB_AUDIO_PRIVATE :
       // [[real]]
       std::vector<float>
@@ -38,9 +59,33 @@ public:
   // [[normalize]]
   bool normalize_;
 
-  std::vector<float> waveTable_;
+  float sampleRate_;
+  std::size_t tableSize_;
+  /**
+   * Mip levels stored back to back, each with a guard sample. Level k keeps
+   * levelPartials_[k] partials, dropping by a third of an octave per level.
+   */
+  std::vector<float> tables_;
+  std::vector<std::size_t> levelPartials_;
+
+  constexpr static std::size_t kRangesPerOctave = 3;
+
+  /**
+   * Returns the process-wide shared wave for a built-in oscillator type,
+   * building it on first use for each sample rate. Waves are immutable once
+   * built, so they can be shared across nodes and contexts.
+   */
+  static std::shared_ptr<PeriodicWave> getBuiltIn(float sampleRate,
+                                                  OscillatorType type);
+
+  static std::shared_ptr<PeriodicWave> createBuiltIn(float sampleRate,
+                                                     OscillatorType type);
+
+  static std::size_t computeTableSize(float sampleRate);
+
+  void buildTables();
 
-  constexpr static std::size_t kTableSize = 8192;
+  const float *getTable(std::size_t level) const;
 
   friend class OscillatorNode;
 };
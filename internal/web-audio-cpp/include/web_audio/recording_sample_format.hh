@@ -0,0 +1,12 @@
+#pragma once
+
+namespace web_audio {
+/**
+ * Sample format of a WAVE file written while rendering.
+ */
+enum class RecordingSampleFormat {
+  eFloat32,
+  eInt24,
+  eInt16,
+};
+} // namespace web_audio
\ No newline at end of file
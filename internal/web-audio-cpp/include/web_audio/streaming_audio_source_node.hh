@@ -0,0 +1,80 @@
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "audio_scheduled_source_node.hh"
+#include "detail/audio_file_stream.hh"
+#include "detail/common.hh"
+#include "streaming_audio_source_options.hh"
+
+namespace web_audio {
+/**
+ * Plays a WAVE file from disk while it is read, for tracks too long to keep
+ * in an AudioBuffer. Only bufferDuration seconds of audio are held in memory.
+ * Not part of the Web Audio API. The file must have the sample rate of the
+ * context.
+ */
+class StreamingAudioSourceNode : public AudioScheduledSourceNode {
+public:
+  static std::shared_ptr<StreamingAudioSourceNode>
+  create(std::shared_ptr<BaseAudioContext> context,
+         const StreamingAudioSourceOptions &options);
+
+  double getDuration() const;
+
+  std::uint32_t getNumberOfChannels() const;
+
+  bool getLoop() const;
+
+  void setLoop(bool loop);
+
+  double getLoopStart() const;
+
+  void setLoopStart(double loopStart);
+
+  double getLoopEnd() const;
+
+  void setLoopEnd(double loopEnd);
+
+  /**
+   * Starts playback at `when`, `offset` seconds into the file.
+   */
+  void start(double when = 0, double offset = 0);
+
+  /**
+   * Moves the playhead to the frame at `time` seconds into the file. The
+   * output is silent until the frames there have been read.
+   */
+  void seek(double time);
+
+  /**
+   * Blocks until the read-ahead buffer is full, so that playback started
+   * right after does not underrun.
+   */
+  void prime();
+
+  /**
+   * Number of render quanta that ran out of read-ahead data.
+   */
+  std::uint64_t getUnderrunCount() const;
+
+  void process(const std::vector<detail::RenderQuantum> &inputs,
+               std::vector<detail::RenderQuantum> &outputs,
+               const detail::ParamCollection &params) override;
+
+  WEB_AUDIO_PRIVATE : StreamingAudioSourceNode() = default;
+
+  std::uint32_t toFrame(double time) const;
+
+  void updateLoop();
+
+  std::unique_ptr<detail::AudioFileStream> stream_;
+  bool loop_ = false;
+  double loopStart_ = 0.0;
+  double loopEnd_ = 0.0;
+  double dt_;
+  std::vector<float *> destinations_;
+};
+} // namespace web_audio
\ No newline at end of file
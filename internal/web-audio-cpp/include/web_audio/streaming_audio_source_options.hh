@@ -0,0 +1,16 @@
+#pragma once
+
+#include <string>
+
+#include "audio_node_options.hh"
+
+namespace web_audio {
+struct StreamingAudioSourceOptions : public AudioNodeOptions {
+  std::string path;
+  bool loop = false;
+  double loopEnd = 0;
+  double loopStart = 0;
+  // Seconds of audio read ahead of playback.
+  double bufferDuration = 0.3;
+};
+} // namespace web_audio
\ No newline at end of file
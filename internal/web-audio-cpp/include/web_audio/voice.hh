@@ -0,0 +1,98 @@
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "audio_node.hh"
+#include "automation_rate.hh"
+#include "detail/audio_node_output.hh"
+#include "detail/common.hh"
+
+namespace web_audio::detail {
+class AudioGraph;
+} // namespace web_audio::detail
+
+namespace web_audio {
+class AudioParam;
+class VoicePool;
+
+/**
+ * The nodes of one instance of a VoicePool template. Connections among them
+ * are kept while the voice is pooled; connections to other nodes made after
+ * the voice was built are removed when it is released.
+ */
+class Voice {
+public:
+  /**
+   * The nodes in the order the VoiceBuilder returned them.
+   */
+  const std::vector<std::shared_ptr<AudioNode>> &getNodes() const;
+
+  /**
+   * Returns the node at `index`, or null if it is not a T.
+   */
+  template <typename T> std::shared_ptr<T> getNode(std::size_t index) const {
+    return std::dynamic_pointer_cast<T>(nodes_.at(index));
+  }
+
+  WEB_AUDIO_PRIVATE : struct ParamState {
+    std::shared_ptr<AudioParam> param;
+    float value;
+    AutomationRate automationRate;
+  };
+
+  struct Connection {
+    std::weak_ptr<AudioNode> source;
+    detail::AudioNodeOutput output;
+  };
+
+  /**
+   * Records the values of the params and the connections that cross the
+   * boundary of the voice, as the state every acquisition starts from.
+   */
+  explicit Voice(std::vector<std::shared_ptr<AudioNode>> nodes);
+
+  bool contains(const AudioNode *node) const;
+
+  /**
+   * Whether `output` of `source` connects a node of this voice to a node
+   * outside it, in either direction.
+   */
+  bool crosses(const AudioNode &source,
+               const detail::AudioNodeOutput &output) const;
+
+  /**
+   * The nodes of this voice and the nodes outside it that feed them or
+   * their params.
+   */
+  std::vector<std::shared_ptr<AudioNode>> getSources() const;
+
+  /**
+   * Adds the nodes to `graph` and restores the recorded connections.
+   */
+  void attach(detail::AudioGraph &graph);
+
+  /**
+   * Removes every connection that crosses the boundary and the nodes from
+   * `graph`, so that the voice is no longer rendered.
+   */
+  void detach(detail::AudioGraph &graph);
+
+  /**
+   * Restores the recorded param values, dropping all automation.
+   */
+  void resetParams();
+
+  /**
+   * Called on the rendering thread once the voice is out of the graph.
+   */
+  void resetState();
+
+  std::vector<std::shared_ptr<AudioNode>> nodes_;
+  std::vector<ParamState> params_;
+  std::vector<Connection> connections_;
+
+  friend class VoicePool;
+};
+} // namespace web_audio
\ No newline at end of file
@@ -0,0 +1,18 @@
+#pragma once
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+namespace web_audio {
+class AudioNode;
+class BaseAudioContext;
+
+/**
+ * Creates the nodes of one voice of a VoicePool, connected among themselves.
+ * Connections made here to nodes outside the voice belong to the template
+ * and are restored whenever the voice is acquired.
+ */
+using VoiceBuilder = std::function<std::vector<std::shared_ptr<AudioNode>>(
+    std::shared_ptr<BaseAudioContext> context)>;
+} // namespace web_audio
\ No newline at end of file
@@ -0,0 +1,87 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "detail/common.hh"
+#include "detail/mpmc_queue.hh"
+#include "voice.hh"
+#include "voice_builder.hh"
+#include "voice_pool_options.hh"
+
+namespace web_audio {
+class BaseAudioContext;
+
+/**
+ * Instantiates a subgraph from recycled nodes. A released voice leaves the
+ * graph, its params return to the values they had when it was built, and
+ * the rendering thread resets the state of its nodes before it can be
+ * acquired again. Nodes keep their settings and whatever immutable data
+ * they refer to, such as PeriodicWaves, curves and convolver kernels.
+ */
+class VoicePool : public std::enable_shared_from_this<VoicePool> {
+public:
+  /**
+   * Throws NotSupportedError if maxVoices is zero or less than
+   * initialVoices, or if `builder` returns no nodes.
+   */
+  static std::shared_ptr<VoicePool>
+  create(std::shared_ptr<BaseAudioContext> context, VoiceBuilder builder,
+         const VoicePoolOptions &options = {});
+
+  /**
+   * Returns a pooled voice, or builds one if none is free. Returns null if
+   * maxVoices voices are in use. The voice goes back to the pool when the
+   * last reference to it is dropped.
+   */
+  std::shared_ptr<Voice> acquire();
+
+  /**
+   * Waits until the rendering thread has recycled the voices released last,
+   * as their messages refer to the pool. Called on the control thread.
+   */
+  ~VoicePool();
+
+  /**
+   * Voices built so far.
+   */
+  std::size_t getVoiceCount() const;
+
+  /**
+   * Voices that acquire() can return without building one.
+   */
+  std::size_t getFreeVoiceCount() const;
+
+  WEB_AUDIO_PRIVATE : VoicePool(std::shared_ptr<BaseAudioContext> context,
+                                VoiceBuilder builder,
+                                std::uint32_t maxVoices);
+
+  Voice *build(std::shared_ptr<BaseAudioContext> context);
+
+  /**
+   * Takes the voice out of the graph. Called on the control thread.
+   */
+  void release(Voice *voice);
+
+  /**
+   * Called on the rendering thread once the nodes of the voice are no longer
+   * rendered.
+   */
+  void recycle(Voice *voice);
+
+  std::weak_ptr<BaseAudioContext> context_;
+  VoiceBuilder builder_;
+  std::uint32_t maxVoices_;
+  // Owned by the control thread.
+  std::vector<std::unique_ptr<Voice>> voices_;
+  detail::MpmcQueue<Voice *> freeVoices_;
+  std::atomic<std::size_t> freeVoiceCount_{0};
+  // Recycle messages the rendering thread has not handled yet.
+  std::atomic<std::size_t> pendingRecycles_{0};
+
+  friend class BaseAudioContext;
+};
+} // namespace web_audio
\ No newline at end of file
@@ -0,0 +1,12 @@
+#pragma once
+
+#include <cstdint>
+
+namespace web_audio {
+struct VoicePoolOptions {
+  // Voices built by VoicePool::create().
+  std::uint32_t initialVoices = 0;
+  // Voices that may exist at once, in use or pooled.
+  std::uint32_t maxVoices = 32;
+};
+} // namespace web_audio
\ No newline at end of file
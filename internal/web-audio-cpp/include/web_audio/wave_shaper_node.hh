@@ -5,8 +5,8 @@
 #include <vector>
 
 #include "audio_node.hh"
-#include "detail/downsampler.hh"
-#include "detail/upsampler.hh"
+#include "detail/resampler.hh"
+#include "detail/wave_shaper_state.hh"
 #include "wave_shaper_options.hh"
 
 namespace web_audio {
@@ -23,20 +23,69 @@ public:
 
   void setCurve(const std::optional<std::vector<float>> &curve);
 
+  /**
+   * Uses the curve of `source` without copying it, as the curve is
+   * immutable once set. Not part of the spec.
+   */
+  void shareCurve(const WaveShaperNode &source);
+
   // SPEC: attribute OverSampleType oversample;
   OverSampleType getOversample() const;
 
   void setOversample(OverSampleType oversample);
 
+  /**
+   * Selects the FIR implementation used for oversampling. Both have the same
+   * frequency response. Not part of the spec.
+   */
+  detail::ResamplerType getResamplerType() const;
+
+  void setResamplerType(detail::ResamplerType resamplerType);
+
+  void setChannelCount(std::uint32_t channelCount) override;
+
   void process(const std::vector<detail::RenderQuantum> &inputs,
                std::vector<detail::RenderQuantum> &outputs,
                const detail::ParamCollection &params) override;
 
+  /**
+   * Maps `size` samples through the curve in place, using the precomputed
+   * slope of each curve segment.
+   */
+  static void applyCurve(const std::vector<float> &curve,
+                         const std::vector<float> &slopes, float *data,
+                         std::size_t size);
+
   WEB_AUDIO_PRIVATE : WaveShaperNode() = default;
 
-  std::optional<std::vector<float>> curve_;
+  /**
+   * Builds the oversampler for the current settings, sized for channelCount
+   * channels, or returns null if oversampling is off.
+   */
+  std::shared_ptr<detail::WaveShaperOversampler> createOversampler() const;
+
+  /**
+   * Hands a new oversampler to the rendering thread with a control message.
+   */
+  void updateOversampler();
+
+  /**
+   * Throws InvalidStateError if `curve` has less than two values.
+   */
+  static std::shared_ptr<const detail::WaveShaperCurve>
+  createCurve(const std::optional<std::vector<float>> &curve);
+
+  /**
+   * Hands curve_ to the rendering thread with a control message.
+   */
+  void updateCurve();
+
+  // The control thread's copy of the curve the rendering thread uses.
+  std::shared_ptr<const detail::WaveShaperCurve> curve_;
   OverSampleType oversample_ = OverSampleType::eNone;
-  std::unique_ptr<detail::Upsampler> upsampler_;
-  std::unique_ptr<detail::Downsampler> downsampler_;
+  detail::ResamplerType resamplerType_ = detail::ResamplerType::ePolyphase;
+
+  // Rendering thread state.
+  std::shared_ptr<detail::WaveShaperState> state_;
 };
 } // namespace web_audio
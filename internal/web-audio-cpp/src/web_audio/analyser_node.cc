@@ -0,0 +1,267 @@
+#include "web_audio/analyser_node.hh"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <numbers>
+
+#include "web_audio/dom_exception.hh"
+
+namespace web_audio {
+namespace {
+std::uint8_t toByte(double value) {
+  return static_cast<std::uint8_t>(std::clamp(std::floor(value), 0.0, 255.0));
+}
+
+float toDecibels(float magnitude) {
+  return magnitude > 0 ? 20 * std::log10(magnitude)
+                       : -std::numeric_limits<float>::infinity();
+}
+} // namespace
+
+AnalyserNode::AnalyserNode() : ring_(2 * kMaxFFTSize) {}
+
+std::shared_ptr<AnalyserNode>
+AnalyserNode::create(std::shared_ptr<BaseAudioContext> context,
+                     const AnalyzerOptions &options) {
+  auto node = std::shared_ptr<AnalyserNode>(new AnalyserNode());
+  node->initialize(context);
+
+  node->numberOfInputs_ = 1;
+  node->numberOfOutputs_ = 1;
+  node->channelCount_ = options.channelCount.value_or(2);
+  node->channelCountMode_ =
+      options.channelCountMode.value_or(ChannelCountMode::eMax);
+  node->channelInterpretation_ =
+      options.channelInterpretation.value_or(ChannelInterpretation::eSpeakers);
+
+  // SPEC: If minDecibels is greater than or equal to maxDecibels, an
+  // IndexSizeError MUST be thrown.
+  if (options.minDecibels >= options.maxDecibels) {
+    throw DOMException(
+        "AnalyserNode: minDecibels must be less than maxDecibels",
+        "IndexSizeError");
+  }
+
+  node->minDecibels_ = options.minDecibels;
+  node->maxDecibels_ = options.maxDecibels;
+  node->setFftSize(options.fftSize);
+  node->setSmoothingTimeConstant(options.smoothingTimeConstant);
+
+  return node;
+}
+
+void AnalyserNode::getFloatFrequencyData(std::span<float> array) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  computeFrequencyData();
+
+  auto n = std::min<std::size_t>(array.size(), smoothed_.size());
+
+  for (std::size_t k = 0; k < n; ++k) {
+    array[k] = toDecibels(smoothed_[k]);
+  }
+}
+
+void AnalyserNode::getByteFrequencyData(std::span<std::uint8_t> array) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  computeFrequencyData();
+
+  auto n = std::min<std::size_t>(array.size(), smoothed_.size());
+  auto scale = 255 / (maxDecibels_ - minDecibels_);
+
+  for (std::size_t k = 0; k < n; ++k) {
+    // SPEC: b[k] = floor(255 / (dB_max - dB_min) * (Y[k] - dB_min))
+    array[k] = toByte(scale * (toDecibels(smoothed_[k]) - minDecibels_));
+  }
+}
+
+void AnalyserNode::getFloatTimeDomainData(std::span<float> array) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  ring_.read(timeDomain_.data(), fftSize_);
+
+  auto n = std::min<std::size_t>(array.size(), fftSize_);
+  std::copy(timeDomain_.begin(), timeDomain_.begin() + n, array.begin());
+}
+
+void AnalyserNode::getByteTimeDomainData(std::span<std::uint8_t> array) {
+  std::lock_guard<std::mutex> lock(mutex_);
+  ring_.read(timeDomain_.data(), fftSize_);
+
+  auto n = std::min<std::size_t>(array.size(), fftSize_);
+
+  for (std::size_t i = 0; i < n; ++i) {
+    // SPEC: b[k] = floor(128 * (1 + x[k]))
+    array[i] = toByte(128 * (1 + static_cast<double>(timeDomain_[i])));
+  }
+}
+
+std::uint32_t AnalyserNode::getFftSize() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return fftSize_;
+}
+
+void AnalyserNode::setFftSize(std::uint32_t fftSize) {
+  // SPEC: If the value of this attribute is set to a value other than a
+  // power of two in the range [32, 32768], an IndexSizeError exception MUST
+  // be thrown.
+  if (fftSize < kMinFFTSize || fftSize > kMaxFFTSize ||
+      (fftSize & (fftSize - 1)) != 0) {
+    throw DOMException(
+        "AnalyserNode: fftSize must be a power of two in [32, 32768]",
+        "IndexSizeError");
+  }
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  resize(fftSize);
+}
+
+std::uint32_t AnalyserNode::getFrequencyBinCount() const {
+  return getFftSize() / 2;
+}
+
+double AnalyserNode::getMinDecibels() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return minDecibels_;
+}
+
+void AnalyserNode::setMinDecibels(double minDecibels) {
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  // SPEC: If the value of this attribute is set to a value more than or equal
+  // to maxDecibels, an IndexSizeError exception MUST be thrown.
+  if (minDecibels >= maxDecibels_) {
+    throw DOMException(
+        "AnalyserNode: minDecibels must be less than maxDecibels",
+        "IndexSizeError");
+  }
+
+  minDecibels_ = minDecibels;
+}
+
+double AnalyserNode::getMaxDecibels() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return maxDecibels_;
+}
+
+void AnalyserNode::setMaxDecibels(double maxDecibels) {
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  // SPEC: If the value of this attribute is set to a value less than or equal
+  // to minDecibels, an IndexSizeError exception MUST be thrown.
+  if (maxDecibels <= minDecibels_) {
+    throw DOMException(
+        "AnalyserNode: maxDecibels must be greater than minDecibels",
+        "IndexSizeError");
+  }
+
+  maxDecibels_ = maxDecibels;
+}
+
+double AnalyserNode::getSmoothingTimeConstant() const {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return smoothingTimeConstant_;
+}
+
+void AnalyserNode::setSmoothingTimeConstant(double smoothingTimeConstant) {
+  // SPEC: If the value of this attribute is set to a value less than 0 or
+  // more than 1, an IndexSizeError exception MUST be thrown.
+  if (!(smoothingTimeConstant >= 0 && smoothingTimeConstant <= 1)) {
+    throw DOMException(
+        "AnalyserNode: smoothingTimeConstant must be in [0, 1]",
+        "IndexSizeError");
+  }
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  smoothingTimeConstant_ = smoothingTimeConstant;
+}
+
+void AnalyserNode::process(const std::vector<detail::RenderQuantum> &inputs,
+                           std::vector<detail::RenderQuantum> &outputs,
+                           const detail::ParamCollection &params) {
+  // SPEC: The audio stream will be passed un-processed from input to output.
+  outputs[0] = inputs[0];
+  processInPlace(outputs[0], params);
+}
+
+bool AnalyserNode::processInPlace(detail::RenderQuantum &quantum,
+                                  const detail::ParamCollection &params) {
+  const auto &input = quantum;
+  auto frames = input.getLength();
+
+  // Analysis works on the input down-mixed to mono.
+  auto channels = input.getNumberOfChannels();
+
+  if (channels == 0) {
+    ring_.write(nullptr, frames);
+  } else if (channels == 1) {
+    ring_.write(input[0].data(), frames);
+  } else if (channels == 2 &&
+             channelInterpretation_ == ChannelInterpretation::eSpeakers) {
+    mono_.resize(frames);
+
+    for (std::uint32_t i = 0; i < frames; ++i) {
+      mono_[i] = 0.5f * (input[0][i] + input[1][i]);
+    }
+
+    ring_.write(mono_.data(), frames);
+  } else {
+    auto mixed = input;
+    mixed.mix(1, channelInterpretation_);
+    ring_.write(mixed[0].data(), frames);
+  }
+
+  return true;
+}
+
+void AnalyserNode::computeFrequencyData() {
+  if (analyzedPosition_ == ring_.getWritten()) {
+    return;
+  }
+
+  analyzedPosition_ = ring_.read(timeDomain_.data(), fftSize_);
+
+  for (std::uint32_t i = 0; i < fftSize_; ++i) {
+    timeDomain_[i] *= window_[i];
+  }
+
+  fft_->forward(timeDomain_.data(), spectrum_.data());
+
+  auto tau = static_cast<float>(smoothingTimeConstant_);
+  auto scale = 1.0f / static_cast<float>(fftSize_);
+
+  for (std::size_t k = 0; k < smoothed_.size(); ++k) {
+    auto magnitude = std::abs(spectrum_[k]) * scale;
+    auto value = tau * smoothed_[k] + (1 - tau) * magnitude;
+    // SPEC: If X^[k] is NaN, positive infinity or negative infinity, set
+    // X^[k] = 0.
+    smoothed_[k] = std::isfinite(value) ? value : 0.0f;
+  }
+}
+
+void AnalyserNode::resize(std::uint32_t fftSize) {
+  if (fftSize == fftSize_) {
+    return;
+  }
+
+  fftSize_ = fftSize;
+  fft_.emplace(fftSize);
+  window_.resize(fftSize);
+  timeDomain_.resize(fftSize);
+  spectrum_.resize(fftSize / 2 + 1);
+  // Smoothing does not carry over to a different number of bins.
+  smoothed_.assign(fftSize / 2, 0.0f);
+  analyzedPosition_.reset();
+
+  // SPEC: Blackman window with alpha = 0.16.
+  constexpr double kAlpha = 0.16;
+  constexpr double kA0 = (1 - kAlpha) / 2;
+  constexpr double kA1 = 0.5;
+  constexpr double kA2 = kAlpha / 2;
+
+  for (std::uint32_t n = 0; n < fftSize; ++n) {
+    auto x = 2 * std::numbers::pi * n / fftSize;
+    window_[n] =
+        static_cast<float>(kA0 - kA1 * std::cos(x) + kA2 * std::cos(2 * x));
+  }
+}
+} // namespace web_audio
\ No newline at end of file
@@ -1,5 +1,7 @@
 #include "web_audio/audio_buffer.hh"
 
+#include <stdexcept>
+
 namespace web_audio {
 AudioBuffer::AudioBuffer() {}
 
@@ -15,32 +17,34 @@ std::uint32_t AudioBuffer::getNumberOfChannels() const {
   return numberOfChannels_;
 }
 
-std::vector<float> &AudioBuffer::getChannelData(std::uint32_t channel) & {
+const std::vector<float> &
+AudioBuffer::getChannelData(std::uint32_t channel) const & {
   if (channel >= numberOfChannels_) {
     throw DOMException("AudioBuffer: channel index out of range",
                        "IndexSizeError");
   }
 
-  return channelData_[channel];
+  materialize(channel);
+  return *channelData_[channel];
 }
 
-const std::vector<float> &
-AudioBuffer::getChannelData(std::uint32_t channel) const & {
+std::vector<float> &&AudioBuffer::getChannelData(std::uint32_t channel) && {
   if (channel >= numberOfChannels_) {
     throw DOMException("AudioBuffer: channel index out of range",
                        "IndexSizeError");
   }
 
-  return channelData_[channel];
+  return std::move(getWritableChannel(channel));
 }
 
-std::vector<float> &&AudioBuffer::getChannelData(std::uint32_t channel) && {
+std::vector<float> &
+AudioBuffer::getWritableChannelData(std::uint32_t channel) & {
   if (channel >= numberOfChannels_) {
     throw DOMException("AudioBuffer: channel index out of range",
                        "IndexSizeError");
   }
 
-  return std::move(channelData_[channel]);
+  return getWritableChannel(channel);
 }
 
 void AudioBuffer::copyFromChannel(std::vector<float> &destination,
@@ -55,10 +59,11 @@ void AudioBuffer::copyFromChannel(std::vector<float> &destination,
       std::max(0u, std::min(static_cast<std::uint32_t>(destination.size()),
                             length_ - bufferOffset));
 
-  auto srcBegin = channelData_[channelNumber].begin() + bufferOffset;
-  auto srcEnd = srcBegin + copyLength;
-  auto dstBegin = destination.begin();
-  std::copy(srcBegin, srcEnd, dstBegin);
+  const auto *source =
+      channelData_[channelNumber]
+          ? channelData_[channelNumber]->data()
+          : mapped_->acquire(channelNumber, bufferOffset, copyLength);
+  std::copy_n(source + bufferOffset, copyLength, destination.begin());
 }
 
 void AudioBuffer::copyToChannel(const std::vector<float> &source,
@@ -74,18 +79,75 @@ void AudioBuffer::copyToChannel(const std::vector<float> &source,
                             length_ - bufferOffset));
 
   std::copy_n(source.data(), copyLength,
-              channelData_[channelNumber].data() + bufferOffset);
+              getWritableChannel(channelNumber).data() + bufferOffset);
 }
 
 std::shared_ptr<AudioBuffer> AudioBuffer::copy() const {
-  auto newBuffer = AudioBuffer::create(
-      AudioBufferOptions{numberOfChannels_, length_, sampleRate_});
+  auto newBuffer = std::shared_ptr<AudioBuffer>(new AudioBuffer());
+  newBuffer->numberOfChannels_ = numberOfChannels_;
+  newBuffer->length_ = length_;
+  newBuffer->sampleRate_ = sampleRate_;
+  // Channels are shared until either buffer writes to them.
+  {
+    std::lock_guard<std::mutex> lock(materializeMutex_);
+    newBuffer->channelData_ = channelData_;
+  }
+  newBuffer->mapped_ = mapped_;
+  return newBuffer;
+}
 
-  for (std::uint32_t ch = 0; ch < numberOfChannels_; ++ch) {
-    newBuffer->channelData_[ch] = channelData_[ch];
+bool AudioBuffer::sharesChannelData(const AudioBuffer &other,
+                                    std::uint32_t channel) const {
+  if (channel >= numberOfChannels_ || channel >= other.numberOfChannels_) {
+    return false;
   }
 
-  return newBuffer;
+  if (channelData_[channel]) {
+    return channelData_[channel] == other.channelData_[channel];
+  }
+
+  return !other.channelData_[channel] && mapped_ == other.mapped_;
+}
+
+std::span<const float> AudioBuffer::acquireChannel(std::uint32_t channel,
+                                                   std::uint32_t startFrame,
+                                                   std::uint32_t frames) const {
+  if (channel >= numberOfChannels_) {
+    throw DOMException("AudioBuffer: channel index out of range",
+                       "IndexSizeError");
+  }
+
+  if (auto &data = channelData_[channel]) {
+    return *data;
+  }
+
+  if (const auto *samples = mapped_->tryAcquire(channel, startFrame, frames)) {
+    return {samples, length_};
+  }
+
+  return {};
+}
+
+void AudioBuffer::prefetch(std::uint32_t startFrame,
+                           std::uint32_t frames) const {
+  if (mapped_) {
+    mapped_->prefetch(startFrame, frames);
+  }
+}
+
+std::uint64_t AudioBuffer::getUnderrunCount() const {
+  return mapped_ ? mapped_->getUnderrunCount() : 0;
+}
+
+std::vector<float> &AudioBuffer::getWritableChannel(std::uint32_t channel) {
+  materialize(channel);
+  auto &data = channelData_[channel];
+
+  if (data.use_count() > 1) {
+    data = std::make_shared<std::vector<float>>(*data);
+  }
+
+  return *data;
 }
 
 std::shared_ptr<AudioBuffer>
@@ -113,9 +175,65 @@ AudioBuffer::create(const AudioBufferOptions &options) {
 
   buffer->channelData_.resize(buffer->numberOfChannels_);
   for (auto &channel : buffer->channelData_) {
-    channel.resize(buffer->length_, 0.0f);
+    channel = std::make_shared<std::vector<float>>(buffer->length_, 0.0f);
+  }
+
+  return buffer;
+}
+
+std::shared_ptr<AudioBuffer>
+AudioBuffer::createMapped(const std::string &path,
+                          const MappedAudioBufferOptions &options) {
+  if (options.numberOfChannels == 0) {
+    throw DOMException("AudioBuffer: numberOfChannels must be at least 1",
+                       "NotSupportedError");
+  }
+
+  if (options.sampleRate <= 0) {
+    throw DOMException("AudioBuffer: sampleRate must be greater than 0",
+                       "NotSupportedError");
+  }
+
+  auto buffer = std::shared_ptr<AudioBuffer>(new AudioBuffer());
+
+  try {
+    auto available = detail::MappedAudioData::getAvailableFrames(
+        path, options.format, options.numberOfChannels, options.byteOffset);
+    auto length = options.length.value_or(static_cast<std::uint32_t>(
+        std::min<std::uint64_t>(available, UINT32_MAX)));
+
+    if (length == 0) {
+      throw DOMException("AudioBuffer: length must be at least 1",
+                         "NotSupportedError");
+    }
+
+    buffer->mapped_ = std::make_shared<detail::MappedAudioData>(
+        path, options.format, options.numberOfChannels, options.byteOffset,
+        length);
+  } catch (const std::invalid_argument &e) {
+    throw DOMException(e.what(), "NotSupportedError");
+  } catch (const std::runtime_error &e) {
+    throw DOMException(e.what(), "NotReadableError");
   }
 
+  buffer->numberOfChannels_ = options.numberOfChannels;
+  buffer->length_ = buffer->mapped_->getLength();
+  buffer->sampleRate_ = options.sampleRate;
+  buffer->channelData_.resize(buffer->numberOfChannels_);
   return buffer;
 }
+
+void AudioBuffer::materialize(std::uint32_t channel) const {
+  if (!mapped_) {
+    return;
+  }
+
+  std::lock_guard<std::mutex> lock(materializeMutex_);
+  auto &data = channelData_[channel];
+
+  if (!data) {
+    const auto *samples = mapped_->acquire(channel, 0, length_);
+    data = std::make_shared<std::vector<float>>(samples, samples + length_);
+  }
+}
 } // namespace web_audio
\ No newline at end of file
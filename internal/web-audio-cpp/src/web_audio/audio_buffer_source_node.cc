@@ -1,6 +1,9 @@
 #include "web_audio/audio_buffer_source_node.hh"
 
+#include <algorithm>
 #include <cmath>
+#include <cstring>
+#include <span>
 
 #include "web_audio/audio_buffer.hh"
 #include "web_audio/audio_param.hh"
@@ -79,6 +82,21 @@ std::shared_ptr<AudioParam> AudioBufferSourceNode::getDetune() const {
   return detune_;
 }
 
+detail::InterpolationQuality
+AudioBufferSourceNode::getInterpolationQuality() const {
+  return interpolationQuality_;
+}
+
+void AudioBufferSourceNode::setInterpolationQuality(
+    detail::InterpolationQuality interpolationQuality) {
+  if (interpolationQuality == detail::InterpolationQuality::eSinc) {
+    // Build the shared kernel table here rather than on the rendering thread.
+    detail::BufferResampler::getSincTable();
+  }
+
+  interpolationQuality_ = interpolationQuality;
+}
+
 void AudioBufferSourceNode::setLoop(bool loop) { loop_ = loop; }
 
 bool AudioBufferSourceNode::getLoop() const { return loop_; }
@@ -123,7 +141,16 @@ void AudioBufferSourceNode::start(double when, double offset, double duration) {
   offset_ = offset;
   duration_ = duration;
 
-  bufferClone_ = buffer_->copy();
+  bufferClone_ = buffer_ ? buffer_->copy() : nullptr;
+
+  if (bufferClone_) {
+    // Let a mapped buffer start paging in the first second to be played.
+    auto sampleRate = bufferClone_->getSampleRate();
+    auto startFrame = std::min(offset * sampleRate,
+                               static_cast<double>(bufferClone_->getLength()));
+    bufferClone_->prefetch(static_cast<std::uint32_t>(startFrame),
+                           static_cast<std::uint32_t>(sampleRate));
+  }
 }
 
 float AudioBufferSourceNode::playbackSignal(std::uint32_t channel,
@@ -156,97 +183,212 @@ void AudioBufferSourceNode::process(
   //   }
 
   auto &output = outputs[0];
-  outputs[0] = detail::RenderQuantum(bufferClone_->getNumberOfChannels(),
-                                     output.getLength());
+  auto frames = output.getLength();
+
+  if (!bufferClone_) {
+    output.reset(1);
+    return;
+  }
 
-  auto context = getContext();
+  output.reset(bufferClone_->getNumberOfChannels());
 
-  auto currentTime = context->getCurrentTime();
+  auto currentTime = renderingContext_->getCurrentTime();
 
-  auto computedPlaybackRate =
-      params.getValue(playbackRate_, 0) *
-      std::pow(2, params.getValue(detune_, 0) / 1200.0f);
+  // Positions are in buffer frames; this many are advanced per output frame
+  // at a computed playback rate of 1.
+  auto bufferSampleRate = static_cast<double>(bufferClone_->getSampleRate());
+  auto frameRatio = bufferSampleRate * dt_;
+  auto length = static_cast<double>(bufferClone_->getLength());
 
-  double actualLoopStart, actualLoopEnd;
-  if (loop_ && bufferClone_) {
+  auto playbackRates = params.getValues(playbackRate_);
+  auto detunes = params.getValues(detune_);
+  auto computedPlaybackRateAt = [&](std::uint32_t frame) {
+    auto valueAt = [frame](std::span<const float> values) {
+      if (values.empty()) {
+        return 0.0f;
+      }
+
+      return frame < values.size() ? values[frame] : values.front();
+    };
+
+    return valueAt(playbackRates) * std::exp2(valueAt(detunes) / 1200.0f);
+  };
+
+  auto rateConstant =
+      params.isConstant(playbackRate_) && params.isConstant(detune_);
+  auto constantRate = computedPlaybackRateAt(0);
+
+  double actualLoopStart = 0.0;
+  double actualLoopEnd = 0.0;
+  if (loop_) {
     if (loopStart_ >= 0 && loopEnd_ > 0 && loopStart_ < loopEnd_) {
-      actualLoopStart = loopStart_;
-      actualLoopEnd = std::min(loopEnd_, bufferClone_->getDuration());
+      actualLoopStart = loopStart_ * bufferSampleRate;
+      actualLoopEnd =
+          std::min(loopEnd_, bufferClone_->getDuration()) * bufferSampleRate;
     } else {
       actualLoopStart = 0.0;
-      actualLoopEnd = bufferClone_->getDuration();
+      actualLoopEnd = length;
     }
   } else {
     enteredLoop_ = false;
   }
 
-  if (!bufferClone_) {
-    stop_ = currentTime;
-  }
+  // First pass: the buffer position of every frame that reads the buffer,
+  // grouped into segments that do not cross a loop wrap.
+  positions_.resize(frames);
+  segments_.clear();
+  std::uint32_t segmentBegin = 0;
+  bool inSegment = false;
+
+  auto endSegment = [&](std::uint32_t index) {
+    if (inSegment) {
+      segments_.push_back({segmentBegin, index});
+      inSegment = false;
+    }
+  };
 
-  for (std::uint32_t index = 0; index < output.getLength(); ++index) {
+  for (std::uint32_t index = 0; index < frames; ++index) {
     if (currentTime < start_ || currentTime >= stop_ ||
         bufferTimeElapsed_ >= duration_) {
-      for (std::uint32_t ch = 0; ch < output.getNumberOfChannels(); ++ch) {
-        output[ch][index] = 0.0f;
-      }
-
+      endSegment(index);
       currentTime += dt_;
       continue;
     }
 
+    auto computedPlaybackRate =
+        rateConstant ? constantRate : computedPlaybackRateAt(index);
+
     if (!started_) {
-      if (loop_ && computedPlaybackRate >= 0 && offset_ >= actualLoopEnd) {
-        offset_ = actualLoopEnd;
+      auto offset = offset_ * bufferSampleRate;
+
+      if (loop_ && computedPlaybackRate >= 0 && offset >= actualLoopEnd) {
+        offset = actualLoopEnd;
       }
 
-      if (loop_ && computedPlaybackRate < 0 && offset_ <= actualLoopStart) {
-        offset_ = actualLoopStart;
+      if (loop_ && computedPlaybackRate < 0 && offset <= actualLoopStart) {
+        offset = actualLoopStart;
       }
 
-      bufferTime_ = offset_;
+      bufferPosition_ = offset;
       started_ = true;
     }
 
     if (loop_) {
+      auto offset = offset_ * bufferSampleRate;
+
       if (!enteredLoop_) {
-        if (offset_ < actualLoopEnd && bufferTime_ >= actualLoopStart) {
+        if (offset < actualLoopEnd && bufferPosition_ >= actualLoopStart) {
           enteredLoop_ = true;
         }
 
-        if (offset_ >= actualLoopEnd && bufferTime_ < actualLoopEnd) {
+        if (offset >= actualLoopEnd && bufferPosition_ < actualLoopEnd) {
           enteredLoop_ = true;
         }
       }
 
       if (enteredLoop_) {
-        while (bufferTime_ >= actualLoopEnd) {
-          bufferTime_ -= actualLoopEnd - actualLoopStart;
+        auto wrapped = false;
+
+        while (bufferPosition_ >= actualLoopEnd) {
+          bufferPosition_ -= actualLoopEnd - actualLoopStart;
+          wrapped = true;
+        }
+
+        while (bufferPosition_ < actualLoopStart) {
+          bufferPosition_ += actualLoopEnd - actualLoopStart;
+          wrapped = true;
         }
 
-        while (bufferTime_ < actualLoopStart) {
-          bufferTime_ += actualLoopEnd - actualLoopStart;
+        if (wrapped) {
+          endSegment(index);
         }
       }
     }
 
-    if (bufferTime_ >= 0 && bufferTime_ < bufferClone_->getDuration()) {
-      for (std::uint32_t ch = 0; ch < output.getNumberOfChannels(); ++ch) {
-        output[ch][index] = playbackSignal(ch, bufferTime_);
+    if (bufferPosition_ >= 0 && bufferPosition_ < length) {
+      if (!inSegment) {
+        segmentBegin = index;
+        inSegment = true;
       }
+
+      positions_[index] = bufferPosition_;
     } else {
-      for (std::uint32_t ch = 0; ch < output.getNumberOfChannels(); ++ch) {
-        output[ch][index] = 0.0f;
-      }
+      endSegment(index);
     }
 
-    bufferTime_ += dt_ * computedPlaybackRate;
+    bufferPosition_ += computedPlaybackRate * frameRatio;
     bufferTimeElapsed_ += dt_;
     currentTime += dt_;
   }
 
-  if (currentTime >= stop_) {
-    // TODO:
+  endSegment(frames);
+
+  if (segments_.empty()) {
+    return;
+  }
+
+  // Second pass: read the segments channel by channel. At a rate of exactly
+  // one on whole frames, segments are plain copies.
+  auto unitRate = rateConstant && constantRate * frameRatio == 1.0;
+  detail::BufferResampler::LoopRegion loopRegion;
+
+  if (loop_) {
+    loopRegion.start = static_cast<std::size_t>(std::llround(actualLoopStart));
+    loopRegion.end = static_cast<std::size_t>(std::llround(actualLoopEnd));
+  }
+
+  auto halfWidth = static_cast<std::int64_t>(
+      detail::BufferResampler::getHalfWidth(interpolationQuality_));
+  auto bufferLength = static_cast<std::int64_t>(bufferClone_->getLength());
+
+  // Makes the frames the taps around [first, last] read available; only
+  // mapped interleaved buffers do any work here. Null if they are not
+  // converted in time, in which case the frames are left silent.
+  auto acquire = [&](std::uint32_t ch, double first, double last) {
+    auto begin = std::max<std::int64_t>(
+        static_cast<std::int64_t>(first) - halfWidth, 0);
+    auto end = std::min<std::int64_t>(
+        static_cast<std::int64_t>(last) + halfWidth + 1, bufferLength);
+    return bufferClone_
+        ->acquireChannel(ch, static_cast<std::uint32_t>(begin),
+                         static_cast<std::uint32_t>(end - begin))
+        .data();
+  };
+
+  for (std::uint32_t ch = 0; ch < output.getNumberOfChannels(); ++ch) {
+    auto *channel = output[ch].data();
+
+    if (loopRegion.end > loopRegion.start) {
+      auto loopStart = static_cast<double>(loopRegion.start);
+      auto loopEnd = static_cast<double>(loopRegion.end);
+
+      if (!acquire(ch, loopStart, loopStart + halfWidth) ||
+          !acquire(ch, loopEnd - halfWidth, loopEnd)) {
+        continue;
+      }
+    }
+
+    for (auto &segment : segments_) {
+      auto begin = segment.first;
+      auto count = segment.second - segment.first;
+      auto position = positions_[begin];
+      auto [lowest, highest] = std::minmax_element(
+          positions_.begin() + begin, positions_.begin() + segment.second);
+      const auto *data = acquire(ch, *lowest, *highest);
+
+      if (!data) {
+        continue;
+      }
+
+      if (unitRate && position == std::floor(position)) {
+        std::memcpy(channel + begin, data + static_cast<std::size_t>(position),
+                    count * sizeof(float));
+      } else {
+        detail::BufferResampler::process(
+            interpolationQuality_, data, bufferClone_->getLength(), loopRegion,
+            positions_.data() + begin, channel + begin, count);
+      }
+    }
   }
 }
 
@@ -254,4 +396,16 @@ std ::vector<std::shared_ptr<AudioParam>>
 AudioBufferSourceNode::getParams() const {
   return {playbackRate_, detune_};
 }
+
+void AudioBufferSourceNode::resetState() {
+  AudioScheduledSourceNode::resetState();
+  start_ = 0.0;
+  offset_ = 0.0;
+  duration_ = std::numeric_limits<double>::infinity();
+  stop_ = std::numeric_limits<double>::infinity();
+  bufferPosition_ = 0.0;
+  started_ = false;
+  enteredLoop_ = false;
+  bufferTimeElapsed_ = 0.0;
+}
 } // namespace web_audio
\ No newline at end of file
@@ -5,15 +5,15 @@ std::shared_ptr<AudioContext>
 AudioContext::create(const AudioContextOptions &contextOptions) {
   auto context = std::shared_ptr<AudioContext>(new AudioContext());
   auto channels = 2;
+  // Before initialize(), as nodes copy them on creation.
+  context->sampleRate_ = contextOptions.sampleRate.value_or(44100.0f);
+  context->renderQuantumSize_ = 128;
   context->initialize(channels);
   // SPEC: Set a [[control thread state]] to suspended on context.
   context->controlThreadState_ = AudioContextState::eSuspended;
   // SPEC: Set a [[rendering thread state]] to suspended on context.
   context->renderThreadState_ = AudioContextState::eSuspended;
 
-  context->sampleRate_ = contextOptions.sampleRate.value_or(44100.0f);
-  context->renderQuantumSize_ = 128;
-
 #ifdef WEB_AUDIO_BACKEND_SDL3
   SDL_AudioSpec spec;
   spec.format = SDL_AUDIO_F32;
@@ -49,7 +49,7 @@ AudioContext::create(const AudioContextOptions &contextOptions) {
 
   context->renderCapacity_ = std::make_shared<AudioRenderCapacity>();
   context->sinkId_ = std::string("");
-  context->controlMessageQueue_.push(detail::MessageBeginRendering{});
+  context->queueMessage(detail::MessageBeginRendering{});
   return context;
 }
 
@@ -2,6 +2,8 @@
 
 #include <stdexcept>
 
+#include "web_audio/audio_param.hh"
+
 namespace web_audio {
 std::shared_ptr<AudioListener>
 AudioListener::create(std::shared_ptr<BaseAudioContext> context) {
@@ -60,6 +62,22 @@ std::shared_ptr<AudioParam> &AudioListener::getUpZ() { return upZ; }
 
 const std::shared_ptr<AudioParam> &AudioListener::getUpZ() const { return upZ; }
 
+void AudioListener::setPosition(float x, float y, float z) {
+  positionX->setValue(x);
+  positionY->setValue(y);
+  positionZ->setValue(z);
+}
+
+void AudioListener::setOrientation(float x, float y, float z, float xUp,
+                                   float yUp, float zUp) {
+  forwardX->setValue(x);
+  forwardY->setValue(y);
+  forwardZ->setValue(z);
+  upX->setValue(xUp);
+  upY->setValue(yUp);
+  upZ->setValue(zUp);
+}
+
 std::shared_ptr<BaseAudioContext> AudioListener::getContext() const {
   if (auto context = context_.lock()) {
     return context;
@@ -40,6 +40,7 @@ AudioNode::connect(std::shared_ptr<AudioNode> destinationNode,
   outputs_.push_back(detail::AudioNodeOutput{output, destinationNode, input});
   destinationNode->inputs_.push_back(
       detail::AudioNodeInput{shared_from_this(), output, input});
+  markGraphChanged();
 
   return destinationNode;
 }
@@ -81,6 +82,7 @@ void AudioNode::connect(std::shared_ptr<AudioParam> destinationParam,
       detail::AudioNodeInput{shared_from_this(), output, 0});
   auto owner = destinationParam->getOwner();
   owner->inputsIndirect_.push_back(shared_from_this());
+  markGraphChanged();
 }
 
 void AudioNode::disconnect() {
@@ -295,9 +297,19 @@ void AudioNode::setChannelInterpretation(
   channelInterpretation_ = channelInterpretation;
 }
 
+bool AudioNode::processInPlace(detail::RenderQuantum &quantum,
+                               const detail::ParamCollection &params) {
+  return false;
+}
+
+void AudioNode::resetState() {}
+
 void AudioNode::initialize(std::shared_ptr<BaseAudioContext> context) {
   // SPEC: Set o’s associated BaseAudioContext to context.
   context_ = context;
+  renderingContext_ = context.get();
+  sampleRate_ = context->getSampleRate();
+  renderQuantumSize_ = context->getRenderQuantumSize();
 
   context->audioGraph_.addNode(shared_from_this());
 }
@@ -315,6 +327,7 @@ void AudioNode::disconnectInternal(std::size_t index) {
                                                       output.destinationIndex}),
                    inputs.end());
       outputs_.erase(outputs_.begin() + index);
+      markGraphChanged();
     }
   } else if (auto destParam =
                  std::get_if<std::weak_ptr<AudioParam>>(&output.destination)) {
@@ -335,11 +348,27 @@ void AudioNode::disconnectInternal(std::size_t index) {
                                       node, shared_from_this()) == 0;
                          }),
           inputsIndirect.end());
+      markGraphChanged();
     }
   }
 }
 
+void AudioNode::markGraphChanged() {
+  if (auto context = context_.lock()) {
+    context->audioGraph_.markChanged();
+    context->updateRenderOrder();
+  }
+}
+
 std::vector<std::shared_ptr<AudioParam>> AudioNode::getParams() const {
   return {};
 }
+
+const std::vector<std::shared_ptr<AudioParam>> &AudioNode::getRenderParams() {
+  if (!renderParams_) {
+    renderParams_ = getParams();
+  }
+
+  return *renderParams_;
+}
 } // namespace web_audio
\ No newline at end of file
@@ -14,6 +14,7 @@ std::shared_ptr<AudioParam> AudioParam::create(std::shared_ptr<AudioNode> owner,
   instance->currentValue_ = defaultValue;
 
   instance->owner_ = owner;
+  instance->sampleRate_ = owner->getContext()->getSampleRate();
   instance->defaultValue_ = defaultValue;
   instance->minValue_ = minValue;
   instance->maxValue_ = maxValue;
@@ -64,6 +65,18 @@ std::shared_ptr<AudioParam> AudioParam::setValueAtTime(float value,
   return shared_from_this();
 }
 
+void AudioParam::reset(float value, AutomationRate automationRate) {
+  currentValue_ = value;
+  automationRate_ = automationRate;
+  events_.clear();
+  eventIndex_ = 0;
+
+  // Without events the intrinsic value is the default value.
+  if (value != defaultValue_) {
+    events_.emplace(detail::ParamEventSetValue{eventIndex_++, value, 0.0});
+  }
+}
+
 std::shared_ptr<AudioParam>
 AudioParam::linearRampToValueAtTime(float value, double endTime) {
   if (endTime < 0 || std::isnan(endTime) || std::isinf(endTime)) {
@@ -321,9 +334,7 @@ float AudioParam::getStartValue(
 
 void AudioParam::computeIntrinsicValues(double startTime,
                                         std::vector<float> &outputs) {
-  auto context = getContext();
-  auto sampleRate = context->getSampleRate();
-  auto delta = 1.0 / sampleRate;
+  auto delta = 1.0 / sampleRate_;
   auto prevEvent = floorEvent(startTime);
   auto nextEvent = higherEvent(startTime);
 
@@ -389,6 +400,44 @@ void AudioParam::computeIntrinsicValues(double startTime,
   }
 }
 
+std::optional<float>
+AudioParam::computeConstantIntrinsicValue(double startTime,
+                                         std::size_t frames) {
+  auto delta = 1.0 / sampleRate_;
+  auto endTime = startTime + (frames - 1) * delta;
+  auto prevEvent = floorEvent(startTime);
+  auto nextEvent = higherEvent(startTime);
+
+  if (nextEvent != events_.end()) {
+    auto nextTime =
+        std::visit([](const auto &x) { return x.getTime(); }, *nextEvent);
+
+    // An event takes effect within the frames.
+    if (nextTime <= endTime) {
+      return std::nullopt;
+    }
+
+    // A ramp towards a later event is in progress.
+    if (prevEvent != events_.end() &&
+        (std::holds_alternative<detail::ParamEventLinearRamp>(*nextEvent) ||
+         std::holds_alternative<detail::ParamEventExponentialRamp>(
+             *nextEvent))) {
+      return std::nullopt;
+    }
+  }
+
+  if (prevEvent == events_.end()) {
+    return defaultValue_;
+  }
+
+  if (std::holds_alternative<detail::ParamEventSetTarget>(*prevEvent) ||
+      std::holds_alternative<detail::ParamEventSetValueCurve>(*prevEvent)) {
+    return std::nullopt;
+  }
+
+  return getEndValue(prevEvent);
+}
+
 std::shared_ptr<AudioNode> AudioParam::getOwner() const {
   if (auto sp = owner_.lock()) {
     return sp;
@@ -0,0 +1,129 @@
+#include "web_audio/audio_recorder_node.hh"
+
+#include <stdexcept>
+#include <thread>
+#include <utility>
+
+#include "web_audio/base_audio_context.hh"
+#include "web_audio/dom_exception.hh"
+
+namespace web_audio {
+std::shared_ptr<AudioRecorderNode>
+AudioRecorderNode::create(std::shared_ptr<BaseAudioContext> context,
+                          const AudioRecorderOptions &options) {
+  auto node = std::shared_ptr<AudioRecorderNode>(new AudioRecorderNode());
+  node->initialize(context);
+
+  node->numberOfInputs_ = 1;
+  node->numberOfOutputs_ = 1;
+  node->channelCount_ = options.channelCount.value_or(2);
+  node->channelCountMode_ =
+      options.channelCountMode.value_or(ChannelCountMode::eExplicit);
+  node->channelInterpretation_ =
+      options.channelInterpretation.value_or(ChannelInterpretation::eSpeakers);
+
+  if (node->channelCount_ == 0) {
+    throw DOMException("AudioRecorderNode: channelCount must be at least 1",
+                       "NotSupportedError");
+  }
+
+  if (node->channelCountMode_ != ChannelCountMode::eExplicit) {
+    throw DOMException(
+        "AudioRecorderNode: channelCountMode must be \"explicit\"",
+        "NotSupportedError");
+  }
+
+  try {
+    node->stream_ = detail::RecordingStream::create(
+        options.recording, node->channelCount_, context->getSampleRate());
+  } catch (const std::invalid_argument &e) {
+    throw DOMException(std::string("AudioRecorderNode: ") + e.what(),
+                       "NotSupportedError");
+  } catch (const std::runtime_error &e) {
+    throw DOMException(std::string("AudioRecorderNode: ") + e.what(),
+                       "NotAllowedError");
+  }
+
+  node->sources_.resize(node->channelCount_);
+
+  return node;
+}
+
+AudioRecorderNode::~AudioRecorderNode() noexcept {
+  // create() may have thrown before the stream was opened.
+  if (!stream_) {
+    return;
+  }
+
+  try {
+    stop();
+  } catch (...) {
+  }
+}
+
+void AudioRecorderNode::stop() {
+  recording_.store(false);
+
+  // Both flags are sequentially consistent, so the rendering thread either
+  // sees recording_ cleared or has set writing_ before this load.
+  while (writing_.load()) {
+    std::this_thread::yield();
+  }
+
+  stream_->close();
+}
+
+bool AudioRecorderNode::isRecording() const { return recording_.load(); }
+
+std::uint64_t AudioRecorderNode::getOverflowCount() const {
+  return stream_->getOverflowCount();
+}
+
+std::uint64_t AudioRecorderNode::getDroppedFrames() const {
+  return stream_->getDroppedFrames();
+}
+
+void AudioRecorderNode::setChannelCount(std::uint32_t channelCount) {
+  if (channelCount != channelCount_) {
+    throw DOMException("AudioRecorderNode: channelCount cannot be changed",
+                       "InvalidStateError");
+  }
+}
+
+void AudioRecorderNode::setChannelCountMode(
+    ChannelCountMode channelCountMode) {
+  if (channelCountMode != ChannelCountMode::eExplicit) {
+    throw DOMException(
+        "AudioRecorderNode: channelCountMode cannot be changed",
+        "InvalidStateError");
+  }
+}
+
+void AudioRecorderNode::process(
+    const std::vector<detail::RenderQuantum> &inputs,
+    std::vector<detail::RenderQuantum> &outputs,
+    const detail::ParamCollection &params) {
+  outputs[0] = inputs[0];
+  processInPlace(outputs[0], params);
+}
+
+bool AudioRecorderNode::processInPlace(detail::RenderQuantum &quantum,
+                                       const detail::ParamCollection &params) {
+  writing_.store(true);
+
+  if (recording_.load()) {
+    const auto &input = std::as_const(quantum);
+    // The count is explicit, so only a quantum without channels differs.
+    auto silent = input.getNumberOfChannels() != channelCount_;
+
+    for (std::uint32_t ch = 0; ch < channelCount_ && !silent; ++ch) {
+      sources_[ch] = input[ch].data();
+    }
+
+    stream_->write(silent ? nullptr : sources_.data(), input.getLength());
+  }
+
+  writing_.store(false);
+  return true;
+}
+} // namespace web_audio
\ No newline at end of file
@@ -69,7 +69,13 @@ void AudioScheduledSourceNode::stop(double when) {
 }
 
 bool AudioScheduledSourceNode::isPlaying() const {
-  auto currentTime = context_.lock()->getCurrentTime();
+  auto currentTime = renderingContext_->getCurrentTime();
   return sourceStarted_ && currentTime >= startTime_ && currentTime < stopTime_;
 }
+
+void AudioScheduledSourceNode::resetState() {
+  sourceStarted_ = false;
+  startTime_ = std::numeric_limits<double>::infinity();
+  stopTime_ = std::numeric_limits<double>::infinity();
+}
 } // namespace web_audio
\ No newline at end of file
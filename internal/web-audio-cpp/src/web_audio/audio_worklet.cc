@@ -0,0 +1,66 @@
+#include "web_audio/audio_worklet.hh"
+
+#include <stdexcept>
+#include <unordered_set>
+
+#include "web_audio/dom_exception.hh"
+
+namespace web_audio {
+void AudioWorklet::registerProcessor(
+    const std::string &name, AudioWorkletProcessorFactory factory,
+    std::vector<AudioParamDescriptor> parameterDescriptors) {
+  // SPEC: If name is an empty string, throw a NotSupportedError.
+  if (name.empty()) {
+    throw DOMException("AudioWorklet: name must not be empty",
+                       "NotSupportedError");
+  }
+
+  if (!factory) {
+    throw std::invalid_argument("AudioWorklet: factory must not be empty");
+  }
+
+  std::unordered_set<std::string> names;
+
+  for (auto &descriptor : parameterDescriptors) {
+    // SPEC: If paramNameSet contains paramName, throw a NotSupportedError.
+    if (!names.insert(descriptor.name).second) {
+      throw DOMException("AudioWorklet: duplicate parameter name \"" +
+                             descriptor.name + "\"",
+                         "NotSupportedError");
+    }
+
+    // SPEC: If the expression "min <= defaultValue <= max" is false, throw
+    // an InvalidStateError.
+    if (!(descriptor.minValue <= descriptor.defaultValue &&
+          descriptor.defaultValue <= descriptor.maxValue)) {
+      throw DOMException("AudioWorklet: defaultValue of \"" +
+                             descriptor.name + "\" is out of range",
+                         "InvalidStateError");
+    }
+  }
+
+  std::lock_guard lock(mutex_);
+
+  // SPEC: If name exists as a key in the node name to processor constructor
+  // map, throw a NotSupportedError.
+  if (definitions_.contains(name)) {
+    throw DOMException("AudioWorklet: \"" + name + "\" is already registered",
+                       "NotSupportedError");
+  }
+
+  definitions_.emplace(
+      name, Definition{std::move(factory), std::move(parameterDescriptors)});
+}
+
+std::optional<AudioWorklet::Definition>
+AudioWorklet::getDefinition(const std::string &name) const {
+  std::lock_guard lock(mutex_);
+  auto it = definitions_.find(name);
+
+  if (it == definitions_.end()) {
+    return std::nullopt;
+  }
+
+  return it->second;
+}
+} // namespace web_audio
\ No newline at end of file
@@ -0,0 +1,312 @@
+#include "web_audio/audio_worklet_node.hh"
+
+#include <algorithm>
+#include <cmath>
+
+#include "web_audio/audio_param.hh"
+#include "web_audio/base_audio_context.hh"
+#include "web_audio/dom_exception.hh"
+
+namespace web_audio {
+std::shared_ptr<AudioWorkletNode>
+AudioWorkletNode::create(std::shared_ptr<BaseAudioContext> context,
+                         const std::string &name,
+                         const AudioWorkletNodeOptions &options) {
+  // SPEC: If nodeName does not exist as a key in the BaseAudioContext's
+  // node name to parameter descriptor map, throw a InvalidStateError
+  // exception and abort these steps.
+  auto definition = context->getAudioWorklet()->getDefinition(name);
+
+  if (!definition) {
+    throw DOMException("AudioWorkletNode: \"" + name + "\" is not registered",
+                       "InvalidStateError");
+  }
+
+  // SPEC: If both numberOfInputs and numberOfOutputs are zero, throw a
+  // NotSupportedError and abort the remaining steps.
+  if (options.numberOfInputs == 0 && options.numberOfOutputs == 0) {
+    throw DOMException(
+        "AudioWorkletNode: numberOfInputs and numberOfOutputs are both zero",
+        "NotSupportedError");
+  }
+
+  // SPEC: If outputChannelCount is present, ...
+  if (!options.outputChannelCount.empty()) {
+    // SPEC: If any value in outputChannelCount is zero or greater than the
+    // implementation's maximum number of channels, throw a
+    // NotSupportedError and abort the remaining steps.
+    for (auto count : options.outputChannelCount) {
+      if (count == 0 || count > kMaxChannelCount) {
+        throw DOMException(
+            "AudioWorkletNode: outputChannelCount is out of range",
+            "NotSupportedError");
+      }
+    }
+
+    // SPEC: If the length of outputChannelCount does not equal
+    // numberOfOutputs, throw an IndexSizeError and abort the remaining
+    // steps.
+    if (options.outputChannelCount.size() != options.numberOfOutputs) {
+      throw DOMException("AudioWorkletNode: outputChannelCount does not "
+                         "match numberOfOutputs",
+                         "IndexSizeError");
+    }
+  }
+
+  auto node = std::shared_ptr<AudioWorkletNode>(new AudioWorkletNode());
+  node->initialize(context);
+
+  node->numberOfInputs_ = options.numberOfInputs;
+  node->numberOfOutputs_ = options.numberOfOutputs;
+  node->setChannelCount(options.channelCount.value_or(2));
+  node->channelCountMode_ =
+      options.channelCountMode.value_or(ChannelCountMode::eMax);
+  node->channelInterpretation_ =
+      options.channelInterpretation.value_or(ChannelInterpretation::eSpeakers);
+
+  // SPEC: If numberOfInputs and numberOfOutputs are both 1, set the initial
+  // channel count of the output to 1 and then dynamically change it to the
+  // computedNumberOfChannels for the input. Otherwise set the channel count
+  // of each output to 1.
+  if (!options.outputChannelCount.empty()) {
+    node->outputChannelCount_ = options.outputChannelCount;
+  } else if (options.numberOfInputs != 1 || options.numberOfOutputs != 1) {
+    node->outputChannelCount_.assign(options.numberOfOutputs, 1);
+  }
+
+  for (auto &descriptor : definition->parameterDescriptors) {
+    auto param = AudioParam::create(node, descriptor.defaultValue,
+                                    descriptor.minValue, descriptor.maxValue,
+                                    descriptor.automationRate, true);
+
+    // SPEC: If parameterData is present, ... set the AudioParam's value to
+    // the value of the key-value pair with the same name.
+    if (auto it = options.parameterData.find(descriptor.name);
+        it != options.parameterData.end()) {
+      param->setValue(static_cast<float>(it->second));
+    }
+
+    node->params_.push_back(param);
+    node->parameters_.emplace(descriptor.name, param);
+  }
+
+  node->processor_ = definition->factory(options);
+
+  if (!node->processor_) {
+    throw DOMException("AudioWorkletNode: the factory of \"" + name +
+                           "\" returned no processor",
+                       "InvalidStateError");
+  }
+
+  // SPEC: Let messageChannel be a new MessageChannel.
+  auto [nodePort, processorPort] = MessagePort::createPair();
+  node->port_ = std::move(nodePort);
+  node->processor_->port_ = std::move(processorPort);
+  node->inPlace_ = node->processor_->canProcessInPlace();
+  node->tailFrames_ = static_cast<std::uint64_t>(std::ceil(
+      std::max(node->processor_->getTailTime(), 0.0) *
+      context->getSampleRate()));
+
+  node->inputConnected_.resize(node->numberOfInputs_);
+  node->inputChannels_.resize(node->numberOfInputs_ * node->channelStride_);
+  node->outputChannels_.resize(node->numberOfOutputs_ *
+                               node->channelStride_);
+  node->inputViews_.resize(node->numberOfInputs_);
+  node->outputViews_.resize(node->numberOfOutputs_);
+  node->parameterViews_.resize(node->params_.size());
+  node->outputQuanta_.resize(
+      node->numberOfOutputs_,
+      detail::RenderQuantum(0, context->getRenderQuantumSize()));
+
+  return node;
+}
+
+const std::unordered_map<std::string, std::shared_ptr<AudioParam>> &
+AudioWorkletNode::getParameters() const {
+  return parameters_;
+}
+
+MessagePort &AudioWorkletNode::getPort() { return *port_; }
+
+std::vector<std::shared_ptr<AudioParam>> AudioWorkletNode::getParams() const {
+  return params_;
+}
+
+void AudioWorkletNode::process(
+    const std::vector<detail::RenderQuantum> &inputs,
+    std::vector<detail::RenderQuantum> &outputs,
+    const detail::ParamCollection &params) {
+  auto connected = updateConnections();
+  auto active = isActive(connected);
+
+  std::uint32_t maxChannels = 0;
+
+  for (std::uint32_t i = 0; i < numberOfInputs_; ++i) {
+    maxChannels = std::max(maxChannels, inputs[i].getNumberOfChannels());
+  }
+
+  for (auto count : outputChannelCount_) {
+    maxChannels = std::max(maxChannels, count);
+  }
+
+  reserveChannels(maxChannels);
+
+  for (std::uint32_t o = 0; o < numberOfOutputs_; ++o) {
+    std::uint32_t channels =
+        !outputChannelCount_.empty() ? outputChannelCount_[o]
+        : inputConnected_[0]
+            ? std::max<std::uint32_t>(inputs[0].getNumberOfChannels(), 1)
+            : 1;
+
+    if (!active) {
+      outputs[o].reset(channels);
+      continue;
+    }
+
+    // Output buffers are reused, so only the first quantum or a change in
+    // the channel count allocates.
+    auto &quantum = outputQuanta_[o];
+
+    if (quantum.getNumberOfChannels() != channels) {
+      quantum.reset(channels);
+    }
+
+    auto *views = outputChannels_.data() + o * channelStride_;
+
+    for (std::uint32_t c = 0; c < channels; ++c) {
+      auto &samples = quantum[c];
+      std::fill(samples.begin(), samples.end(), 0.0f);
+      views[c] = samples;
+    }
+
+    outputViews_[o] = {views, channels};
+  }
+
+  if (!active) {
+    return;
+  }
+
+  for (std::uint32_t i = 0; i < numberOfInputs_; ++i) {
+    std::uint32_t channels =
+        inputConnected_[i] ? inputs[i].getNumberOfChannels() : 0;
+    auto *views = inputChannels_.data() + i * channelStride_;
+
+    for (std::uint32_t c = 0; c < channels; ++c) {
+      views[c] = inputs[i][c];
+    }
+
+    inputViews_[i] = {views, channels};
+  }
+
+  setParameterViews(params);
+  callProcessor();
+
+  for (std::uint32_t o = 0; o < numberOfOutputs_; ++o) {
+    // The quanta keep their samples for the next quantum; downstream nodes
+    // share them.
+    if (failed_) {
+      outputs[o].reset(outputQuanta_[o].getNumberOfChannels());
+    } else {
+      outputs[o] = outputQuanta_[o];
+    }
+  }
+}
+
+bool AudioWorkletNode::processInPlace(detail::RenderQuantum &quantum,
+                                      const detail::ParamCollection &params) {
+  auto channels = quantum.getNumberOfChannels();
+
+  // An output with its own channel count, or one input without channels,
+  // needs a separate buffer.
+  if (!inPlace_ || !outputChannelCount_.empty() || failed_ ||
+      !updateConnections() || channels == 0) {
+    return false;
+  }
+
+  isActive(true);
+  reserveChannels(channels);
+
+  for (std::uint32_t c = 0; c < channels; ++c) {
+    auto &samples = quantum[c];
+    inputChannels_[c] = samples;
+    outputChannels_[c] = samples;
+  }
+
+  inputViews_[0] = {inputChannels_.data(), channels};
+  outputViews_[0] = {outputChannels_.data(), channels};
+
+  setParameterViews(params);
+  callProcessor();
+
+  if (failed_) {
+    quantum.reset(channels);
+  }
+
+  return true;
+}
+
+bool AudioWorkletNode::updateConnections() {
+  std::fill(inputConnected_.begin(), inputConnected_.end(), false);
+  auto connected = false;
+
+  for (auto &input : inputs_) {
+    if (!input.source.expired()) {
+      inputConnected_[input.destinationIndex] = true;
+      connected = true;
+    }
+  }
+
+  return connected;
+}
+
+bool AudioWorkletNode::isActive(bool connected) {
+  if (failed_) {
+    return false;
+  }
+
+  if (connected) {
+    framesWithoutInputs_ = 0;
+    return true;
+  }
+
+  // SPEC: active source flag
+  auto active = keepAlive_ || framesWithoutInputs_ < tailFrames_;
+  framesWithoutInputs_ += renderQuantumSize_;
+  return active;
+}
+
+void AudioWorkletNode::reserveChannels(std::uint32_t channels) {
+  if (channels <= channelStride_) {
+    return;
+  }
+
+  channelStride_ = channels;
+  inputChannels_.resize(numberOfInputs_ * channelStride_);
+  outputChannels_.resize(numberOfOutputs_ * channelStride_);
+}
+
+void AudioWorkletNode::setParameterViews(
+    const detail::ParamCollection &params) {
+  for (std::size_t i = 0; i < params_.size(); ++i) {
+    auto values = params.getValues(params_[i]);
+
+    // SPEC: If the value is constant over the render quantum, the array
+    // has a length of 1.
+    parameterViews_[i] =
+        params.isConstant(params_[i])
+            ? values.first(std::min<std::size_t>(values.size(), 1))
+            : values;
+  }
+}
+
+void AudioWorkletNode::callProcessor() {
+  try {
+    keepAlive_ =
+        processor_->process(inputViews_, outputViews_, parameterViews_);
+  } catch (...) {
+    // SPEC: If process() throws, ... the processor will output silence for
+    // the rest of its lifetime.
+    failed_ = true;
+  }
+}
+} // namespace web_audio
\ No newline at end of file
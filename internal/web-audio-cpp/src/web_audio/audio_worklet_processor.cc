@@ -0,0 +1,9 @@
+#include "web_audio/audio_worklet_processor.hh"
+
+namespace web_audio {
+MessagePort &AudioWorkletProcessor::getPort() { return *port_; }
+
+bool AudioWorkletProcessor::canProcessInPlace() const { return false; }
+
+double AudioWorkletProcessor::getTailTime() const { return 0; }
+} // namespace web_audio
\ No newline at end of file
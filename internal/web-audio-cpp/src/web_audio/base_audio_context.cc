@@ -1,20 +1,33 @@
 #include "web_audio/base_audio_context.hh"
 
-#include <unordered_map>
+#include <algorithm>
 
+#include "web_audio/audio_buffer.hh"
 #include "web_audio/audio_param.hh"
 #include "web_audio/audio_scheduled_source_node.hh"
+#include "web_audio/detail/audio_decoder.hh"
+#include "web_audio/detail/realtime_checker.hh"
 #include "web_audio/offline_audio_context.hh"
+#include "web_audio/voice_pool.hh"
+#include "web_audio/detail/wave_shaper_state.hh"
 
 namespace web_audio {
 BaseAudioContext::BaseAudioContext() {}
 
 BaseAudioContext::~BaseAudioContext() {
+  for (auto &decoding : decodingThreads_) {
+    decoding.thread.join();
+  }
+
   controlMessageQueue_.push(detail::MessageTerminate());
 
   if (renderingThread_ && renderingThread_->joinable()) {
     renderingThread_->join();
   }
+
+  // While the members the nodes may use are still alive.
+  renderOrder_.reset();
+  releaseRetired();
 }
 
 std::shared_ptr<AudioDestinationNode> BaseAudioContext::getDestination() {
@@ -49,20 +62,130 @@ void BaseAudioContext::setOnstatechange(EventHandler *value) {
   onstatechange_ = value;
 }
 
-void BaseAudioContext::processEvents() { eventQueue_.poll(); }
+Promise<std::shared_ptr<AudioBuffer>>
+BaseAudioContext::decodeAudioData(std::vector<std::uint8_t> audioData,
+                                  DecodeSuccessCallback successCallback,
+                                  DecodeErrorCallback errorCallback) {
+  // SPEC: Let promise be a new Promise.
+  Promise<std::shared_ptr<AudioBuffer>> promise(eventQueue_);
+  auto internal = promise.getInternal();
+
+  std::lock_guard lock(decodingThreadsMutex_);
+  std::erase_if(decodingThreads_, [](DecodingThread &decoding) {
+    if (!decoding.finished->load(std::memory_order_acquire)) {
+      return false;
+    }
+
+    decoding.thread.join();
+    return true;
+  });
+
+  // SPEC: Detach the audioData ArrayBuffer.
+  // SPEC: Queue a decoding operation to be performed on another thread.
+  auto finished = std::make_shared<std::atomic<bool>>(false);
+  std::thread thread([this, data = std::move(audioData), internal,
+                      successCallback = std::move(successCallback),
+                      errorCallback = std::move(errorCallback), finished] {
+    // SPEC: Attempt to decode the encoded audioData into linear PCM. ...
+    // Resample it to the sample-rate of the BaseAudioContext if it is
+    // different from the sample-rate of audioData.
+    std::shared_ptr<AudioBuffer> buffer;
+
+    try {
+      buffer = detail::AudioDecoder::decode(data, sampleRate_,
+                                            *getDecodingWorkerPool());
+    } catch (const std::exception &e) {
+      // SPEC: Let error be a DOMException whose name is EncodingError.
+      DOMException error(std::string("decodeAudioData: ") + e.what(),
+                         "EncodingError");
+
+      // SPEC: If errorCallback is not missing, invoke errorCallback with
+      // error.
+      if (errorCallback) {
+        eventQueue_.push([errorCallback, error] { errorCallback(error); });
+      }
+
+      // SPEC: Reject promise with error.
+      internal->reject(std::make_exception_ptr(error));
+      finished->store(true, std::memory_order_release);
+      return;
+    }
+
+    // SPEC: If successCallback is not missing, invoke successCallback with
+    // buffer.
+    if (successCallback) {
+      eventQueue_.push([successCallback, buffer] { successCallback(buffer); });
+    }
+
+    // SPEC: Resolve promise with buffer.
+    internal->resolve(buffer);
+    finished->store(true, std::memory_order_release);
+  });
+  decodingThreads_.push_back({std::move(thread), std::move(finished)});
+
+  return promise;
+}
+
+void BaseAudioContext::processEvents() {
+  updateRenderOrder();
+  eventQueue_.poll();
+}
+
+std::shared_ptr<detail::WorkerPool> BaseAudioContext::getWorkerPool() {
+  std::call_once(workerPoolOnce_, [this] {
+    workerPool_ = std::make_shared<detail::WorkerPool>();
+  });
+  return workerPool_;
+}
+
+std::shared_ptr<detail::WorkerPool>
+BaseAudioContext::getDecodingWorkerPool() {
+  std::call_once(decodingWorkerPoolOnce_, [this] {
+    decodingWorkerPool_ = std::make_shared<detail::WorkerPool>();
+  });
+  return decodingWorkerPool_;
+}
+
+detail::ImpulseResponseCache &BaseAudioContext::getImpulseResponseCache() {
+  return impulseResponseCache_;
+}
+
+void BaseAudioContext::loadHrtfDatabase(const std::string &path) {
+  try {
+    hrtfDatabase_.store(detail::HrtfDatabase::load(path, getSampleRate()));
+    hrtfDatabaseGeneration_.fetch_add(1, std::memory_order_release);
+  } catch (const std::invalid_argument &e) {
+    throw DOMException(std::string("BaseAudioContext: ") + e.what(),
+                       "NotSupportedError");
+  } catch (const std::runtime_error &e) {
+    throw DOMException(std::string("BaseAudioContext: ") + e.what(),
+                       "NotReadableError");
+  }
+}
+
+std::shared_ptr<detail::HrtfDatabase>
+BaseAudioContext::getHrtfDatabase() const {
+  return hrtfDatabase_.load();
+}
+
+std::uint32_t BaseAudioContext::getHrtfDatabaseGeneration() const {
+  return hrtfDatabaseGeneration_.load(std::memory_order_acquire);
+}
 
 void BaseAudioContext::initialize(std::uint32_t numberOfChannels) {
   audioWorklet_.reset(new AudioWorklet());
   // TODO
 
   audioGraph_.initialize(shared_from_this(), numberOfChannels);
+  renderOrder_ = audioGraph_.createRenderOrder();
+  renderOrderVersion_ = renderOrder_->version;
   renderingThread_ =
       std::make_unique<std::thread>(&BaseAudioContext::run, this);
 }
 
 detail::AudioGraph *BaseAudioContext::getAudioGraph() { return &audioGraph_; }
 
-std::optional<detail::RenderQuantum> BaseAudioContext::render() {
+const detail::RenderQuantum *BaseAudioContext::render() {
   // SPEC: Process the control message queue.
 
   // SPEC: Process the BaseAudioContext's associated task queue.
@@ -70,55 +193,75 @@ std::optional<detail::RenderQuantum> BaseAudioContext::render() {
   // SPEC: If the [[rendering thread state]] of the BaseAudioContext is not
   // running, return false.
   if (renderThreadState_ != AudioContextState::eRunning) {
-    return std::nullopt;
+    return nullptr;
   }
 
+  detail::SampleBufferPool::Scope bufferPoolScope(sampleBufferPool_);
+  detail::RealtimeChecker::RenderScope renderScope(currentFrame_.load());
+
   // SPEC: Order the AudioNodes of the BaseAudioContext to be processed.
-  auto orderedNodes = audioGraph_.orderNodes();
-  std::unordered_map<std::shared_ptr<AudioNode>,
-                     std::vector<detail::RenderQuantum>>
-      nodeResults;
-  std::unordered_map<std::shared_ptr<AudioParam>, detail::RenderQuantum>
-      paramResults;
+  // The control thread orders them whenever the graph changes; see
+  // updateRenderOrder().
+  auto &order = *renderOrder_;
   auto currentTime = currentTime_.load();
 
-  for (auto &node : orderedNodes) {
-    auto params = node->getParams();
+  // The results of the previous quantum give their samples back to the pool.
+  for (auto &entry : order.nodes) {
+    entry.pendingReads = entry.reads;
 
-    detail::ParamCollection paramCollection;
+    for (auto &result : entry.results) {
+      result.reset(0);
+    }
+  }
 
-    for (auto &param : params) {
-      detail::RenderQuantum paramOutput(1, renderQuantumSize_);
+  for (auto &entry : order.nodes) {
+    auto *node = entry.node.get();
 
-      for (auto &input : param->inputs_) {
-        if (auto srcNode = input.source.lock()) {
-          if (nodeResults.find(srcNode) != nodeResults.end()) {
-            // discrete?
-            paramOutput.add(nodeResults[srcNode][input.sourceIndex],
-                            ChannelInterpretation::eDiscrete);
-          }
-        }
+    for (auto &param : entry.params) {
+      auto &paramOutput = param.values;
+      paramOutput.reset(1);
+
+      // The intrinsic value stays a scalar unless it is automated within
+      // the quantum.
+      if (auto value = param.param->computeConstantIntrinsicValue(
+              currentTime, renderQuantumSize_)) {
+        paramOutput.setConstant(0, *value);
+      } else {
+        param.param->computeIntrinsicValues(currentTime, paramOutput[0]);
       }
 
-      param->computeIntrinsicValues(currentTime, paramOutput[0]);
+      // SPEC: computedValue is the sum of the intrinsic value and the value
+      // of the input AudioParam buffer.
+      for (auto &input : param.connections) {
+        auto &source = order.nodes[input.source];
+        --source.pendingReads[input.sourceIndex];
+        // discrete?
+        paramOutput.add(source.results[input.sourceIndex],
+                        ChannelInterpretation::eDiscrete);
+      }
 
       // SPEC: Queue a control message to set the [[current value]] slot of this
-      // AudioParam according to § 1.6.3 Computation of Value.
+      // AudioParam according to § 1.6.3 Computation of Value.
       // TODO
 
-      paramCollection.setValues(param, paramOutput[0]);
+      if (paramOutput.isConstant(0)) {
+        entry.paramValues.setValue(param.param, paramOutput.getConstant(0),
+                                   renderQuantumSize_);
+      } else {
+        entry.paramValues.setValues(param.param, paramOutput[0]);
+      }
+
+      // The values were copied, so the samples go back to the pool.
+      paramOutput.reset(0);
     }
 
     std::uint32_t inputChannelsMax = 0;
 
-    for (auto &inputNode : node->inputs_) {
-      if (auto srcNode = inputNode.source.lock()) {
-        if (nodeResults.find(srcNode) != nodeResults.end()) {
-          inputChannelsMax = std::max(
-              inputChannelsMax, nodeResults[srcNode][inputNode.sourceIndex]
-                                    .getNumberOfChannels());
-        }
-      }
+    for (auto &input : entry.connections) {
+      inputChannelsMax = std::max(inputChannelsMax,
+                                  order.nodes[input.source]
+                                      .results[input.sourceIndex]
+                                      .getNumberOfChannels());
     }
 
     auto computedNumberOfChannels =
@@ -127,37 +270,94 @@ std::optional<detail::RenderQuantum> BaseAudioContext::render() {
             ? std::min(node->channelCount_, inputChannelsMax)
             : node->channelCount_;
 
-    std::vector<detail::RenderQuantum> inputs(
-        node->getNumberOfInputs(),
-        detail::RenderQuantum(computedNumberOfChannels, renderQuantumSize_));
-
-    for (auto &inputNode : node->inputs_) {
-      if (auto srcNode = inputNode.source.lock()) {
-        if (nodeResults.find(srcNode) != nodeResults.end()) {
-          inputs[inputNode.destinationIndex].add(
-              nodeResults[srcNode][inputNode.sourceIndex],
-              node->channelInterpretation_);
-        }
+    auto &inputs = entry.inputs;
+    auto &inputsConnected = entry.inputsConnected;
+
+    for (auto &input : inputs) {
+      input.reset(computedNumberOfChannels);
+    }
+
+    std::fill(inputsConnected.begin(), inputsConnected.end(), false);
+
+    for (auto &connection : entry.connections) {
+      auto &source = order.nodes[connection.source];
+      auto lastRead = --source.pendingReads[connection.sourceIndex] == 0;
+      auto &input = inputs[connection.destinationIndex];
+      auto &result = source.results[connection.sourceIndex];
+
+      // The first connection shares the channels of its source; only
+      // mixing and summing copy samples. The last reader releases the
+      // source's references, so that its channels can be written in place.
+      if (inputsConnected[connection.destinationIndex]) {
+        input.add(result, node->channelInterpretation_);
+      } else {
+        input = result;
+        input.mix(computedNumberOfChannels, node->channelInterpretation_);
+        inputsConnected[connection.destinationIndex] = true;
+      }
+
+      if (lastRead) {
+        result.reset(0);
       }
     }
 
-    // process() may change the number of output channels.
-    std::vector<detail::RenderQuantum> outputs(
-        node->getNumberOfOutputs(),
-        detail::RenderQuantum(computedNumberOfChannels, renderQuantumSize_));
+    auto inPlace =
+        node->getNumberOfInputs() == 1 && node->getNumberOfOutputs() == 1;
 
-    node->process(inputs, outputs, paramCollection);
-    nodeResults[node] = std::move(outputs);
+    if (inPlace) {
+      detail::RealtimeChecker::NodeScope scope(*node, currentFrame_.load());
+      inPlace = node->processInPlace(inputs[0], entry.paramValues);
+    }
+
+    if (inPlace) {
+      std::swap(entry.results[0], inputs[0]);
+    } else {
+      // process() may change the number of output channels.
+      for (auto &result : entry.results) {
+        result.reset(computedNumberOfChannels);
+      }
+
+      detail::RealtimeChecker::NodeScope scope(*node, currentFrame_.load());
+      node->process(inputs, entry.results, entry.paramValues);
+    }
+
+    // The inputs give the channels of their sources back to the pool.
+    for (auto &input : inputs) {
+      input.reset(0);
+    }
 
     // SPEC: If this AudioNode is an AudioWorkletNode, execute these substeps:
-    // TODO
+    // AudioWorkletNode::process() runs them, as its processor is native.
   }
 
   // SPEC: Atomically perform the following steps:
   currentFrame_ += renderQuantumSize_;
   currentTime_ = static_cast<double>(currentFrame_.load()) / sampleRate_;
 
-  return nodeResults[audioGraph_.getDestinationNode()][0];
+  return &order.nodes[order.destination].results[0];
+}
+
+void BaseAudioContext::updateRenderOrder() {
+  releaseRetired();
+
+  if (audioGraph_.getVersion() == renderOrderVersion_) {
+    return;
+  }
+
+  auto order = audioGraph_.createRenderOrder();
+  renderOrderVersion_ = order->version;
+  controlMessageQueue_.push(detail::MessageRenderOrder{std::move(order)});
+}
+
+void BaseAudioContext::retire(std::shared_ptr<const void> object) {
+  // If the control thread has fallen that far behind, the object is
+  // released here after all.
+  retired_.tryPush(std::move(object));
+}
+
+void BaseAudioContext::releaseRetired() {
+  while (retired_.tryPop()) {
+  }
 }
 
 void BaseAudioContext::run() {
@@ -189,6 +389,34 @@ void BaseAudioContext::run() {
             std::get<detail::MessageAudioScheduledSourceNodeStop>(*message);
 
         msg.node->stopTime_ = msg.when;
+      } else if (std::holds_alternative<detail::MessageVoicePoolRecycle>(
+                     *message)) {
+        auto &msg = std::get<detail::MessageVoicePoolRecycle>(*message);
+
+        msg.pool->recycle(msg.voice);
+      } else if (std::holds_alternative<detail::MessageRenderOrder>(
+                     *message)) {
+        auto &msg = std::get<detail::MessageRenderOrder>(*message);
+
+        renderOrder_.swap(msg.order);
+        retire(std::move(msg.order));
+      } else if (std::holds_alternative<detail::MessageWaveShaperNodeCurve>(
+                     *message)) {
+        auto &msg = std::get<detail::MessageWaveShaperNodeCurve>(*message);
+
+        msg.state->curve.swap(msg.curve);
+        retire(std::move(msg.curve));
+        retire(std::move(msg.state));
+      } else if (std::holds_alternative<
+                     detail::MessageWaveShaperNodeOversampler>(*message)) {
+        auto &msg =
+            std::get<detail::MessageWaveShaperNodeOversampler>(*message);
+
+        // The node may be gone, so the message may hold the last reference
+        // to its state.
+        msg.state->oversampler.swap(msg.oversampler);
+        retire(std::move(msg.oversampler));
+        retire(std::move(msg.state));
       } else {
         // TODO
       }
@@ -7,7 +7,6 @@
 
 #include "web_audio/audio_param.hh"
 #include "web_audio/base_audio_context.hh"
-#include "web_audio/detail/vector_helper.hh"
 
 namespace web_audio {
 std::shared_ptr<BiquadFilterNode>
@@ -113,56 +112,100 @@ void BiquadFilterNode::getFrequencyResponse(
 void BiquadFilterNode::process(const std::vector<detail::RenderQuantum> &inputs,
                                std::vector<detail::RenderQuantum> &outputs,
                                const detail::ParamCollection &params) {
-  auto &input = inputs[0];
   outputs.resize(1);
-  auto &output = outputs[0];
-
-  for (std::uint32_t i = 0; i < output.getLength(); ++i) {
-    auto f = params.getValue(frequency_, i);
-    auto d = params.getValue(detune_, i);
-    auto q = params.getValue(Q_, i);
-    auto g = params.getValue(gain_, i);
-    auto computedFrequency = static_cast<float>(f * std::pow(2, d / 1200));
-    auto nyquist = getContext()->getSampleRate() / 2;
-    computedFrequency = std::clamp(computedFrequency, 0.0f, nyquist);
-
-    auto F_s = getContext()->getSampleRate();
-    auto f_0 = computedFrequency;
-    auto G = g;
-    auto Q = q;
-
-    if (type_ == BiquadFilterType::eLowshelf ||
-        type_ == BiquadFilterType::eHighshelf) {
-      // NOTE: is qMax safe?
-      float qMax = std::log10(std::numeric_limits<float>::max()) * 20;
-      Q = std::clamp(Q, -qMax, qMax);
-    }
+  outputs[0] = inputs[0];
+  processInPlace(outputs[0], params);
+}
 
-    if (type_ == BiquadFilterType::eBandpass ||
-        type_ == BiquadFilterType::eNotch ||
-        type_ == BiquadFilterType::eAllpass ||
-        type_ == BiquadFilterType::ePeaking) {
-      Q = std::clamp(Q, 0.f, std::numeric_limits<float>::max());
-    }
+bool BiquadFilterNode::processInPlace(detail::RenderQuantum &quantum,
+                                      const detail::ParamCollection &params) {
+  auto numberOfChannels = quantum.getNumberOfChannels();
+  auto frames = quantum.getLength();
+
+  if (kernel_.getNumberOfChannels() != numberOfChannels) {
+    kernel_.setNumberOfChannels(numberOfChannels);
+    inputChannels_.resize(numberOfChannels);
+    outputChannels_.resize(numberOfChannels);
+  }
+
+  // The kernel filters in place.
+  for (std::uint32_t ch = 0; ch < numberOfChannels; ++ch) {
+    outputChannels_[ch] = quantum[ch].data();
+    inputChannels_[ch] = outputChannels_[ch];
+  }
+
+  if (params.isConstant(frequency_) && params.isConstant(detune_) &&
+      params.isConstant(Q_) && params.isConstant(gain_)) {
+    auto coefficients = computeCoefficientsAt(params, 0, sampleRate_);
+    kernel_.process(coefficients, inputChannels_.data(),
+                    outputChannels_.data(), frames);
+    return true;
+  }
+
+  // Exact coefficients at the sub-block boundaries, linearly interpolated in
+  // between.
+  coefficients_.resize(frames);
+  auto from = computeCoefficientsAt(params, 0, sampleRate_);
+
+  for (std::uint32_t start = 0; start < frames; start += kSubBlockSize) {
+    auto end = std::min<std::uint32_t>(start + kSubBlockSize, frames);
+    auto to = computeCoefficientsAt(params, end < frames ? end : frames - 1,
+                                    sampleRate_);
 
-    computeCoefficients(type_, F_s, f_0, G, Q, a_, b_);
-
-    for (std::uint32_t ch = 0; ch < output.getNumberOfChannels(); ++ch) {
-      auto prevX = detail::VectorHelper::getOrDefault(
-          x_, ch, std::make_tuple(0.0f, 0.0f, 0.0f));
-      auto prevY = detail::VectorHelper::getOrDefault(
-          y_, ch, std::make_tuple(0.0f, 0.0f, 0.0f));
-      auto x =
-          std::make_tuple(input[ch][i], std::get<0>(prevX), std::get<1>(prevX));
-      auto y = std::make_tuple(0.0f, std::get<0>(prevY), std::get<1>(prevY));
-      transferTime(a_, b_, x, y);
-      output[ch][i] = std::get<0>(y);
-      web_audio::detail::VectorHelper::resizeAndSet(x_, ch, x);
-      web_audio::detail::VectorHelper::resizeAndSet(y_, ch, y);
+    for (auto i = start; i < end; ++i) {
+      coefficients_[i] = detail::BiquadCoefficients::interpolate(
+          from, to, static_cast<float>(i - start) / (end - start));
     }
+
+    from = to;
+  }
+
+  kernel_.process(coefficients_.data(), inputChannels_.data(),
+                  outputChannels_.data(), frames);
+  return true;
+}
+
+detail::BiquadCoefficients
+BiquadFilterNode::computeCoefficientsAt(const detail::ParamCollection &params,
+                                        std::uint32_t frame, float sampleRate) {
+  auto f = params.getValue(frequency_, frame);
+  auto d = params.getValue(detune_, frame);
+  auto q = params.getValue(Q_, frame);
+  auto g = params.getValue(gain_, frame);
+  auto computedFrequency = static_cast<float>(f * std::exp2(d / 1200));
+  auto nyquist = sampleRate / 2;
+  computedFrequency = std::clamp(computedFrequency, 0.0f, nyquist);
+
+  auto F_s = sampleRate;
+  auto f_0 = computedFrequency;
+  auto G = g;
+  auto Q = q;
+
+  if (type_ == BiquadFilterType::eLowshelf ||
+      type_ == BiquadFilterType::eHighshelf) {
+    // NOTE: is qMax safe?
+    float qMax = std::log10(std::numeric_limits<float>::max()) * 20;
+    Q = std::clamp(Q, -qMax, qMax);
   }
+
+  if (type_ == BiquadFilterType::eBandpass ||
+      type_ == BiquadFilterType::eNotch ||
+      type_ == BiquadFilterType::eAllpass ||
+      type_ == BiquadFilterType::ePeaking) {
+    Q = std::clamp(Q, 0.f, std::numeric_limits<float>::max());
+  }
+
+  computeCoefficients(type_, F_s, f_0, G, Q, a_, b_);
+
+  auto a_0 = std::get<0>(a_);
+  return {
+      std::get<0>(b_) / a_0, std::get<1>(b_) / a_0, std::get<2>(b_) / a_0,
+      std::get<1>(a_) / a_0, std::get<2>(a_) / a_0,
+  };
 }
 
+void BiquadFilterNode::resetState() { kernel_.reset(); }
+
 std::vector<std::shared_ptr<AudioParam>> BiquadFilterNode::getParams() const {
   return {frequency_, detune_, Q_, gain_};
 }
@@ -0,0 +1,71 @@
+#include "web_audio/channel_merger_node.hh"
+
+#include "web_audio/dom_exception.hh"
+
+namespace web_audio {
+std::shared_ptr<ChannelMergerNode>
+ChannelMergerNode::create(std::shared_ptr<BaseAudioContext> context,
+                          const ChannelMergerOptions &options) {
+  // SPEC: If numberOfInputs is less than 1 or greater than the maximum
+  // supported number of channels, an IndexSizeError MUST be thrown.
+  if (options.numberOfInputs < 1 ||
+      options.numberOfInputs > kMaxNumberOfInputs) {
+    throw DOMException("ChannelMergerNode: numberOfInputs must be in [1, 32]",
+                       "IndexSizeError");
+  }
+
+  auto node = std::shared_ptr<ChannelMergerNode>(new ChannelMergerNode());
+  node->initialize(context);
+
+  node->numberOfInputs_ = options.numberOfInputs;
+  node->numberOfOutputs_ = 1;
+  node->channelCount_ = 1;
+  node->channelCountMode_ = ChannelCountMode::eExplicit;
+  node->channelInterpretation_ =
+      options.channelInterpretation.value_or(ChannelInterpretation::eSpeakers);
+
+  // The options may only repeat the fixed values.
+  if (options.channelCount) {
+    node->setChannelCount(*options.channelCount);
+  }
+
+  if (options.channelCountMode) {
+    node->setChannelCountMode(*options.channelCountMode);
+  }
+
+  return node;
+}
+
+void ChannelMergerNode::setChannelCount(std::uint32_t channelCount) {
+  // SPEC: InvalidStateError exception MUST be thrown for any attempt to
+  // change the value.
+  if (channelCount != channelCount_) {
+    throw DOMException("ChannelMergerNode: channelCount cannot be changed",
+                       "InvalidStateError");
+  }
+}
+
+void ChannelMergerNode::setChannelCountMode(
+    ChannelCountMode channelCountMode) {
+  // SPEC: InvalidStateError exception MUST be thrown for any attempt to
+  // change the value.
+  if (channelCountMode != channelCountMode_) {
+    throw DOMException("ChannelMergerNode: channelCountMode cannot be changed",
+                       "InvalidStateError");
+  }
+}
+
+void ChannelMergerNode::process(
+    const std::vector<detail::RenderQuantum> &inputs,
+    std::vector<detail::RenderQuantum> &outputs,
+    const detail::ParamCollection &params) {
+  auto &output = outputs[0];
+
+  // Every input is down-mixed to one channel; unconnected ones are silent.
+  output.reset(numberOfInputs_);
+
+  for (std::uint32_t i = 0; i < numberOfInputs_; ++i) {
+    output.setChannel(i, inputs[i], 0);
+  }
+}
+} // namespace web_audio
\ No newline at end of file
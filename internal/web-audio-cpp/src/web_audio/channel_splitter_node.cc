@@ -0,0 +1,87 @@
+#include "web_audio/channel_splitter_node.hh"
+
+#include "web_audio/dom_exception.hh"
+
+namespace web_audio {
+std::shared_ptr<ChannelSplitterNode>
+ChannelSplitterNode::create(std::shared_ptr<BaseAudioContext> context,
+                            const ChannelSplitterOptions &options) {
+  // SPEC: If numberOfOutputs is less than 1 or greater than the maximum
+  // supported number of channels, an IndexSizeError MUST be thrown.
+  if (options.numberOfOutputs < 1 ||
+      options.numberOfOutputs > kMaxNumberOfOutputs) {
+    throw DOMException(
+        "ChannelSplitterNode: numberOfOutputs must be in [1, 32]",
+        "IndexSizeError");
+  }
+
+  auto node = std::shared_ptr<ChannelSplitterNode>(new ChannelSplitterNode());
+  node->initialize(context);
+
+  node->numberOfInputs_ = 1;
+  node->numberOfOutputs_ = options.numberOfOutputs;
+  node->channelCount_ = options.numberOfOutputs;
+  node->channelCountMode_ = ChannelCountMode::eExplicit;
+  node->channelInterpretation_ = ChannelInterpretation::eDiscrete;
+
+  // The options may only repeat the fixed values.
+  if (options.channelCount) {
+    node->setChannelCount(*options.channelCount);
+  }
+
+  if (options.channelCountMode) {
+    node->setChannelCountMode(*options.channelCountMode);
+  }
+
+  if (options.channelInterpretation) {
+    node->setChannelInterpretation(*options.channelInterpretation);
+  }
+
+  return node;
+}
+
+void ChannelSplitterNode::setChannelCount(std::uint32_t channelCount) {
+  // SPEC: InvalidStateError exception MUST be thrown for any attempt to
+  // change the value.
+  if (channelCount != channelCount_) {
+    throw DOMException("ChannelSplitterNode: channelCount cannot be changed",
+                       "InvalidStateError");
+  }
+}
+
+void ChannelSplitterNode::setChannelCountMode(
+    ChannelCountMode channelCountMode) {
+  // SPEC: InvalidStateError exception MUST be thrown for any attempt to
+  // change the value.
+  if (channelCountMode != channelCountMode_) {
+    throw DOMException(
+        "ChannelSplitterNode: channelCountMode cannot be changed",
+        "InvalidStateError");
+  }
+}
+
+void ChannelSplitterNode::setChannelInterpretation(
+    ChannelInterpretation channelInterpretation) {
+  // SPEC: InvalidStateError exception MUST be thrown for any attempt to
+  // change the value.
+  if (channelInterpretation != channelInterpretation_) {
+    throw DOMException(
+        "ChannelSplitterNode: channelInterpretation cannot be changed",
+        "InvalidStateError");
+  }
+}
+
+void ChannelSplitterNode::process(
+    const std::vector<detail::RenderQuantum> &inputs,
+    std::vector<detail::RenderQuantum> &outputs,
+    const detail::ParamCollection &params) {
+  auto &input = inputs[0];
+
+  // The input has exactly numberOfOutputs channels, the extra ones silent.
+  for (std::uint32_t i = 0; i < numberOfOutputs_; ++i) {
+    auto &output = outputs[i];
+    output.reset(1);
+    output.setChannel(0, input, i);
+  }
+}
+} // namespace web_audio
\ No newline at end of file
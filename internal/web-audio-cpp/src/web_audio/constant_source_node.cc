@@ -1,5 +1,6 @@
 #include "web_audio/constant_source_node.hh"
 
+#include <algorithm>
 #include <limits>
 
 #include "web_audio/audio_param.hh"
@@ -38,11 +39,15 @@ void ConstantSourceNode::process(
     std::vector<detail::RenderQuantum> &outputs,
     const detail::ParamCollection &params) {
   auto &output = outputs[0];
-  output = detail::RenderQuantum(1, output.getLength());
+  output.mix(1, ChannelInterpretation::eDiscrete);
 
-  for (std::uint32_t i = 0; i < output.getLength(); ++i) {
-    float value = params.getValue(offset_, i);
-    output[0][i] = value;
+  // A constant offset flows on as a single value.
+  if (params.isConstant(offset_)) {
+    output.setConstant(0, params.getValue(offset_, 0));
+    return;
   }
+
+  auto values = params.getValues(offset_);
+  std::copy(values.begin(), values.end(), output[0].begin());
 }
 } // namespace web_audio
@@ -64,7 +64,7 @@ void ConvolverNode::setBuffer(const std::shared_ptr<AudioBuffer> &buffer) {
     auto length = bufferCopy_->getLength();
 
     for (std::uint32_t ch = 0; ch < numberOfChannels; ++ch) {
-      auto &&channelData = bufferCopy_->getChannelData(ch);
+      auto &channelData = bufferCopy_->getWritableChannelData(ch);
       for (std::uint32_t i = 0; i < length; ++i) {
         channelData[i] *= static_cast<float>(scale);
       }
@@ -72,19 +72,23 @@ void ConvolverNode::setBuffer(const std::shared_ptr<AudioBuffer> &buffer) {
   }
 
   if (bufferCopy_) {
+    auto workerPool = getContext()->getWorkerPool();
+    auto &cache = getContext()->getImpulseResponseCache();
+    auto blockSize = getContext()->getRenderQuantumSize();
     convolvers_.resize(bufferCopy_->getNumberOfChannels());
 
     for (std::uint32_t ch = 0; ch < bufferCopy_->getNumberOfChannels(); ++ch) {
       convolvers_[ch] = std::make_unique<detail::Convolver<float>>(
-          bufferCopy_->getChannelData(ch),
-          getContext()->getRenderQuantumSize());
+          cache.acquire(bufferCopy_->getChannelData(ch),
+                        blockSize),
+          workerPool);
     }
 
-    // Copy convolver, so that the states are independent
+    // Separate convolver sharing the kernel, so that the states are
+    // independent
     if (bufferCopy_->getNumberOfChannels() == 1) {
       convolvers_.push_back(std::make_unique<detail::Convolver<float>>(
-          bufferCopy_->getChannelData(0),
-          getContext()->getRenderQuantumSize()));
+          convolvers_[0]->getKernel(), workerPool));
     }
   } else {
     convolvers_.clear();
@@ -103,27 +107,27 @@ void ConvolverNode::process(const std::vector<detail::RenderQuantum> &inputs,
 
   if (bufferCopy_->getNumberOfChannels() == 1) {
     if (input.getNumberOfChannels() == 1) {
-      output = detail::RenderQuantum(1, input.getLength());
+      output.reset(1);
       convolvers_[0]->process(input[0], output[0]);
     } else { // input.getNumberOfChannels == 2
-      output = detail::RenderQuantum(2, input.getLength());
+      output.reset(2);
       convolvers_[0]->process(input[0], output[0]);
       convolvers_[1]->process(input[1], output[1]);
     }
   } else if (bufferCopy_->getNumberOfChannels() == 2) {
     if (input.getNumberOfChannels() == 1) {
-      output = detail::RenderQuantum(2, input.getLength());
+      output.reset(2);
       convolvers_[0]->process(input[0], output[0]);
       convolvers_[1]->process(input[0], output[1]);
     } else { // input.getNumberOfChannels == 2
-      output = detail::RenderQuantum(2, input.getLength());
+      output.reset(2);
       convolvers_[0]->process(input[0], output[0]);
       convolvers_[1]->process(input[1], output[1]);
     }
   } else { // bufferCopy_->getNumberOfChannels() == 4
     if (input.getNumberOfChannels() == 1) {
-      output = detail::RenderQuantum(2, input.getLength());
-      std::vector<float> temp;
+      output.reset(2);
+      auto &temp = scratch_;
       convolvers_[0]->process(input[0], output[0]);
       convolvers_[2]->process(input[0], temp);
 
@@ -140,8 +144,8 @@ void ConvolverNode::process(const std::vector<detail::RenderQuantum> &inputs,
         output[1][i] *= 0.5f;
       }
     } else { // input.getNumberOfChannels == 2
-      output = detail::RenderQuantum(2, input.getLength());
-      std::vector<float> temp;
+      output.reset(2);
+      auto &temp = scratch_;
       convolvers_[0]->process(input[0], output[0]);
       convolvers_[2]->process(input[1], temp);
 
@@ -162,7 +166,7 @@ void ConvolverNode::process(const std::vector<detail::RenderQuantum> &inputs,
 }
 
 double ConvolverNode::calculateNormalizationScale(
-    std::shared_ptr<AudioBuffer> buffer) {
+    std::shared_ptr<const AudioBuffer> buffer) {
   constexpr auto GainCalibration = 0.00125;
   constexpr auto GainCalibrationSampleRate = 44100;
   constexpr auto MinPower = 0.000125;
@@ -204,4 +208,4 @@ double ConvolverNode::calculateNormalizationScale(
 
   return scale;
 }
-} // namespace web_audio
+} // namespace web_audio
\ No newline at end of file
@@ -17,6 +17,7 @@ DelayNode::create(std::shared_ptr<BaseAudioContext> context,
 
   node->maxDelayTime_ = options.maxDelayTime;
   node->delayTime_ = std::shared_ptr<AudioParam>(new AudioParam());
+  node->delayTime_->sampleRate_ = context->getSampleRate();
 
   node->numberOfInputs_ = 1;
   node->numberOfOutputs_ = 1;
@@ -54,10 +55,20 @@ std::vector<std::shared_ptr<AudioParam>> DelayNode::getParams() const {
   return {delayTime_};
 }
 
+void DelayNode::resetState() {
+  for (auto &buffer : delayBuffers_) {
+    for (std::uint32_t ch = 0; ch < buffer.getNumberOfChannels(); ++ch) {
+      buffer.setConstant(ch, 0.0f);
+    }
+  }
+
+  writeIndex_ = 0;
+}
+
 std::shared_ptr<DelayNode::DelayNodeReader>
 DelayNode::DelayNodeReader::create(std::shared_ptr<DelayNode> delayNode) {
   auto node = std::shared_ptr<DelayNodeReader>(new DelayNodeReader());
-  node->delayNode_ = delayNode;
+  node->delayNode_ = delayNode.get();
   return node;
 }
 
@@ -65,29 +76,24 @@ void DelayNode::DelayNodeReader::process(
     const std::vector<detail::RenderQuantum> &inputs,
     std::vector<detail::RenderQuantum> &outputs,
     const detail::ParamCollection &params) {
-  auto locked = this->delayNode_.lock();
-  auto sampleRate = locked->context_.lock()->getSampleRate();
+  auto &delayNode = *delayNode_;
+  auto sampleRate = delayNode.sampleRate_;
+  auto quantumSize = delayNode.renderQuantumSize_;
+  auto bufferSize = delayNode.delayBuffers_.size() * quantumSize;
 
   for (std::uint32_t channel = 0; channel < outputs[0].getNumberOfChannels();
        ++channel) {
     for (std::uint32_t i = 0; i < outputs[0].getLength(); ++i) {
-      auto delayTime = params.getValue(locked->delayTime_, i);
+      auto delayTime = params.getValue(delayNode.delayTime_, i);
 
       auto delaySamples = static_cast<std::uint32_t>(delayTime * sampleRate);
       auto currentPosition =
-          ((locked->writeIndex_ - 1) *
-               locked->context_.lock()->getRenderQuantumSize() +
-           i) %
-          (locked->delayBuffers_.size() *
-           locked->context_.lock()->getRenderQuantumSize());
-      auto readPosition = (currentPosition - delaySamples) %
-                          (locked->delayBuffers_.size() *
-                           locked->context_.lock()->getRenderQuantumSize());
-      auto readQuantum =
-          readPosition / locked->context_.lock()->getRenderQuantumSize();
-      auto readOffset =
-          readPosition % locked->context_.lock()->getRenderQuantumSize();
-      auto &readBuffer = locked->delayBuffers_[readQuantum];
+          ((delayNode.writeIndex_ - 1) * quantumSize + i) % bufferSize;
+      auto readPosition = (currentPosition - delaySamples) % bufferSize;
+      auto readQuantum = readPosition / quantumSize;
+      auto readOffset = readPosition % quantumSize;
+      // Read through a const reference, so that the channel is not copied.
+      const auto &readBuffer = delayNode.delayBuffers_[readQuantum];
 
       outputs[0][channel][i] = readBuffer[channel][readOffset];
     }
@@ -97,7 +103,7 @@ void DelayNode::DelayNodeReader::process(
 std::shared_ptr<DelayNode::DelayNodeWriter>
 DelayNode::DelayNodeWriter::create(std::shared_ptr<DelayNode> delayNode) {
   auto node = std::shared_ptr<DelayNodeWriter>(new DelayNodeWriter());
-  node->delayNode_ = delayNode;
+  node->delayNode_ = delayNode.get();
   return node;
 }
 
@@ -105,11 +111,10 @@ void DelayNode::DelayNodeWriter::process(
     const std::vector<detail::RenderQuantum> &inputs,
     std::vector<detail::RenderQuantum> &outputs,
     const detail::ParamCollection &params) {
-  auto locked = this->delayNode_.lock();
-  auto context = locked->context_.lock();
+  auto &delayNode = *delayNode_;
 
-  locked->delayBuffers_[locked->writeIndex_] = inputs[0];
-  locked->writeIndex_ =
-      (locked->writeIndex_ + 1) % locked->delayBuffers_.size();
+  delayNode.delayBuffers_[delayNode.writeIndex_] = inputs[0];
+  delayNode.writeIndex_ =
+      (delayNode.writeIndex_ + 1) % delayNode.delayBuffers_.size();
 }
 } // namespace web_audio
\ No newline at end of file
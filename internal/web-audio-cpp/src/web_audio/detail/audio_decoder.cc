@@ -0,0 +1,142 @@
+#include "web_audio/detail/audio_decoder.hh"
+
+#include <algorithm>
+#include <exception>
+#include <latch>
+#include <mutex>
+#include <stdexcept>
+#include <vector>
+
+#include "web_audio/audio_buffer.hh"
+#include "web_audio/detail/rational_resampler.hh"
+#include "web_audio/detail/wav_decoder.hh"
+
+namespace web_audio::detail {
+namespace {
+struct ParallelForState {
+  ParallelForState(const std::function<void(std::size_t)> &body,
+                   std::size_t count)
+      : body(body), done(static_cast<std::ptrdiff_t>(count)) {}
+
+  const std::function<void(std::size_t)> &body;
+  std::latch done;
+  std::mutex mutex;
+  std::exception_ptr exception;
+
+  void run(std::size_t index) {
+    try {
+      body(index);
+    } catch (...) {
+      std::lock_guard lock(mutex);
+
+      if (!exception) {
+        exception = std::current_exception();
+      }
+    }
+
+    done.count_down();
+  }
+};
+
+class ParallelForTask final : public WorkerTask {
+public:
+  ParallelForTask(ParallelForState &state, std::size_t index)
+      : state_(state), index_(index) {}
+
+  void run() override { state_.run(index_); }
+
+private:
+  ParallelForState &state_;
+  std::size_t index_;
+};
+} // namespace
+
+std::shared_ptr<AudioBuffer>
+AudioDecoder::decode(std::span<const std::uint8_t> data, float sampleRate,
+                     WorkerPool &pool) {
+  auto format = WavDecoder::parse(data);
+
+  if (format.length == 0) {
+    throw std::invalid_argument("WAVE: no sample frames");
+  }
+
+  RationalResampler resampler(format.sampleRate, sampleRate);
+  auto resample = resampler.getUpFactor() != resampler.getDownFactor();
+  auto outputLength =
+      resample ? resampler.getOutputLength(format.length) : format.length;
+
+  if (outputLength > UINT32_MAX) {
+    throw std::invalid_argument("Decoded audio is too long.");
+  }
+
+  const auto channels = format.numberOfChannels;
+  auto buffer = AudioBuffer::create({
+      .numberOfChannels = channels,
+      .length = static_cast<std::uint32_t>(outputLength),
+      .sampleRate = sampleRate,
+  });
+
+  std::vector<float *> outputs(channels);
+
+  for (std::uint32_t ch = 0; ch < channels; ++ch) {
+    outputs[ch] = buffer->getWritableChannelData(ch).data();
+  }
+
+  // Without resampling the frames are decoded straight into the buffer.
+  std::vector<std::vector<float>> decoded;
+  std::vector<float *> targets = outputs;
+
+  if (resample) {
+    decoded.assign(channels, std::vector<float>(format.length));
+
+    for (std::uint32_t ch = 0; ch < channels; ++ch) {
+      targets[ch] = decoded[ch].data();
+    }
+  }
+
+  auto decodeChunks = (format.length + kChunkFrames - 1) / kChunkFrames;
+  parallelFor(pool, decodeChunks, [&](std::size_t chunk) {
+    auto start = static_cast<std::uint32_t>(chunk * kChunkFrames);
+    auto frames = std::min(kChunkFrames, format.length - start);
+    std::vector<float> scratch(std::size_t{frames} * channels);
+    std::vector<float *> destinations(channels);
+
+    for (std::uint32_t ch = 0; ch < channels; ++ch) {
+      destinations[ch] = targets[ch] + start;
+    }
+
+    WavDecoder::decode(format, data, start, frames, destinations.data(),
+                       scratch.data());
+  });
+
+  if (resample) {
+    auto outputChunks = (outputLength + kChunkFrames - 1) / kChunkFrames;
+    parallelFor(pool, channels * outputChunks, [&](std::size_t job) {
+      auto ch = job / outputChunks;
+      auto start = (job % outputChunks) * kChunkFrames;
+      auto frames = std::min<std::size_t>(kChunkFrames, outputLength - start);
+      resampler.process(decoded[ch].data(), format.length, start,
+                        outputs[ch] + start, frames);
+    });
+  }
+
+  return buffer;
+}
+
+void AudioDecoder::parallelFor(WorkerPool &pool, std::size_t count,
+                               const std::function<void(std::size_t)> &body) {
+  ParallelForState state(body, count);
+
+  for (std::size_t i = 0; i < count; ++i) {
+    if (!pool.submit(std::make_shared<ParallelForTask>(state, i))) {
+      state.run(i);
+    }
+  }
+
+  state.done.wait();
+
+  if (state.exception) {
+    std::rethrow_exception(state.exception);
+  }
+}
+} // namespace web_audio::detail
\ No newline at end of file
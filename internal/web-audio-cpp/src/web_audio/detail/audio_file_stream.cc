@@ -0,0 +1,248 @@
+#include "web_audio/detail/audio_file_stream.hh"
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+namespace web_audio::detail {
+AudioFileStream::AudioFileStream(const std::string &path,
+                                 std::uint32_t numberOfBlocks)
+    : file_(path, std::ios::binary),
+      freeBlocks_(std::max<std::uint32_t>(numberOfBlocks, 2)),
+      readyBlocks_(std::max<std::uint32_t>(numberOfBlocks, 2)) {
+  if (!file_) {
+    throw std::runtime_error("Failed to open " + path);
+  }
+
+  format_ = WavDecoder::parse(file_);
+  file_.clear();
+
+  const auto channels = format_.numberOfChannels;
+  blocks_.resize(std::max<std::uint32_t>(numberOfBlocks, 2));
+
+  for (std::uint32_t i = 0; i < blocks_.size(); ++i) {
+    blocks_[i].samples.resize(std::size_t{channels} * kBlockFrames);
+    freeBlocks_.tryPush(i);
+  }
+
+  bytes_.resize(kBlockFrames * format_.blockAlign);
+  scratch_.resize(std::size_t{channels} * kBlockFrames);
+  destinations_.resize(channels);
+  thread_ = std::thread([this] { ioLoop(); });
+}
+
+AudioFileStream::~AudioFileStream() {
+  stopping_.store(true, std::memory_order_release);
+  wake();
+  thread_.join();
+}
+
+const WavFormat &AudioFileStream::getFormat() const { return format_; }
+
+void AudioFileStream::setLoop(bool loop, std::uint32_t loopStart,
+                              std::uint32_t loopEnd) {
+  loopStart_.store(loopStart, std::memory_order_relaxed);
+  loopEnd_.store(loopEnd, std::memory_order_relaxed);
+  loop_.store(loop, std::memory_order_release);
+  wake();
+}
+
+void AudioFileStream::seek(std::uint32_t frame) {
+  seekFrame_.store(std::min(frame, format_.length), std::memory_order_relaxed);
+  generation_.fetch_add(1, std::memory_order_release);
+  wake();
+}
+
+void AudioFileStream::prime() {
+  while (true) {
+    auto idle = idleGeneration_.load(std::memory_order_acquire);
+
+    if (idle == generation_.load(std::memory_order_acquire)) {
+      return;
+    }
+
+    idleGeneration_.wait(idle, std::memory_order_acquire);
+  }
+}
+
+std::uint32_t AudioFileStream::read(float *const *destinations,
+                                    std::uint32_t frames) {
+  auto generation = generation_.load(std::memory_order_acquire);
+
+  if (generation != readGeneration_) {
+    readGeneration_ = generation;
+    finished_ = false;
+  }
+
+  std::uint32_t done = 0;
+
+  while (done < frames && !finished_) {
+    if (currentBlock_ < 0) {
+      auto next = readyBlocks_.tryPop();
+
+      if (!next) {
+        break;
+      }
+
+      currentBlock_ = *next;
+      blockOffset_ = 0;
+    }
+
+    auto index = static_cast<std::uint32_t>(currentBlock_);
+    const auto &block = blocks_[index];
+
+    if (block.generation != readGeneration_) {
+      // The block may come from a seek made after the generation was loaded
+      // above. Blocks are never newer than generation_, so the block is stale
+      // only if it differs from the latest generation too.
+      generation = generation_.load(std::memory_order_acquire);
+
+      if (generation != readGeneration_) {
+        readGeneration_ = generation;
+        finished_ = false;
+      }
+
+      if (block.generation != generation) {
+        release(index);
+        continue;
+      }
+    }
+
+    auto n = std::min(frames - done, block.frames - blockOffset_);
+
+    for (std::uint32_t ch = 0; ch < format_.numberOfChannels; ++ch) {
+      std::memcpy(destinations[ch] + done,
+                  block.samples.data() + ch * kBlockFrames + blockOffset_,
+                  n * sizeof(float));
+    }
+
+    done += n;
+    blockOffset_ += n;
+
+    if (blockOffset_ == block.frames) {
+      finished_ = block.endOfStream;
+      release(index);
+    }
+  }
+
+  if (done < frames && !finished_) {
+    underrunCount_.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  return done;
+}
+
+bool AudioFileStream::isFinished() const { return finished_; }
+
+std::uint64_t AudioFileStream::getUnderrunCount() const {
+  return underrunCount_.load(std::memory_order_relaxed);
+}
+
+void AudioFileStream::ioLoop() {
+  std::uint32_t generation = 0;
+
+  while (!stopping_.load(std::memory_order_acquire)) {
+    auto observed = signal_.load(std::memory_order_acquire);
+    auto requested = generation_.load(std::memory_order_acquire);
+
+    if (requested != generation) {
+      generation = requested;
+      position_ = seekFrame_.load(std::memory_order_relaxed);
+      ended_ = false;
+
+      // This thread is the only producer, so everything queued is stale.
+      while (auto stale = readyBlocks_.tryPop()) {
+        freeBlocks_.tryPush(*stale);
+      }
+    }
+
+    while (!ended_ &&
+           generation_.load(std::memory_order_acquire) == generation) {
+      auto index = freeBlocks_.tryPop();
+
+      if (!index) {
+        break;
+      }
+
+      ended_ = !fill(blocks_[*index], generation);
+      readyBlocks_.tryPush(*index);
+    }
+
+    if (generation_.load(std::memory_order_acquire) != generation) {
+      continue;
+    }
+
+    idleGeneration_.store(generation, std::memory_order_release);
+    idleGeneration_.notify_all();
+    signal_.wait(observed, std::memory_order_acquire);
+  }
+}
+
+bool AudioFileStream::fill(Block &block, std::uint32_t generation) {
+  const auto channels = format_.numberOfChannels;
+  block.generation = generation;
+  block.frames = 0;
+  block.endOfStream = false;
+
+  // Samples of the current read, at dataOffset 0 of bytes_.
+  auto format = format_;
+  format.dataOffset = 0;
+
+  while (block.frames < kBlockFrames) {
+    auto loop = loop_.load(std::memory_order_acquire);
+    auto loopStart = loopStart_.load(std::memory_order_relaxed);
+    auto loopEnd = std::min(loopEnd_.load(std::memory_order_relaxed),
+                            format_.length);
+    loop = loop && loopStart < loopEnd;
+
+    if (loop && position_ >= loopEnd) {
+      position_ = loopStart;
+    }
+
+    auto end = loop ? loopEnd : format_.length;
+
+    if (position_ >= end) {
+      block.endOfStream = true;
+      return false;
+    }
+
+    auto frames = std::min(kBlockFrames - block.frames, end - position_);
+    file_.seekg(static_cast<std::streamoff>(format_.dataOffset +
+                                            std::size_t{position_} *
+                                                format_.blockAlign));
+    file_.read(reinterpret_cast<char *>(bytes_.data()),
+               static_cast<std::streamsize>(frames * format_.blockAlign));
+    frames = static_cast<std::uint32_t>(file_.gcount() / format_.blockAlign);
+    file_.clear();
+
+    if (frames == 0) {
+      // The file was truncated after it was opened.
+      block.endOfStream = true;
+      return false;
+    }
+
+    for (std::uint32_t ch = 0; ch < channels; ++ch) {
+      destinations_[ch] =
+          block.samples.data() + ch * kBlockFrames + block.frames;
+    }
+
+    WavDecoder::decode(format, bytes_, 0, frames, destinations_.data(),
+                       scratch_.data());
+    block.frames += frames;
+    position_ += frames;
+  }
+
+  return true;
+}
+
+void AudioFileStream::release(std::uint32_t block) {
+  currentBlock_ = -1;
+  freeBlocks_.tryPush(block);
+  wake();
+}
+
+void AudioFileStream::wake() {
+  signal_.fetch_add(1, std::memory_order_release);
+  signal_.notify_one();
+}
+} // namespace web_audio::detail
\ No newline at end of file
@@ -3,30 +3,60 @@
 #include "web_audio/audio_context.hh"
 #include "web_audio/audio_param.hh"
 #include "web_audio/offline_audio_context.hh"
+#include "web_audio/panner_node.hh"
 
 namespace web_audio::detail {
 void AudioGraph::initialize(std::shared_ptr<BaseAudioContext> context,
                             std::uint32_t numberOfChannels) {
   listenerNode_ = AudioListenerNode::create(context);
   destinationNode_ = AudioDestinationNode::create(context, numberOfChannels);
-  nodes_.push_back(destinationNode_);
+  addNode(destinationNode_);
 }
 
 void AudioGraph::addNode(std::shared_ptr<AudioNode> node) {
-  if (!hasNode(node)) {
-    nodes_.push_back(node);
+  if (indices_.emplace(node.get(), nodes_.size()).second) {
+    nodes_.push_back(std::move(node));
+    markChanged();
   }
 }
 
 void AudioGraph::removeNode(std::shared_ptr<AudioNode> node) {
-  nodes_.erase(std::remove(nodes_.begin(), nodes_.end(), node), nodes_.end());
+  auto it = indices_.find(node.get());
+
+  if (it == indices_.end()) {
+    return;
+  }
+
+  // The order of nodes_ does not matter, so the last node fills the gap.
+  auto index = it->second;
+  indices_.erase(it);
+
+  if (index + 1 != nodes_.size()) {
+    nodes_[index] = std::move(nodes_.back());
+    indices_[nodes_[index].get()] = index;
+  }
+
+  nodes_.pop_back();
+  markChanged();
 }
 
 bool AudioGraph::hasNode(std::shared_ptr<AudioNode> node) const {
-  return std::find(nodes_.begin(), nodes_.end(), node) != nodes_.end();
+  return indices_.find(node.get()) != indices_.end();
 }
 
-void AudioGraph::clear() { nodes_.clear(); }
+void AudioGraph::clear() {
+  nodes_.clear();
+  indices_.clear();
+  markChanged();
+}
+
+void AudioGraph::markChanged() {
+  version_.fetch_add(1, std::memory_order_release);
+}
+
+std::uint64_t AudioGraph::getVersion() const {
+  return version_.load(std::memory_order_acquire);
+}
 
 std::vector<std::shared_ptr<AudioNode>>
 AudioGraph::getNextVertices(std::shared_ptr<AudioNode> node) const {
@@ -48,6 +78,15 @@ AudioGraph::getNextVertices(std::shared_ptr<AudioNode> node) const {
     }
   }
 
+  // PannerNodes read the listener axes, so the listener is processed first.
+  if (node == listenerNode_) {
+    for (const auto &vertex : nodes_) {
+      if (std::dynamic_pointer_cast<PannerNode>(vertex)) {
+        nextNodes.push_back(vertex);
+      }
+    }
+  }
+
   return nextNodes;
 }
 
@@ -69,6 +108,10 @@ AudioGraph::getPreviousVertices(std::shared_ptr<AudioNode> node) const {
     }
   }
 
+  if (std::dynamic_pointer_cast<PannerNode>(node)) {
+    prevNodes.push_back(listenerNode_);
+  }
+
   return prevNodes;
 }
 
@@ -196,6 +239,88 @@ std::vector<std::shared_ptr<AudioNode>> AudioGraph::orderNodes() const {
   return ordered;
 }
 
+std::shared_ptr<RenderOrder> AudioGraph::createRenderOrder() const {
+  auto order = std::make_shared<RenderOrder>();
+  order->version = getVersion();
+
+  auto ordered = orderNodes();
+  auto quantumSize = destinationNode_->renderQuantumSize_;
+  std::unordered_map<const AudioNode *, std::uint32_t> positions;
+
+  for (std::uint32_t i = 0; i < ordered.size(); ++i) {
+    positions.emplace(ordered[i].get(), i);
+  }
+
+  // Room for as many channels as a node can produce, so that nodes changing
+  // the number of channels of a quantum do not allocate.
+  auto createQuantum = [&] {
+    RenderQuantum quantum(0, quantumSize);
+    quantum.reserve(RenderQuantum::kMaxChannelCount);
+    return quantum;
+  };
+
+  auto resolve = [&](const std::vector<AudioNodeInput> &inputs,
+                     std::uint32_t position,
+                     std::vector<RenderOrder::Connection> &connections) {
+    for (const auto &input : inputs) {
+      auto source = input.source.lock();
+      auto found = positions.find(source.get());
+
+      if (!source || found == positions.end() || found->second >= position) {
+        continue;
+      }
+
+      auto &reads = order->nodes[found->second].reads;
+
+      if (input.sourceIndex >= reads.size()) {
+        continue;
+      }
+
+      ++reads[input.sourceIndex];
+      connections.push_back(
+          {found->second, input.sourceIndex, input.destinationIndex});
+    }
+  };
+
+  order->nodes.reserve(ordered.size());
+
+  for (std::uint32_t i = 0; i < ordered.size(); ++i) {
+    auto &node = ordered[i];
+    auto &entry = order->nodes.emplace_back();
+    entry.node = node;
+
+    for (const auto &param : node->getRenderParams()) {
+      auto &paramEntry = entry.params.emplace_back();
+      paramEntry.param = param;
+      paramEntry.values = createQuantum();
+      resolve(param->inputs_, i, paramEntry.connections);
+      entry.paramValues.setValue(param, param->getValue(), quantumSize);
+    }
+
+    resolve(node->inputs_, i, entry.connections);
+
+    for (std::uint32_t input = 0; input < node->numberOfInputs_; ++input) {
+      entry.inputs.push_back(createQuantum());
+    }
+
+    entry.inputsConnected.assign(node->numberOfInputs_, false);
+
+    for (std::uint32_t output = 0; output < node->numberOfOutputs_;
+         ++output) {
+      entry.results.push_back(createQuantum());
+    }
+
+    entry.reads.assign(node->numberOfOutputs_, 0);
+    entry.pendingReads.assign(node->numberOfOutputs_, 0);
+
+    if (node == destinationNode_) {
+      order->destination = i;
+    }
+  }
+
+  return order;
+}
+
 std::vector<std::shared_ptr<AudioNode>>
 AudioGraph::getNextNodes(std::shared_ptr<AudioNode> node) const {
   std::vector<std::shared_ptr<AudioNode>> nextNodes;
@@ -1,19 +1,69 @@
 #include "web_audio/detail/audio_listener_node.hh"
 
+#include <algorithm>
+#include <limits>
+
+#include "web_audio/audio_param.hh"
+#include "web_audio/base_audio_context.hh"
+
 namespace web_audio::detail {
 std::shared_ptr<AudioListenerNode>
 AudioListenerNode::create(std::shared_ptr<BaseAudioContext> context) {
   auto node = std::shared_ptr<AudioListenerNode>(new AudioListenerNode());
   node->initialize(context);
+  node->numberOfInputs_ = 0;
+  node->numberOfOutputs_ = 0;
   node->listener_ = AudioListener::create(context);
+
+  auto createParam = [&](float defaultValue) {
+    return AudioParam::create(node, defaultValue,
+                              std::numeric_limits<float>::lowest(),
+                              std::numeric_limits<float>::max());
+  };
+
+  auto &listener = *node->listener_;
+  listener.positionX = createParam(0);
+  listener.positionY = createParam(0);
+  listener.positionZ = createParam(0);
+  listener.forwardX = createParam(0);
+  listener.forwardY = createParam(0);
+  listener.forwardZ = createParam(-1);
+  listener.upX = createParam(0);
+  listener.upY = createParam(1);
+  listener.upZ = createParam(0);
+  // A basis per frame once the params are automated.
+  listener.bases_.reserve(context->getRenderQuantumSize());
   return node;
 }
 
+std::vector<std::shared_ptr<AudioParam>> AudioListenerNode::getParams() const {
+  return {listener_->positionX, listener_->positionY, listener_->positionZ,
+          listener_->forwardX,  listener_->forwardY,  listener_->forwardZ,
+          listener_->upX,       listener_->upY,       listener_->upZ};
+}
+
 void AudioListenerNode::process(
     const std::vector<detail::RenderQuantum> &inputs,
     std::vector<detail::RenderQuantum> &outputs,
     const detail::ParamCollection &params) {
-  // No operation
+  const auto &all = getRenderParams();
+  auto constant = std::all_of(all.begin(), all.end(), [&](const auto &param) {
+    return params.isConstant(param);
+  });
+
+  auto frames = constant ? 1 : params.getValues(all[0]).size();
+  auto &bases = listener_->bases_;
+  bases.resize(frames);
+
+  for (std::size_t i = 0; i < frames; ++i) {
+    auto value = [&](std::size_t index) {
+      return params.getValue(all[index], i);
+    };
+
+    bases[i] = ListenerBasis::create(Vec3(value(0), value(1), value(2)),
+                                     Vec3(value(3), value(4), value(5)),
+                                     Vec3(value(6), value(7), value(8)));
+  }
 }
 
 std::shared_ptr<AudioListener> AudioListenerNode::getListener() const {
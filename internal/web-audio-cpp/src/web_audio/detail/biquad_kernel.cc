@@ -0,0 +1,91 @@
+#include "web_audio/detail/biquad_kernel.hh"
+
+#include <algorithm>
+
+#include "web_audio/detail/vector_math.hh"
+
+namespace web_audio::detail {
+BiquadCoefficients BiquadCoefficients::interpolate(
+    const BiquadCoefficients &from, const BiquadCoefficients &to, float t) {
+  return {
+      from.b0 + (to.b0 - from.b0) * t, from.b1 + (to.b1 - from.b1) * t,
+      from.b2 + (to.b2 - from.b2) * t, from.a1 + (to.a1 - from.a1) * t,
+      from.a2 + (to.a2 - from.a2) * t,
+  };
+}
+
+void BiquadKernel::setNumberOfChannels(std::size_t numberOfChannels) {
+  numberOfChannels_ = numberOfChannels;
+  reserve(numberOfChannels);
+}
+
+std::size_t BiquadKernel::getNumberOfChannels() const {
+  return numberOfChannels_;
+}
+
+void BiquadKernel::reserve(std::size_t numberOfChannels) {
+  auto lanes = (numberOfChannels + 3) / 4 * 4;
+
+  if (s1_.size() < lanes) {
+    s1_.resize(lanes, 0.0f);
+    s2_.resize(lanes, 0.0f);
+  }
+}
+
+void BiquadKernel::reset() {
+  std::fill(s1_.begin(), s1_.end(), 0.0f);
+  std::fill(s2_.begin(), s2_.end(), 0.0f);
+}
+
+void BiquadKernel::process(const BiquadCoefficients &coefficients,
+                           const float *const *input, float *const *output,
+                           std::size_t frames) {
+  processLanes(
+      [&](std::size_t) -> const BiquadCoefficients & { return coefficients; },
+      input, output, frames);
+}
+
+void BiquadKernel::process(const BiquadCoefficients *coefficients,
+                           const float *const *input, float *const *output,
+                           std::size_t frames) {
+  processLanes(
+      [&](std::size_t i) -> const BiquadCoefficients & {
+        return coefficients[i];
+      },
+      input, output, frames);
+}
+
+template <typename CoefficientsAt>
+void BiquadKernel::processLanes(CoefficientsAt coefficientsAt,
+                                const float *const *input,
+                                float *const *output, std::size_t frames) {
+  for (std::size_t group = 0; group < numberOfChannels_; group += 4) {
+    auto lanes = std::min<std::size_t>(4, numberOfChannels_ - group);
+    alignas(16) float x[4] = {};
+    alignas(16) float y[4];
+    auto s1 = Float4::load(s1_.data() + group);
+    auto s2 = Float4::load(s2_.data() + group);
+
+    for (std::size_t i = 0; i < frames; ++i) {
+      const auto &c = coefficientsAt(i);
+
+      for (std::size_t lane = 0; lane < lanes; ++lane) {
+        x[lane] = input[group + lane][i];
+      }
+
+      auto xv = Float4::load(x);
+      auto yv = Float4::broadcast(c.b0) * xv + s1;
+      s1 = Float4::broadcast(c.b1) * xv - Float4::broadcast(c.a1) * yv + s2;
+      s2 = Float4::broadcast(c.b2) * xv - Float4::broadcast(c.a2) * yv;
+      yv.store(y);
+
+      for (std::size_t lane = 0; lane < lanes; ++lane) {
+        output[group + lane][i] = y[lane];
+      }
+    }
+
+    s1.store(s1_.data() + group);
+    s2.store(s2_.data() + group);
+  }
+}
+} // namespace web_audio::detail
\ No newline at end of file
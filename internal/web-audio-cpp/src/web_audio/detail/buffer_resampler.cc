@@ -0,0 +1,146 @@
+#include "web_audio/detail/buffer_resampler.hh"
+
+#include <array>
+#include <cmath>
+#include <numbers>
+
+#include "web_audio/detail/vector_math.hh"
+
+namespace web_audio::detail {
+std::size_t BufferResampler::getHalfWidth(InterpolationQuality quality) {
+  switch (quality) {
+  case InterpolationQuality::eCubic:
+    return 2;
+  case InterpolationQuality::eSinc:
+    return kSincHalfWidth;
+  default:
+    return 1;
+  }
+}
+
+const std::vector<float> &BufferResampler::getSincTable() {
+  static const std::vector<float> table = [] {
+    constexpr auto kTaps = 2 * kSincHalfWidth;
+    std::vector<float> result((kSincPhases + 1) * kTaps);
+
+    for (std::size_t phase = 0; phase <= kSincPhases; ++phase) {
+      auto fraction = static_cast<double>(phase) / kSincPhases;
+      auto *row = &result[phase * kTaps];
+      double sum = 0;
+      std::array<double, kTaps> weights;
+
+      for (std::size_t k = 0; k < kTaps; ++k) {
+        // Tap k reads sample floor(p) - kSincHalfWidth + 1 + k.
+        auto x = static_cast<double>(k) - (kSincHalfWidth - 1) - fraction;
+        auto sinc = x == 0 ? 1.0
+                           : std::sin(std::numbers::pi * x) /
+                                 (std::numbers::pi * x);
+        // Blackman window over (-kSincHalfWidth, kSincHalfWidth).
+        auto w = (x + kSincHalfWidth) / (2.0 * kSincHalfWidth);
+        auto window = 0.42 - 0.5 * std::cos(2 * std::numbers::pi * w) +
+                      0.08 * std::cos(4 * std::numbers::pi * w);
+        weights[k] = sinc * window;
+        sum += weights[k];
+      }
+
+      // Unity gain at DC for every phase.
+      for (std::size_t k = 0; k < kTaps; ++k) {
+        row[k] = static_cast<float>(weights[k] / sum);
+      }
+    }
+
+    return result;
+  }();
+
+  return table;
+}
+
+void BufferResampler::process(InterpolationQuality quality, const float *data,
+                              std::size_t length, LoopRegion loop,
+                              const double *positions, float *output,
+                              std::size_t frames) {
+  switch (quality) {
+  case InterpolationQuality::eLinear:
+    processWith(
+        [](const float *x, float t) { return x[0] + t * (x[1] - x[0]); }, 1,
+        data, length, loop, positions, output, frames);
+    break;
+  case InterpolationQuality::eCubic:
+    // Catmull-Rom spline through x[0]..x[3], evaluated between x[1] and x[2].
+    processWith(
+        [](const float *x, float t) {
+          auto a = -0.5f * x[0] + 1.5f * x[1] - 1.5f * x[2] + 0.5f * x[3];
+          auto b = x[0] - 2.5f * x[1] + 2.0f * x[2] - 0.5f * x[3];
+          auto c = 0.5f * (x[2] - x[0]);
+          return ((a * t + b) * t + c) * t + x[1];
+        },
+        2, data, length, loop, positions, output, frames);
+    break;
+  case InterpolationQuality::eSinc: {
+    const auto *table = getSincTable().data();
+    processWith(
+        [table](const float *x, float t) {
+          constexpr auto kTaps = 2 * kSincHalfWidth;
+          auto phase = t * kSincPhases;
+          auto row = static_cast<std::size_t>(phase);
+          auto blend = phase - static_cast<float>(row);
+          auto y0 = VectorMath::dot(table + row * kTaps, x, kTaps);
+          auto y1 = VectorMath::dot(table + (row + 1) * kTaps, x, kTaps);
+          return y0 + blend * (y1 - y0);
+        },
+        kSincHalfWidth, data, length, loop, positions, output, frames);
+    break;
+  }
+  }
+}
+
+template <typename Interpolate>
+void BufferResampler::processWith(Interpolate interpolate,
+                                  std::size_t halfWidth, const float *data,
+                                  std::size_t length, LoopRegion loop,
+                                  const double *positions, float *output,
+                                  std::size_t frames) {
+  std::array<float, 2 * kSincHalfWidth> taps;
+  auto looping = loop.end > loop.start;
+
+  for (std::size_t i = 0; i < frames; ++i) {
+    auto position = positions[i];
+    auto index = static_cast<std::size_t>(position);
+    auto fraction = static_cast<float>(position - static_cast<double>(index));
+
+    // Taps wrap at a loop boundary only while the playhead is on the loop
+    // side of it.
+    auto wrapsEnd = looping && index < loop.end;
+    auto wrapsStart = looping && index >= loop.start;
+    auto lower = wrapsStart ? loop.start : 0;
+    auto upper = wrapsEnd ? loop.end : length;
+
+    if (index + 1 >= lower + halfWidth && index + halfWidth < upper) {
+      output[i] = interpolate(data + index + 1 - halfWidth, fraction);
+      continue;
+    }
+
+    // Near a boundary, gather the taps one by one.
+    auto loopLength = static_cast<std::ptrdiff_t>(loop.end - loop.start);
+
+    for (std::size_t k = 0; k < 2 * halfWidth; ++k) {
+      auto tap = static_cast<std::ptrdiff_t>(index + k) -
+                 static_cast<std::ptrdiff_t>(halfWidth - 1);
+
+      while (wrapsEnd && tap >= static_cast<std::ptrdiff_t>(loop.end)) {
+        tap -= loopLength;
+      }
+
+      while (wrapsStart && tap < static_cast<std::ptrdiff_t>(loop.start)) {
+        tap += loopLength;
+      }
+
+      taps[k] = tap >= 0 && tap < static_cast<std::ptrdiff_t>(length)
+                    ? data[tap]
+                    : 0.0f;
+    }
+
+    output[i] = interpolate(taps.data(), fraction);
+  }
+}
+} // namespace web_audio::detail
\ No newline at end of file
@@ -0,0 +1,199 @@
+#include "web_audio/detail/compressor_kernel.hh"
+
+#include <algorithm>
+#include <cmath>
+
+#include "web_audio/detail/math_helper.hh"
+#include "web_audio/detail/vector_math.hh"
+
+namespace web_audio::detail {
+namespace {
+// Frames a chunk may hold beyond the lookahead.
+constexpr std::size_t kMinChunkSize = 1024;
+// Peaks below this level do not reach any threshold.
+constexpr float kSilence = 1e-10f;
+constexpr float kRampOffsets[4] = {1, 2, 3, 4};
+
+float toDecibels(float x) { return 20 * std::log10(x); }
+
+float toLinear(float decibels) { return std::pow(10.0f, decibels / 20); }
+
+/**
+ * Coefficient of a one-pole smoother with time constant `time` updated
+ * every `step` frames.
+ */
+float smoothingCoefficient(float time, float step, float sampleRate) {
+  return time > 0 ? std::exp(-step / (time * sampleRate)) : 0.0f;
+}
+
+void writeMirrored(float *line, std::size_t capacity, std::size_t position,
+                   const float *input, std::size_t frames) {
+  auto first = std::min(frames, capacity - position);
+  std::copy(input, input + first, line + position);
+  std::copy(input, input + first, line + capacity + position);
+  std::copy(input + first, input + frames, line);
+  std::copy(input + first, input + frames, line + capacity);
+}
+
+void applyRamp(const float *input, float *output, float from, float step,
+               std::size_t n) {
+  std::size_t i = 0;
+  const auto offsets = Float4::load(kRampOffsets);
+  const auto steps = Float4::broadcast(step);
+
+  for (; i + 4 <= n; i += 4) {
+    auto gain = Float4::broadcast(from + step * i) + offsets * steps;
+    (Float4::load(input + i) * gain).store(output + i);
+  }
+
+  for (; i < n; ++i) {
+    output[i] = input[i] * (from + step * (i + 1));
+  }
+}
+} // namespace
+
+CompressorKernel::CompressorKernel(float sampleRate)
+    : sampleRate_(sampleRate),
+      lookaheadFrames_(
+          static_cast<std::size_t>(std::round(kLookahead * sampleRate))),
+      capacity_(MathHelper::nextPowerOfTwo(lookaheadFrames_ + kMinChunkSize)),
+      delayLines_(kMaxChannels, std::vector<float>(2 * capacity_)) {}
+
+void CompressorKernel::setNumberOfChannels(std::size_t numberOfChannels) {
+  numberOfChannels = std::min(numberOfChannels, kMaxChannels);
+
+  for (auto i = std::max<std::size_t>(numberOfChannels_, 1);
+       i < numberOfChannels; ++i) {
+    delayLines_[i] = delayLines_[0];
+  }
+
+  numberOfChannels_ = numberOfChannels;
+}
+
+std::size_t CompressorKernel::getNumberOfChannels() const {
+  return numberOfChannels_;
+}
+
+std::size_t CompressorKernel::getLookaheadFrames() const {
+  return lookaheadFrames_;
+}
+
+void CompressorKernel::reset() {
+  for (auto &delayLine : delayLines_) {
+    std::fill(delayLine.begin(), delayLine.end(), 0.0f);
+  }
+
+  position_ = 0;
+  envelope_ = 0.0f;
+  gain_ = 1.0f;
+}
+
+void CompressorKernel::process(const float *const *input,
+                               float *const *output, std::size_t frames,
+                               const CompressorParameters &parameters) {
+  auto step = static_cast<float>(kSubBlockSize);
+  auto attack = smoothingCoefficient(parameters.attack, step, sampleRate_);
+  auto release = smoothingCoefficient(parameters.release, step, sampleRate_);
+  // SPEC: Compute the makeup gain: (1 / fullRangeGain) ^ 0.6, where
+  // fullRangeGain is the curve applied to 1.0.
+  auto makeup = -0.6f * computeCurve(0, parameters);
+
+  // Chunks are whole sub-blocks and leave room for the lookahead.
+  auto chunkSize =
+      (capacity_ - lookaheadFrames_) / kSubBlockSize * kSubBlockSize;
+  const float *chunkInput[kMaxChannels];
+  float *chunkOutput[kMaxChannels];
+
+  for (std::size_t offset = 0; offset < frames; offset += chunkSize) {
+    for (std::size_t c = 0; c < numberOfChannels_; ++c) {
+      chunkInput[c] = input[c] + offset;
+      chunkOutput[c] = output[c] + offset;
+    }
+
+    processChunk(chunkInput, chunkOutput, std::min(chunkSize, frames - offset),
+                 parameters, attack, release, makeup);
+  }
+}
+
+float CompressorKernel::getReduction() const { return envelope_; }
+
+float CompressorKernel::computeCurve(float level,
+                                     const CompressorParameters &parameters) {
+  auto threshold = parameters.threshold;
+  auto knee = parameters.knee;
+  auto slope = 1 / parameters.ratio;
+
+  if (level <= threshold) {
+    return level;
+  }
+
+  if (level < threshold + knee) {
+    auto over = level - threshold;
+    return level + (slope - 1) * over * over / (2 * knee);
+  }
+
+  return threshold + knee * (1 + slope) / 2 +
+         (level - threshold - knee) * slope;
+}
+
+float CompressorKernel::detectPeak(const float *const *channels,
+                                   std::size_t numberOfChannels,
+                                   std::size_t offset, std::size_t n) {
+  auto peak = Float4::broadcast(0.0f);
+  float tail = 0.0f;
+
+  for (std::size_t c = 0; c < numberOfChannels; ++c) {
+    const auto *samples = channels[c] + offset;
+    std::size_t i = 0;
+
+    for (; i + 4 <= n; i += 4) {
+      peak = max(peak, abs(Float4::load(samples + i)));
+    }
+
+    for (; i < n; ++i) {
+      tail = std::max(tail, std::fabs(samples[i]));
+    }
+  }
+
+  return std::max(peak.reduceMax(), tail);
+}
+
+void CompressorKernel::processChunk(const float *const *input,
+                                    float *const *output, std::size_t frames,
+                                    const CompressorParameters &parameters,
+                                    float attack, float release,
+                                    float makeup) {
+  for (std::size_t c = 0; c < numberOfChannels_; ++c) {
+    writeMirrored(delayLines_[c].data(), capacity_, position_, input[c],
+                  frames);
+  }
+
+  // The oldest frame of the chunk was written lookaheadFrames_ ago.
+  auto start = (position_ + capacity_ - lookaheadFrames_) & (capacity_ - 1);
+  position_ = (position_ + frames) & (capacity_ - 1);
+
+  for (std::size_t offset = 0; offset < frames; offset += kSubBlockSize) {
+    auto n = std::min(kSubBlockSize, frames - offset);
+    auto peak = detectPeak(input, numberOfChannels_, offset, n);
+    auto target = 0.0f;
+
+    if (peak > kSilence) {
+      auto level = toDecibels(peak);
+      target = computeCurve(level, parameters) - level;
+    }
+
+    auto coefficient = target < envelope_ ? attack : release;
+    envelope_ = target + coefficient * (envelope_ - target);
+
+    auto gain = toLinear(envelope_ + makeup);
+    auto step = (gain - gain_) / static_cast<float>(n);
+
+    for (std::size_t c = 0; c < numberOfChannels_; ++c) {
+      applyRamp(delayLines_[c].data() + start + offset, output[c] + offset,
+                gain_, step, n);
+    }
+
+    gain_ = gain;
+  }
+}
+} // namespace web_audio::detail
\ No newline at end of file
@@ -0,0 +1,202 @@
+#include "web_audio/detail/equal_power_panner.hh"
+
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+
+#include "web_audio/detail/vector_math.hh"
+
+namespace web_audio::detail {
+namespace {
+// Taylor coefficients of cos in theta^2; the first omitted term is below
+// 5e-7 on [0, pi / 2].
+constexpr float kC1 = -1.0f / 2;
+constexpr float kC2 = 1.0f / 24;
+constexpr float kC3 = -1.0f / 720;
+constexpr float kC4 = 1.0f / 40320;
+constexpr float kC5 = -1.0f / 3628800;
+
+template <typename T> T cosinePolynomial(T t, T c1, T c2, T c3, T c4, T c5) {
+  return ((((c5 * t + c4) * t + c3) * t + c2) * t + c1) * t;
+}
+
+void gains(float x, float &left, float &right) {
+  left = static_cast<float>(std::cos(x * std::numbers::pi / 2));
+  right = static_cast<float>(std::sin(x * std::numbers::pi / 2));
+}
+
+/**
+ * Applies per-frame gains. With `side` 1 a stereo frame is panned left and
+ * with 0 right:
+ *   left  = inL * (side + (1 - side) * gainL) + inR * side * gainL
+ *   right = inR * (1 - side + side * gainR) + inL * (1 - side) * gainR
+ */
+void combineStereo(const float *inputLeft, const float *inputRight,
+                   const float *side, const float *gainLeft,
+                   const float *gainRight, float *left, float *right,
+                   std::size_t n) {
+  std::size_t i = 0;
+  const auto one = Float4::broadcast(1.0f);
+
+  for (; i + 4 <= n; i += 4) {
+    auto l = Float4::load(inputLeft + i);
+    auto r = Float4::load(inputRight + i);
+    auto s = Float4::load(side + i);
+    auto o = one - s;
+    auto gl = Float4::load(gainLeft + i);
+    auto gr = Float4::load(gainRight + i);
+    (l * (s + o * gl) + r * (s * gl)).store(left + i);
+    (r * (o + s * gr) + l * (o * gr)).store(right + i);
+  }
+
+  for (; i < n; ++i) {
+    auto l = inputLeft[i];
+    auto r = inputRight[i];
+    auto s = side[i];
+    auto o = 1.0f - s;
+    left[i] = l * (s + o * gainLeft[i]) + r * (s * gainLeft[i]);
+    right[i] = r * (o + s * gainRight[i]) + l * (o * gainRight[i]);
+  }
+}
+} // namespace
+
+void EqualPowerPanner::quarterCosine(const float *x, float *output,
+                                     std::size_t n) {
+  constexpr auto kHalfPi = std::numbers::pi_v<float> / 2;
+  std::size_t i = 0;
+
+  const auto halfPi = Float4::broadcast(kHalfPi);
+  const auto one = Float4::broadcast(1.0f);
+  const auto c1 = Float4::broadcast(kC1);
+  const auto c2 = Float4::broadcast(kC2);
+  const auto c3 = Float4::broadcast(kC3);
+  const auto c4 = Float4::broadcast(kC4);
+  const auto c5 = Float4::broadcast(kC5);
+
+  for (; i + 4 <= n; i += 4) {
+    auto theta = Float4::load(x + i) * halfPi;
+    auto t = theta * theta;
+    (one + cosinePolynomial(t, c1, c2, c3, c4, c5)).store(output + i);
+  }
+
+  for (; i < n; ++i) {
+    auto theta = x[i] * kHalfPi;
+    output[i] = 1.0f + cosinePolynomial(theta * theta, kC1, kC2, kC3, kC4, kC5);
+  }
+}
+
+void EqualPowerPanner::processMono(const float *input, float pan, float *left,
+                                   float *right, std::size_t frames) {
+  float gainLeft, gainRight;
+  gains((std::clamp(pan, -1.0f, 1.0f) + 1) / 2, gainLeft, gainRight);
+
+  std::size_t i = 0;
+  const auto gl = Float4::broadcast(gainLeft);
+  const auto gr = Float4::broadcast(gainRight);
+
+  for (; i + 4 <= frames; i += 4) {
+    auto x = Float4::load(input + i);
+    (x * gl).store(left + i);
+    (x * gr).store(right + i);
+  }
+
+  for (; i < frames; ++i) {
+    auto x = input[i];
+    left[i] = x * gainLeft;
+    right[i] = x * gainRight;
+  }
+}
+
+void EqualPowerPanner::processMono(const float *input, const float *pan,
+                                   float *left, float *right,
+                                   std::size_t frames) {
+  float x[kChunkSize], mirrored[kChunkSize];
+  float gainLeft[kChunkSize], gainRight[kChunkSize];
+
+  for (std::size_t offset = 0; offset < frames; offset += kChunkSize) {
+    auto n = std::min(kChunkSize, frames - offset);
+
+    for (std::size_t i = 0; i < n; ++i) {
+      x[i] = (std::clamp(pan[offset + i], -1.0f, 1.0f) + 1) / 2;
+      mirrored[i] = 1 - x[i];
+    }
+
+    // sin(x * pi / 2) == cos((1 - x) * pi / 2)
+    quarterCosine(x, gainLeft, n);
+    quarterCosine(mirrored, gainRight, n);
+
+    for (std::size_t i = 0; i < n; ++i) {
+      auto value = input[offset + i];
+      left[offset + i] = value * gainLeft[i];
+      right[offset + i] = value * gainRight[i];
+    }
+  }
+}
+
+void EqualPowerPanner::processStereo(const float *inputLeft,
+                                     const float *inputRight, float pan,
+                                     float *left, float *right,
+                                     std::size_t frames) {
+  pan = std::clamp(pan, -1.0f, 1.0f);
+  float gainLeft, gainRight;
+  gains(pan <= 0 ? pan + 1 : pan, gainLeft, gainRight);
+
+  std::size_t i = 0;
+  const auto gl = Float4::broadcast(gainLeft);
+  const auto gr = Float4::broadcast(gainRight);
+
+  if (pan <= 0) {
+    for (; i + 4 <= frames; i += 4) {
+      auto l = Float4::load(inputLeft + i);
+      auto r = Float4::load(inputRight + i);
+      (l + r * gl).store(left + i);
+      (r * gr).store(right + i);
+    }
+
+    for (; i < frames; ++i) {
+      auto l = inputLeft[i];
+      auto r = inputRight[i];
+      left[i] = l + r * gainLeft;
+      right[i] = r * gainRight;
+    }
+  } else {
+    for (; i + 4 <= frames; i += 4) {
+      auto l = Float4::load(inputLeft + i);
+      auto r = Float4::load(inputRight + i);
+      (l * gl).store(left + i);
+      (r + l * gr).store(right + i);
+    }
+
+    for (; i < frames; ++i) {
+      auto l = inputLeft[i];
+      auto r = inputRight[i];
+      left[i] = l * gainLeft;
+      right[i] = r + l * gainRight;
+    }
+  }
+}
+
+void EqualPowerPanner::processStereo(const float *inputLeft,
+                                     const float *inputRight,
+                                     const float *pan, float *left,
+                                     float *right, std::size_t frames) {
+  float x[kChunkSize], mirrored[kChunkSize], side[kChunkSize];
+  float gainLeft[kChunkSize], gainRight[kChunkSize];
+
+  for (std::size_t offset = 0; offset < frames; offset += kChunkSize) {
+    auto n = std::min(kChunkSize, frames - offset);
+
+    for (std::size_t i = 0; i < n; ++i) {
+      auto p = std::clamp(pan[offset + i], -1.0f, 1.0f);
+      side[i] = p <= 0 ? 1.0f : 0.0f;
+      x[i] = p + side[i];
+      mirrored[i] = 1 - x[i];
+    }
+
+    quarterCosine(x, gainLeft, n);
+    quarterCosine(mirrored, gainRight, n);
+    combineStereo(inputLeft + offset, inputRight + offset, side, gainLeft,
+                  gainRight, left + offset, right + offset, n);
+  }
+}
+} // namespace web_audio::detail
\ No newline at end of file
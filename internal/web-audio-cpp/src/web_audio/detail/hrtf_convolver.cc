@@ -0,0 +1,95 @@
+#include "web_audio/detail/hrtf_convolver.hh"
+
+#include <algorithm>
+
+#include "web_audio/detail/math_helper.hh"
+
+namespace web_audio::detail {
+HrtfConvolver::HrtfConvolver(std::size_t partitionSize,
+                             std::size_t partitionCount)
+    : partitionSize_(partitionSize),
+      fftSize_(MathHelper::nextPowerOfTwo(partitionSize * 2)),
+      spectrumSize_(fftSize_ / 2 + 1), partitionCount_(partitionCount),
+      fft_(fftSize_), accumulator_(spectrumSize_), timeBuffer_(fftSize_),
+      fadeLeft_(partitionSize), fadeRight_(partitionSize) {
+  for (auto &channel : channels_) {
+    channel.window.resize(fftSize_);
+    channel.delayLine.resize(partitionCount * spectrumSize_);
+  }
+}
+
+std::size_t HrtfConvolver::getPartitionSize() const { return partitionSize_; }
+
+std::size_t HrtfConvolver::getPartitionCount() const {
+  return partitionCount_;
+}
+
+void HrtfConvolver::process(const float *inputLeft, const float *inputRight,
+                            const HrtfFilter &filter, float *left,
+                            float *right) {
+  auto stereo = inputRight != nullptr;
+
+  // Until now both ears heard the mono history.
+  if (stereo && !stereo_) {
+    channels_[1] = channels_[0];
+  }
+
+  stereo_ = stereo;
+  delayLineIndex_ = (delayLineIndex_ + 1) % partitionCount_;
+  push(channels_[0], inputLeft);
+
+  if (stereo) {
+    push(channels_[1], inputRight);
+  }
+
+  const auto &leftChannel = channels_[0];
+  const auto &rightChannel = channels_[stereo ? 1 : 0];
+  convolve(leftChannel, filter.left, left);
+  convolve(rightChannel, filter.right, right);
+
+  if (filter_ && filter_ != &filter) {
+    convolve(leftChannel, filter_->left, fadeLeft_.data());
+    convolve(rightChannel, filter_->right, fadeRight_.data());
+
+    auto step = 1.0f / static_cast<float>(partitionSize_);
+
+    for (std::size_t i = 0; i < partitionSize_; ++i) {
+      auto t = static_cast<float>(i + 1) * step;
+      left[i] = fadeLeft_[i] + t * (left[i] - fadeLeft_[i]);
+      right[i] = fadeRight_[i] + t * (right[i] - fadeRight_[i]);
+    }
+  }
+
+  filter_ = &filter;
+}
+
+void HrtfConvolver::push(Channel &channel, const float *input) {
+  auto &window = channel.window;
+  std::copy(window.begin() + partitionSize_, window.end(), window.begin());
+  std::copy(input, input + partitionSize_, window.end() - partitionSize_);
+  fft_.forward(window.data(),
+               channel.delayLine.data() + delayLineIndex_ * spectrumSize_);
+}
+
+void HrtfConvolver::convolve(
+    const Channel &channel,
+    const PartitionedImpulseResponse<float> &impulseResponse, float *output) {
+  std::fill(accumulator_.begin(), accumulator_.end(),
+            std::complex<float>(0, 0));
+
+  for (std::size_t p = 0; p < partitionCount_; ++p) {
+    auto slot = (delayLineIndex_ + partitionCount_ - p) % partitionCount_;
+    const auto *x = channel.delayLine.data() + slot * spectrumSize_;
+    const auto *h = impulseResponse.getSpectrum(p);
+
+    for (std::size_t k = 0; k < spectrumSize_; ++k) {
+      accumulator_[k] += std::complex<float>(
+          x[k].real() * h[k].real() - x[k].imag() * h[k].imag(),
+          x[k].real() * h[k].imag() + x[k].imag() * h[k].real());
+    }
+  }
+
+  fft_.inverse(accumulator_.data(), timeBuffer_.data());
+  std::copy(timeBuffer_.end() - partitionSize_, timeBuffer_.end(), output);
+}
+} // namespace web_audio::detail
\ No newline at end of file
@@ -0,0 +1,275 @@
+#include "web_audio/detail/hrtf_database.hh"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+#include <numbers>
+#include <stdexcept>
+
+#include "web_audio/detail/rational_resampler.hh"
+
+namespace web_audio::detail {
+namespace {
+constexpr std::uint32_t kVersion = 1;
+constexpr std::size_t kHeaderSize = 20;
+constexpr std::size_t kNeighbors = 3;
+// Below this angular distance in radians a measurement is used as is.
+constexpr float kExactAngle = 1e-4f;
+
+std::uint32_t readUint32(const std::uint8_t *p) {
+  return static_cast<std::uint32_t>(p[0]) |
+         (static_cast<std::uint32_t>(p[1]) << 8) |
+         (static_cast<std::uint32_t>(p[2]) << 16) |
+         (static_cast<std::uint32_t>(p[3]) << 24);
+}
+
+float readFloat32(const std::uint8_t *p) {
+  return std::bit_cast<float>(readUint32(p));
+}
+
+void toDirection(float azimuth, float elevation, float *direction) {
+  constexpr auto kDegreesToRadians = std::numbers::pi_v<float> / 180;
+  auto a = azimuth * kDegreesToRadians;
+  auto e = elevation * kDegreesToRadians;
+  direction[0] = std::cos(e) * std::sin(a);
+  direction[1] = std::sin(e);
+  direction[2] = std::cos(e) * std::cos(a);
+}
+
+std::vector<float> resample(const RationalResampler &resampler,
+                            const std::vector<float> &input, float scale) {
+  std::vector<float> output(resampler.getOutputLength(input.size()));
+  resampler.process(input.data(), input.size(), 0, output.data(),
+                    output.size());
+
+  for (auto &sample : output) {
+    sample *= scale;
+  }
+
+  return output;
+}
+} // namespace
+
+HrtfDatabase::HrtfDatabase(std::vector<Measurement> measurements)
+    : measurements_(std::move(measurements)) {
+  if (measurements_.empty()) {
+    throw std::invalid_argument("HRIR: no measurements");
+  }
+
+  length_ = measurements_[0].left.size();
+
+  if (length_ == 0) {
+    throw std::invalid_argument("HRIR: empty impulse responses");
+  }
+
+  directions_.resize(measurements_.size() * 3);
+
+  for (std::size_t i = 0; i < measurements_.size(); ++i) {
+    const auto &measurement = measurements_[i];
+
+    if (measurement.left.size() != length_ ||
+        measurement.right.size() != length_) {
+      throw std::invalid_argument("HRIR: impulse response lengths differ");
+    }
+
+    toDirection(measurement.azimuth, measurement.elevation,
+                directions_.data() + i * 3);
+  }
+}
+
+std::shared_ptr<HrtfDatabase>
+HrtfDatabase::parse(std::span<const std::uint8_t> bytes, float sampleRate) {
+  if (bytes.size() < kHeaderSize || std::memcmp(bytes.data(), "HRIR", 4)) {
+    throw std::invalid_argument("HRIR: missing header");
+  }
+
+  if (readUint32(bytes.data() + 4) != kVersion) {
+    throw std::invalid_argument("HRIR: unsupported version");
+  }
+
+  auto fileRate = readFloat32(bytes.data() + 8);
+  std::size_t taps = readUint32(bytes.data() + 12);
+  std::size_t count = readUint32(bytes.data() + 16);
+  auto recordSize = (2 + 2 * taps) * sizeof(float);
+
+  if (!(fileRate > 0) || taps == 0 || count == 0 ||
+      (bytes.size() - kHeaderSize) / recordSize < count) {
+    throw std::invalid_argument("HRIR: truncated or invalid dataset");
+  }
+
+  std::vector<Measurement> measurements(count);
+  const auto *p = bytes.data() + kHeaderSize;
+
+  auto readImpulseResponse = [&](std::vector<float> &samples) {
+    samples.resize(taps);
+
+    for (auto &sample : samples) {
+      sample = readFloat32(p);
+      p += sizeof(float);
+    }
+  };
+
+  for (auto &measurement : measurements) {
+    measurement.azimuth = readFloat32(p);
+    measurement.elevation = readFloat32(p + 4);
+    p += 8;
+    readImpulseResponse(measurement.left);
+    readImpulseResponse(measurement.right);
+  }
+
+  if (fileRate != sampleRate) {
+    RationalResampler resampler(fileRate, sampleRate);
+    // The responses get more taps per second at a higher rate, which would
+    // raise the gain of the filters by the same ratio.
+    auto scale = fileRate / sampleRate;
+
+    for (auto &measurement : measurements) {
+      measurement.left = resample(resampler, measurement.left, scale);
+      measurement.right = resample(resampler, measurement.right, scale);
+    }
+  }
+
+  return std::make_shared<HrtfDatabase>(std::move(measurements));
+}
+
+std::shared_ptr<HrtfDatabase> HrtfDatabase::load(const std::string &path,
+                                                 float sampleRate) {
+  std::ifstream file(path, std::ios::binary);
+
+  if (!file) {
+    throw std::runtime_error("Failed to open " + path);
+  }
+
+  std::vector<std::uint8_t> bytes((std::istreambuf_iterator<char>(file)),
+                                  std::istreambuf_iterator<char>());
+  return parse(bytes, sampleRate);
+}
+
+std::size_t HrtfDatabase::getLength() const { return length_; }
+
+std::size_t HrtfDatabase::getMeasurementCount() const {
+  return measurements_.size();
+}
+
+void HrtfDatabase::interpolate(float azimuth, float elevation, float *left,
+                               float *right) const {
+  float direction[3];
+  toDirection(azimuth, elevation, direction);
+
+  // Indices of the nearest measurements, nearest first.
+  std::array<std::size_t, kNeighbors> nearest{};
+  std::array<float, kNeighbors> cosines;
+  cosines.fill(-2);
+  auto neighbors = std::min(kNeighbors, measurements_.size());
+
+  for (std::size_t i = 0; i < measurements_.size(); ++i) {
+    const auto *d = directions_.data() + i * 3;
+    auto cosine =
+        d[0] * direction[0] + d[1] * direction[1] + d[2] * direction[2];
+
+    for (std::size_t n = 0; n < neighbors; ++n) {
+      if (cosine > cosines[n]) {
+        std::copy_backward(nearest.begin() + n, nearest.begin() + neighbors - 1,
+                           nearest.begin() + neighbors);
+        std::copy_backward(cosines.begin() + n, cosines.begin() + neighbors - 1,
+                           cosines.begin() + neighbors);
+        nearest[n] = i;
+        cosines[n] = cosine;
+        break;
+      }
+    }
+  }
+
+  std::array<float, kNeighbors> weights{};
+  float total = 0;
+
+  for (std::size_t n = 0; n < neighbors; ++n) {
+    auto angle = std::acos(std::clamp(cosines[n], -1.0f, 1.0f));
+
+    if (angle < kExactAngle) {
+      weights.fill(0);
+      weights[n] = total = 1;
+      break;
+    }
+
+    weights[n] = 1 / angle;
+    total += weights[n];
+  }
+
+  std::fill(left, left + length_, 0.0f);
+  std::fill(right, right + length_, 0.0f);
+
+  for (std::size_t n = 0; n < neighbors; ++n) {
+    if (weights[n] == 0) {
+      continue;
+    }
+
+    auto weight = weights[n] / total;
+    const auto &measurement = measurements_[nearest[n]];
+
+    for (std::size_t i = 0; i < length_; ++i) {
+      left[i] += weight * measurement.left[i];
+      right[i] += weight * measurement.right[i];
+    }
+  }
+}
+
+std::shared_ptr<const HrtfFilter>
+HrtfDatabase::getFilter(float azimuth, float elevation,
+                        std::size_t partitionSize) {
+  Key key{static_cast<std::int32_t>(std::lround(azimuth / kAngleStep)),
+          static_cast<std::int32_t>(std::lround(elevation / kAngleStep)),
+          partitionSize};
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    if (auto it = entries_.find(key); it != entries_.end()) {
+      order_.splice(order_.begin(), order_, it->second.position);
+      return it->second.filter;
+    }
+  }
+
+  // Interpolate outside the lock; a concurrent miss on the same key only
+  // wastes work.
+  std::vector<float> left(length_), right(length_);
+  interpolate(key.azimuth * kAngleStep, key.elevation * kAngleStep,
+              left.data(), right.data());
+
+  auto filter = std::make_shared<const HrtfFilter>(HrtfFilter{
+      PartitionedImpulseResponse<float>(left, 0, length_, partitionSize),
+      PartitionedImpulseResponse<float>(right, 0, length_, partitionSize)});
+
+  std::lock_guard<std::mutex> lock(mutex_);
+
+  if (auto it = entries_.find(key); it != entries_.end()) {
+    return it->second.filter;
+  }
+
+  if (entries_.size() == kCacheCapacity) {
+    entries_.erase(order_.back());
+    order_.pop_back();
+  }
+
+  order_.push_front(key);
+  entries_.emplace(key, Entry{filter, order_.begin()});
+  return filter;
+}
+
+std::size_t HrtfDatabase::getCacheSize() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  return entries_.size();
+}
+
+std::size_t HrtfDatabase::KeyHash::operator()(const Key &key) const {
+  auto result = static_cast<std::size_t>(key.azimuth) * 0x9e3779b97f4a7c15ull;
+  result ^= static_cast<std::size_t>(key.elevation) + (result << 6) +
+            (result >> 2);
+  result ^= key.partitionSize + (result << 6) + (result >> 2);
+  return result;
+}
+} // namespace web_audio::detail
\ No newline at end of file
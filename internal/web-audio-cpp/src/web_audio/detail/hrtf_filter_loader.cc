@@ -0,0 +1,181 @@
+#include "web_audio/detail/hrtf_filter_loader.hh"
+
+#include <cmath>
+#include <utility>
+
+#include "web_audio/base_audio_context.hh"
+#include "web_audio/detail/worker_pool.hh"
+
+namespace web_audio::detail {
+class HrtfFilterLoader::LoadTask final : public WorkerTask {
+public:
+  explicit LoadTask(std::shared_ptr<State> state) : state_(std::move(state)) {}
+
+  void run() override {
+    state_->load(state_->requested.load(std::memory_order_relaxed));
+    state_->scheduled.store(false, std::memory_order_release);
+  }
+
+private:
+  std::shared_ptr<State> state_;
+};
+
+HrtfFilterLoader::HrtfFilterLoader(std::weak_ptr<BaseAudioContext> context,
+                                   std::size_t partitionSize)
+    : state_(std::make_shared<State>()),
+      task_(std::make_shared<LoadTask>(state_)) {
+  state_->context = std::move(context);
+  state_->partitionSize = partitionSize;
+  // Starts the pool here rather than on the rendering thread.
+  WorkerPool::getBackground();
+}
+
+void HrtfFilterLoader::preload(float azimuth, float elevation) {
+  auto context = state_->context.lock();
+
+  // Loads never overlap; if one is queued, the rendering thread gets the
+  // filter from the worker instead.
+  if (!context ||
+      state_->scheduled.exchange(true, std::memory_order_acq_rel)) {
+    return;
+  }
+
+  state_->load(
+      makeKey(azimuth, elevation, context->getHrtfDatabaseGeneration()));
+  state_->scheduled.store(false, std::memory_order_release);
+}
+
+const HrtfFilter *HrtfFilterLoader::find(float azimuth, float elevation,
+                                         std::uint32_t generation) {
+  auto key = makeKey(azimuth, elevation, generation);
+
+  if (current_ && current_->key == key) {
+    return getCurrentFilter();
+  }
+
+  for (auto &slot : state_->slots) {
+    std::uint8_t expected = kReady;
+
+    // The key is only read once the slot is published.
+    if (slot.state.load(std::memory_order_acquire) != kReady ||
+        slot.key != key ||
+        !slot.state.compare_exchange_strong(expected, kInUse,
+                                            std::memory_order_acquire)) {
+      continue;
+    }
+
+    if (previous_) {
+      previous_->state.store(kRetired, std::memory_order_release);
+    }
+
+    previous_ = current_;
+    current_ = &slot;
+
+    // The replaced convolver is released with the slot.
+    if (slot.convolver) {
+      std::swap(convolver_, slot.convolver);
+      state_->partitionCount.store(convolver_->getPartitionCount(),
+                                   std::memory_order_release);
+    }
+
+    return getCurrentFilter();
+  }
+
+  request(key);
+  return getCurrentFilter();
+}
+
+HrtfConvolver &HrtfFilterLoader::getConvolver() { return *convolver_; }
+
+void HrtfFilterLoader::State::load(std::uint64_t key) {
+  for (auto &slot : slots) {
+    if (slot.state.load(std::memory_order_acquire) == kRetired) {
+      slot.filter.reset();
+      slot.convolver.reset();
+      slot.state.store(kFree, std::memory_order_release);
+    }
+  }
+
+  for (auto &slot : slots) {
+    auto state = slot.state.load(std::memory_order_acquire);
+
+    if ((state == kReady || state == kInUse) && slot.key == key) {
+      return;
+    }
+  }
+
+  std::shared_ptr<const HrtfFilter> filter;
+
+  if (auto context = this->context.lock()) {
+    if (auto database = context->getHrtfDatabase()) {
+      auto azimuth = static_cast<std::int16_t>(key >> 48);
+      auto elevation = static_cast<std::int16_t>(key >> 32);
+      filter = database->getFilter(azimuth * HrtfDatabase::kAngleStep,
+                                   elevation * HrtfDatabase::kAngleStep,
+                                   partitionSize);
+    }
+  }
+
+  // Free slots first, then published ones the rendering thread did not take.
+  for (auto claimable : {kFree, kReady}) {
+    for (auto &slot : slots) {
+      std::uint8_t expected = claimable;
+
+      if (!slot.state.compare_exchange_strong(expected, kWriting,
+                                              std::memory_order_acquire)) {
+        continue;
+      }
+
+      slot.key = key;
+      slot.convolver.reset();
+
+      if (filter && filter->left.getPartitionCount() !=
+                        partitionCount.load(std::memory_order_acquire)) {
+        slot.convolver = std::make_unique<HrtfConvolver>(
+            partitionSize, filter->left.getPartitionCount());
+      }
+
+      slot.filter = std::move(filter);
+      slot.state.store(kReady, std::memory_order_release);
+      return;
+    }
+  }
+
+  // Every slot is in use; the rendering thread asks again.
+}
+
+std::uint64_t HrtfFilterLoader::makeKey(float azimuth, float elevation,
+                                        std::uint32_t generation) {
+  auto quantize = [](float angle) {
+    auto step = std::lround(angle / HrtfDatabase::kAngleStep);
+    return static_cast<std::uint16_t>(static_cast<std::int16_t>(step));
+  };
+
+  return std::uint64_t{quantize(azimuth)} << 48 |
+         std::uint64_t{quantize(elevation)} << 32 | generation;
+}
+
+void HrtfFilterLoader::request(std::uint64_t key) {
+  state_->requested.store(key, std::memory_order_relaxed);
+
+  // A load already queued picks up the new key; one that has just read the
+  // old key misses it, and the next quantum asks again.
+  if (state_->scheduled.exchange(true, std::memory_order_acq_rel)) {
+    return;
+  }
+
+  if (!WorkerPool::getBackground().submit(task_)) {
+    state_->scheduled.store(false, std::memory_order_release);
+  }
+}
+
+const HrtfFilter *HrtfFilterLoader::getCurrentFilter() const {
+  if (!current_ || !current_->filter || !convolver_ ||
+      convolver_->getPartitionCount() !=
+          current_->filter->left.getPartitionCount()) {
+    return nullptr;
+  }
+
+  return current_->filter.get();
+}
+} // namespace web_audio::detail
\ No newline at end of file
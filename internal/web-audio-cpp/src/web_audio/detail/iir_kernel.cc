@@ -0,0 +1,297 @@
+#include "web_audio/detail/iir_kernel.hh"
+
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+
+namespace web_audio::detail {
+namespace {
+std::complex<double> evaluate(const std::vector<double> &coefficients,
+                              std::complex<double> z) {
+  // Horner in z^-1.
+  std::complex<double> result = 0;
+  auto inverse = 1.0 / z;
+
+  for (auto it = coefficients.rbegin(); it != coefficients.rend(); ++it) {
+    result = result * inverse + *it;
+  }
+
+  return result;
+}
+
+/**
+ * Groups roots into factors (1 - r1 z^-1)(1 - r2 z^-1), pairing complex
+ * conjugates. Returns {c1, c2} of 1 + c1 z^-1 + c2 z^-2 per factor.
+ */
+std::vector<std::pair<double, double>>
+toQuadraticFactors(std::vector<std::complex<double>> roots) {
+  constexpr double kImaginaryTolerance = 1e-9;
+  std::vector<double> reals;
+  std::vector<std::pair<double, double>> factors;
+
+  // Largest magnitude first. The poles of a stable filter lie inside the unit
+  // circle, so the most resonant poles come first and share a section with
+  // the largest zeros, which are sorted the same way.
+  std::sort(roots.begin(), roots.end(), [](const auto &a, const auto &b) {
+    return std::abs(a) > std::abs(b);
+  });
+
+  for (const auto &root : roots) {
+    if (std::abs(root.imag()) <= kImaginaryTolerance * (1 + std::abs(root))) {
+      reals.push_back(root.real());
+    } else if (root.imag() > 0) {
+      factors.emplace_back(-2 * root.real(), std::norm(root));
+    }
+  }
+
+  for (std::size_t i = 0; i < reals.size(); i += 2) {
+    if (i + 1 < reals.size()) {
+      factors.emplace_back(-(reals[i] + reals[i + 1]), reals[i] * reals[i + 1]);
+    } else {
+      factors.emplace_back(-reals[i], 0.0);
+    }
+  }
+
+  return factors;
+}
+} // namespace
+
+IIRKernel::IIRKernel(const std::vector<double> &feedforward,
+                     const std::vector<double> &feedback) {
+  order_ = std::max(feedforward.size(), feedback.size()) - 1;
+  b_.assign(order_ + 1, 0.0);
+  a_.assign(order_ + 1, 0.0);
+
+  for (std::size_t i = 0; i < feedforward.size(); ++i) {
+    b_[i] = feedforward[i] / feedback[0];
+  }
+
+  for (std::size_t i = 0; i < feedback.size(); ++i) {
+    a_[i] = feedback[i] / feedback[0];
+  }
+
+  if (auto sections = toSecondOrderSections(feedforward, feedback)) {
+    sectionCoefficients_ = std::move(*sections);
+    sections_.resize(sectionCoefficients_.size());
+  }
+}
+
+void IIRKernel::setNumberOfChannels(std::size_t numberOfChannels) {
+  numberOfChannels_ = numberOfChannels;
+
+  for (auto &section : sections_) {
+    section.setNumberOfChannels(numberOfChannels);
+  }
+
+  reserve(numberOfChannels);
+}
+
+std::size_t IIRKernel::getNumberOfChannels() const {
+  return numberOfChannels_;
+}
+
+void IIRKernel::reserve(std::size_t numberOfChannels) {
+  for (auto &section : sections_) {
+    section.reserve(numberOfChannels);
+  }
+
+  if (!isCascade() && state_.size() < numberOfChannels * order_) {
+    state_.resize(numberOfChannels * order_, 0.0);
+  }
+}
+
+void IIRKernel::reset() {
+  for (auto &section : sections_) {
+    section.reset();
+  }
+
+  std::fill(state_.begin(), state_.end(), 0.0);
+}
+
+bool IIRKernel::isCascade() const { return !sections_.empty(); }
+
+void IIRKernel::process(const float *const *input, float *const *output,
+                        std::size_t frames) {
+  if (isCascade()) {
+    sections_[0].process(sectionCoefficients_[0], input, output, frames);
+
+    for (std::size_t s = 1; s < sections_.size(); ++s) {
+      sections_[s].process(sectionCoefficients_[s], output, output, frames);
+    }
+
+    return;
+  }
+
+  for (std::size_t ch = 0; ch < numberOfChannels_; ++ch) {
+    auto *state = state_.data() + ch * order_;
+
+    for (std::size_t i = 0; i < frames; ++i) {
+      double x = input[ch][i];
+      double y = b_[0] * x + (order_ > 0 ? state[0] : 0.0);
+
+      for (std::size_t k = 0; k + 1 < order_; ++k) {
+        state[k] = b_[k + 1] * x - a_[k + 1] * y + state[k + 1];
+      }
+
+      if (order_ > 0) {
+        state[order_ - 1] = b_[order_] * x - a_[order_] * y;
+      }
+
+      output[ch][i] = static_cast<float>(y);
+    }
+  }
+}
+
+std::optional<std::vector<BiquadCoefficients>>
+IIRKernel::toSecondOrderSections(const std::vector<double> &feedforward,
+                                 const std::vector<double> &feedback) {
+  // A leading zero would need a pure delay section.
+  if (feedforward.empty() || feedback.empty() || feedforward[0] == 0.0 ||
+      feedback[0] == 0.0) {
+    return std::nullopt;
+  }
+
+  auto trim = [](std::vector<double> coefficients) {
+    while (coefficients.size() > 1 && coefficients.back() == 0.0) {
+      coefficients.pop_back();
+    }
+
+    return coefficients;
+  };
+
+  auto b = trim(feedforward);
+  auto a = trim(feedback);
+
+  if (std::max(b.size(), a.size()) <= 3) {
+    b.resize(3, 0.0);
+    a.resize(3, 0.0);
+    return std::vector<BiquadCoefficients>{{
+        static_cast<float>(b[0] / a[0]),
+        static_cast<float>(b[1] / a[0]),
+        static_cast<float>(b[2] / a[0]),
+        static_cast<float>(a[1] / a[0]),
+        static_cast<float>(a[2] / a[0]),
+    }};
+  }
+
+  auto zeros = toQuadraticFactors(findRoots(b));
+  auto poles = toQuadraticFactors(findRoots(a));
+
+  for (const auto &factors : {zeros, poles}) {
+    for (const auto &[c1, c2] : factors) {
+      if (!std::isfinite(c1) || !std::isfinite(c2)) {
+        return std::nullopt;
+      }
+    }
+  }
+
+  auto count = std::max(zeros.size(), poles.size());
+  zeros.resize(count, {0.0, 0.0});
+  poles.resize(count, {0.0, 0.0});
+
+  std::vector<BiquadCoefficients> sections;
+  auto gain = b[0] / a[0];
+
+  for (std::size_t s = 0; s < count; ++s) {
+    auto g = s == 0 ? gain : 1.0;
+    sections.push_back({
+        static_cast<float>(g),
+        static_cast<float>(g * zeros[s].first),
+        static_cast<float>(g * zeros[s].second),
+        static_cast<float>(poles[s].first),
+        static_cast<float>(poles[s].second),
+    });
+  }
+
+  // Check the factorization against the original response.
+  constexpr int kCheckPoints = 32;
+
+  for (int i = 0; i <= kCheckPoints; ++i) {
+    auto omega = std::numbers::pi * i / kCheckPoints;
+    auto z = std::polar(1.0, omega);
+    auto expected = evaluate(feedforward, z) / evaluate(feedback, z);
+    std::complex<double> actual = 1.0;
+
+    for (const auto &section : sections) {
+      actual *= evaluate({section.b0, section.b1, section.b2}, z) /
+                evaluate({1.0, section.a1, section.a2}, z);
+    }
+
+    if (!(std::abs(actual - expected) <= 1e-3 * (1 + std::abs(expected)))) {
+      return std::nullopt;
+    }
+  }
+
+  return sections;
+}
+
+std::vector<std::complex<double>>
+IIRKernel::findRoots(const std::vector<double> &coefficients) {
+  auto degree = coefficients.size() - 1;
+  std::vector<std::complex<double>> roots(degree);
+
+  if (degree == 0) {
+    return roots;
+  }
+
+  std::vector<double> monic(coefficients.size());
+
+  for (std::size_t i = 0; i < coefficients.size(); ++i) {
+    monic[i] = coefficients[i] / coefficients[0];
+  }
+
+  // Cauchy bound for the initial circle.
+  double radius = 0;
+
+  for (std::size_t i = 1; i < monic.size(); ++i) {
+    radius = std::max(radius, std::abs(monic[i]));
+  }
+
+  radius += 1;
+
+  for (std::size_t i = 0; i < degree; ++i) {
+    auto angle = 2 * std::numbers::pi * (i + 0.25) / degree;
+    roots[i] = std::polar(radius, angle);
+  }
+
+  constexpr int kMaxIterations = 500;
+
+  for (int iteration = 0; iteration < kMaxIterations; ++iteration) {
+    double maxCorrection = 0;
+
+    for (std::size_t i = 0; i < degree; ++i) {
+      std::complex<double> p = monic[0];
+      std::complex<double> dp = 0;
+
+      for (std::size_t k = 1; k < monic.size(); ++k) {
+        dp = dp * roots[i] + p;
+        p = p * roots[i] + monic[k];
+      }
+
+      if (p == 0.0) {
+        continue;
+      }
+
+      auto ratio = p / dp;
+      std::complex<double> repulsion = 0;
+
+      for (std::size_t j = 0; j < degree; ++j) {
+        if (j != i) {
+          repulsion += 1.0 / (roots[i] - roots[j]);
+        }
+      }
+
+      auto correction = ratio / (1.0 - ratio * repulsion);
+      roots[i] -= correction;
+      maxCorrection = std::max(maxCorrection, std::abs(correction) /
+                                                  (1 + std::abs(roots[i])));
+    }
+
+    if (maxCorrection < 1e-14) {
+      break;
+    }
+  }
+
+  return roots;
+}
+} // namespace web_audio::detail
\ No newline at end of file
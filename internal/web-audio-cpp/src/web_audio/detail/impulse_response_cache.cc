@@ -0,0 +1,89 @@
+#include "web_audio/detail/impulse_response_cache.hh"
+
+#include <algorithm>
+#include <bit>
+
+namespace web_audio::detail {
+std::shared_ptr<const ConvolverKernel<float>>
+ImpulseResponseCache::acquire(const std::vector<float> &impulseResponse,
+                              std::size_t blockSize) {
+  Key key{hash(impulseResponse), impulseResponse.size(), blockSize};
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+
+    if (auto it = find(key, impulseResponse); it != entries_.end()) {
+      if (auto kernel = it->second.kernel.lock()) {
+        return kernel;
+      }
+    }
+  }
+
+  // Build outside the lock; a concurrent build of the same key only wastes
+  // work, and whichever finishes last is kept.
+  auto kernel =
+      std::make_shared<const ConvolverKernel<float>>(impulseResponse, blockSize);
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  prune();
+
+  if (auto it = find(key, impulseResponse); it != entries_.end()) {
+    it->second.kernel = kernel;
+  } else {
+    entries_.emplace(key, Entry{impulseResponse, kernel});
+  }
+
+  return kernel;
+}
+
+std::size_t ImpulseResponseCache::getSize() {
+  std::lock_guard<std::mutex> lock(mutex_);
+  prune();
+  return entries_.size();
+}
+
+std::uint64_t
+ImpulseResponseCache::hash(const std::vector<float> &impulseResponse) {
+  // FNV-1a over the sample bit patterns.
+  std::uint64_t result = 14695981039346656037ull;
+
+  for (auto sample : impulseResponse) {
+    auto bits = std::bit_cast<std::uint32_t>(sample);
+
+    for (int i = 0; i < 4; ++i) {
+      result ^= (bits >> (i * 8)) & 0xff;
+      result *= 1099511628211ull;
+    }
+  }
+
+  return result;
+}
+
+std::size_t ImpulseResponseCache::KeyHash::operator()(const Key &key) const {
+  auto result = key.hash;
+  result ^= key.length + 0x9e3779b97f4a7c15ull + (result << 6) + (result >> 2);
+  result ^=
+      key.blockSize + 0x9e3779b97f4a7c15ull + (result << 6) + (result >> 2);
+  return static_cast<std::size_t>(result);
+}
+
+std::unordered_multimap<ImpulseResponseCache::Key,
+                        ImpulseResponseCache::Entry,
+                        ImpulseResponseCache::KeyHash>::iterator
+ImpulseResponseCache::find(const Key &key,
+                           const std::vector<float> &impulseResponse) {
+  auto [begin, end] = entries_.equal_range(key);
+  auto it = std::find_if(begin, end, [&](const auto &entry) {
+    return std::equal(impulseResponse.begin(), impulseResponse.end(),
+                      entry.second.impulseResponse.begin(),
+                      entry.second.impulseResponse.end());
+  });
+  return it == end ? entries_.end() : it;
+}
+
+void ImpulseResponseCache::prune() {
+  std::erase_if(entries_, [](const auto &entry) {
+    return entry.second.kernel.expired();
+  });
+}
+} // namespace web_audio::detail
\ No newline at end of file
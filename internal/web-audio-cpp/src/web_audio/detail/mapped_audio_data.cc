@@ -0,0 +1,351 @@
+#include "web_audio/detail/mapped_audio_data.hh"
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <stdexcept>
+#include <thread>
+
+#if defined(_WIN32)
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace web_audio::detail {
+class MappedAudioData::ConversionTask final : public WorkerTask {
+public:
+  explicit ConversionTask(MappedAudioData &data) : data_(data) {}
+
+  void run() override {
+    data_.convertRequested();
+    // Last access; the data may be destroyed as soon as this is cleared.
+    data_.conversionScheduled_.store(false, std::memory_order_release);
+  }
+
+private:
+  MappedAudioData &data_;
+};
+
+MappedAudioData::MappedAudioData(const std::string &path,
+                                 MappedSampleFormat format,
+                                 std::uint32_t numberOfChannels,
+                                 std::uint64_t byteOffset,
+                                 std::uint32_t length)
+    : format_(format), numberOfChannels_(numberOfChannels), length_(length) {
+  auto sampleSize = getSampleSize(format);
+
+  if (format == MappedSampleFormat::eFloat32Planar &&
+      byteOffset % sampleSize != 0) {
+    throw std::invalid_argument(
+        "MappedAudioData: planar data must be aligned to the sample size");
+  }
+
+  if (getAvailableFrames(path, format, numberOfChannels, byteOffset) <
+      length) {
+    throw std::invalid_argument("MappedAudioData: file is too short");
+  }
+
+  auto dataSize = static_cast<std::size_t>(length) * numberOfChannels *
+                  sampleSize;
+  mappingSize_ = static_cast<std::size_t>(byteOffset) + dataSize;
+
+#if defined(_WIN32)
+  fileHandle_ = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ,
+                            nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL,
+                            nullptr);
+
+  if (fileHandle_ == INVALID_HANDLE_VALUE) {
+    fileHandle_ = nullptr;
+    throw std::runtime_error("MappedAudioData: cannot open " + path);
+  }
+
+  mappingHandle_ = CreateFileMappingA(fileHandle_, nullptr, PAGE_READONLY, 0,
+                                      0, nullptr);
+  auto *view = mappingHandle_ ? MapViewOfFile(mappingHandle_, FILE_MAP_READ,
+                                              0, 0, mappingSize_)
+                              : nullptr;
+
+  if (!view) {
+    if (mappingHandle_) {
+      CloseHandle(mappingHandle_);
+    }
+
+    CloseHandle(fileHandle_);
+    throw std::runtime_error("MappedAudioData: cannot map " + path);
+  }
+#else
+  auto fd = open(path.c_str(), O_RDONLY);
+
+  if (fd < 0) {
+    throw std::runtime_error("MappedAudioData: cannot open " + path);
+  }
+
+  auto *view = mmap(nullptr, mappingSize_, PROT_READ, MAP_PRIVATE, fd, 0);
+  // The mapping keeps the file alive.
+  close(fd);
+
+  if (view == MAP_FAILED) {
+    throw std::runtime_error("MappedAudioData: cannot map " + path);
+  }
+#endif
+
+  mapping_ = static_cast<const std::byte *>(view);
+  samples_ = mapping_ + byteOffset;
+
+  if (format != MappedSampleFormat::eFloat32Planar) {
+    blockCount_ = (static_cast<std::size_t>(length) + kBlockFrames - 1) /
+                  kBlockFrames;
+    converted_.reset(
+        new float[static_cast<std::size_t>(length) * numberOfChannels]);
+    blockStates_ = std::make_unique<std::atomic<std::uint8_t>[]>(blockCount_);
+
+    for (std::size_t block = 0; block < blockCount_; ++block) {
+      blockStates_[block].store(kEmpty, std::memory_order_relaxed);
+    }
+
+    conversionTask_ = std::make_shared<ConversionTask>(*this);
+    // Starts the pool here rather than on the rendering thread.
+    WorkerPool::getBackground();
+  }
+}
+
+MappedAudioData::~MappedAudioData() noexcept {
+  // A queued conversion holds a reference to this.
+  while (conversionScheduled_.load(std::memory_order_acquire)) {
+    std::this_thread::yield();
+  }
+
+#if defined(_WIN32)
+  UnmapViewOfFile(mapping_);
+  CloseHandle(mappingHandle_);
+  CloseHandle(fileHandle_);
+#else
+  munmap(const_cast<std::byte *>(mapping_), mappingSize_);
+#endif
+}
+
+std::uint64_t MappedAudioData::getAvailableFrames(
+    const std::string &path, MappedSampleFormat format,
+    std::uint32_t numberOfChannels, std::uint64_t byteOffset) {
+  std::error_code error;
+  auto fileSize = std::filesystem::file_size(path, error);
+
+  if (error) {
+    throw std::runtime_error("MappedAudioData: cannot open " + path);
+  }
+
+  if (fileSize <= byteOffset || numberOfChannels == 0) {
+    return 0;
+  }
+
+  return (fileSize - byteOffset) / (getSampleSize(format) * numberOfChannels);
+}
+
+std::size_t MappedAudioData::getSampleSize(MappedSampleFormat format) {
+  switch (format) {
+  case MappedSampleFormat::eInt16Interleaved:
+    return 2;
+  default:
+    return 4;
+  }
+}
+
+std::uint32_t MappedAudioData::getLength() const { return length_; }
+
+std::uint32_t MappedAudioData::getNumberOfChannels() const {
+  return numberOfChannels_;
+}
+
+const float *MappedAudioData::acquire(std::uint32_t channel,
+                                      std::uint32_t startFrame,
+                                      std::uint32_t frames) {
+  auto offset = static_cast<std::size_t>(channel) * length_;
+
+  if (format_ == MappedSampleFormat::eFloat32Planar) {
+    return reinterpret_cast<const float *>(samples_) + offset;
+  }
+
+  if (frames > 0 && startFrame < length_) {
+    auto endFrame = std::min<std::size_t>(
+        static_cast<std::size_t>(startFrame) + frames, length_);
+
+    for (auto block = startFrame / kBlockFrames;
+         block <= (endFrame - 1) / kBlockFrames; ++block) {
+      while (!tryConvertBlock(block)) {
+        // Another thread is converting this block.
+        std::this_thread::yield();
+      }
+    }
+  }
+
+  return converted_.get() + offset;
+}
+
+const float *MappedAudioData::tryAcquire(std::uint32_t channel,
+                                         std::uint32_t startFrame,
+                                         std::uint32_t frames) {
+  auto offset = static_cast<std::size_t>(channel) * length_;
+
+  if (format_ == MappedSampleFormat::eFloat32Planar) {
+    return reinterpret_cast<const float *>(samples_) + offset;
+  }
+
+  if (frames == 0 || startFrame >= length_) {
+    return converted_.get() + offset;
+  }
+
+  auto endFrame =
+      std::min<std::size_t>(static_cast<std::size_t>(startFrame) + frames,
+                            length_);
+  auto firstBlock = static_cast<std::size_t>(startFrame) / kBlockFrames;
+  auto lastBlock = (endFrame - 1) / kBlockFrames;
+
+  for (auto block = firstBlock; block <= lastBlock; ++block) {
+    if (blockStates_[block].load(std::memory_order_acquire) != kReady) {
+      underruns_.fetch_add(1, std::memory_order_relaxed);
+      request(block, lastBlock + 1 + kReadAheadBlocks);
+      return nullptr;
+    }
+  }
+
+  // Keep the blocks about to be played converted.
+  auto next = lastBlock + 1;
+
+  if (next < blockCount_ &&
+      blockStates_[next].load(std::memory_order_relaxed) == kEmpty) {
+    request(next, next + kReadAheadBlocks);
+  }
+
+  return converted_.get() + offset;
+}
+
+std::uint64_t MappedAudioData::getUnderrunCount() const {
+  return underruns_.load(std::memory_order_relaxed);
+}
+
+void MappedAudioData::prefetch(std::uint32_t startFrame,
+                               std::uint32_t frames) {
+  if (startFrame >= length_) {
+    return;
+  }
+
+  frames = std::min(frames, length_ - startFrame);
+  auto sampleSize = getSampleSize(format_);
+
+  if (format_ == MappedSampleFormat::eFloat32Planar) {
+    for (std::uint32_t ch = 0; ch < numberOfChannels_; ++ch) {
+      advise(samples_ +
+                 (static_cast<std::size_t>(ch) * length_ + startFrame) *
+                     sampleSize,
+             static_cast<std::size_t>(frames) * sampleSize);
+    }
+  } else {
+    auto frameSize = sampleSize * numberOfChannels_;
+    advise(samples_ + static_cast<std::size_t>(startFrame) * frameSize,
+           static_cast<std::size_t>(frames) * frameSize);
+
+    // The first block is needed as soon as playback starts.
+    acquire(0, startFrame, 1);
+    auto endFrame = static_cast<std::size_t>(startFrame) + frames;
+    request(startFrame / kBlockFrames + 1,
+            (endFrame + kBlockFrames - 1) / kBlockFrames);
+  }
+}
+
+bool MappedAudioData::tryConvertBlock(std::size_t block) {
+  auto &state = blockStates_[block];
+  auto current = state.load(std::memory_order_acquire);
+
+  if (current == kReady) {
+    return true;
+  }
+
+  std::uint8_t expected = kEmpty;
+
+  if (!state.compare_exchange_strong(expected, kConverting,
+                                     std::memory_order_acquire)) {
+    return expected == kReady;
+  }
+
+  convertBlock(block);
+  state.store(kReady, std::memory_order_release);
+  return true;
+}
+
+void MappedAudioData::convertBlock(std::size_t block) {
+  auto startFrame = block * kBlockFrames;
+  auto endFrame =
+      std::min<std::size_t>(startFrame + kBlockFrames, length_);
+  auto sampleSize = getSampleSize(format_);
+
+  for (auto frame = startFrame; frame < endFrame; ++frame) {
+    const auto *source = samples_ + frame * numberOfChannels_ * sampleSize;
+
+    for (std::uint32_t ch = 0; ch < numberOfChannels_; ++ch) {
+      auto &destination =
+          converted_[static_cast<std::size_t>(ch) * length_ + frame];
+
+      if (format_ == MappedSampleFormat::eInt16Interleaved) {
+        std::int16_t sample;
+        std::memcpy(&sample, source + ch * sampleSize, sizeof(sample));
+        destination = static_cast<float>(sample) / 32768.0f;
+      } else {
+        std::memcpy(&destination, source + ch * sampleSize,
+                    sizeof(destination));
+      }
+    }
+  }
+}
+
+void MappedAudioData::request(std::size_t begin, std::size_t end) {
+  end = std::min(end, blockCount_);
+
+  if (begin >= end) {
+    return;
+  }
+
+  requestBegin_.store(begin, std::memory_order_relaxed);
+  requestEnd_.store(end, std::memory_order_relaxed);
+
+  // A conversion already queued picks up the new range; one that has just
+  // finished scanning may miss it, and the next request schedules again.
+  if (conversionScheduled_.exchange(true, std::memory_order_acq_rel)) {
+    return;
+  }
+
+  if (!WorkerPool::getBackground().submit(conversionTask_)) {
+    conversionScheduled_.store(false, std::memory_order_release);
+  }
+}
+
+void MappedAudioData::convertRequested() {
+  auto begin = requestBegin_.load(std::memory_order_relaxed);
+  auto end = std::min(requestEnd_.load(std::memory_order_relaxed), blockCount_);
+
+  for (auto block = begin; block < end; ++block) {
+    // Blocks claimed by another thread are left to it.
+    tryConvertBlock(block);
+  }
+}
+
+void MappedAudioData::advise(const void *address, std::size_t size) const {
+#if defined(_WIN32)
+  (void)address;
+  (void)size;
+#else
+  static const auto pageSize =
+      static_cast<std::uintptr_t>(sysconf(_SC_PAGESIZE));
+  auto begin = reinterpret_cast<std::uintptr_t>(address) & ~(pageSize - 1);
+  auto end = reinterpret_cast<std::uintptr_t>(address) + size;
+  posix_madvise(reinterpret_cast<void *>(begin), end - begin,
+                POSIX_MADV_WILLNEED);
+#endif
+}
+} // namespace web_audio::detail
\ No newline at end of file
@@ -1,10 +1,12 @@
 #include "web_audio/detail/message_queue.hh"
 
+#include <utility>
+
 namespace web_audio::detail {
 Message MessageQueue::pop() {
   std::unique_lock<std::mutex> lock(mtx_);
   cv_.wait(lock, [this] { return !queue_.empty(); });
-  Message value = queue_.front();
+  Message value = std::move(queue_.front());
   queue_.pop();
   return value;
 }
@@ -14,7 +16,7 @@ std::optional<Message> MessageQueue::tryPop() {
   if (queue_.empty()) {
     return std::nullopt;
   }
-  Message value = queue_.front();
+  Message value = std::move(queue_.front());
   queue_.pop();
   return value;
 }
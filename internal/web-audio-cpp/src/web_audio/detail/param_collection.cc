@@ -1,14 +1,16 @@
 #include "web_audio/detail/param_collection.hh"
 
+#include <algorithm>
+
 namespace web_audio::detail {
-float ParamCollection::getValue(std::shared_ptr<AudioParam> param,
+float ParamCollection::getValue(const std::shared_ptr<AudioParam> &param,
                                 size_t frame) const {
-  auto it = params_.find(param);
+  auto it = params_.find(param.get());
   if (it == params_.end()) {
     return 0.0f;
   }
 
-  const auto &values = it->second;
+  const auto &values = it->second.values;
   if (frame < values.size()) {
     return values[frame];
   } else {
@@ -16,13 +18,42 @@ float ParamCollection::getValue(std::shared_ptr<AudioParam> param,
   }
 }
 
-void ParamCollection::setValue(std::shared_ptr<AudioParam> param, float value) {
-  params_[param] = {value};
+std::span<const float>
+ParamCollection::getValues(const std::shared_ptr<AudioParam> &param) const {
+  auto it = params_.find(param.get());
+  if (it == params_.end()) {
+    return {};
+  }
+
+  return it->second.values;
+}
+
+bool ParamCollection::isConstant(
+    const std::shared_ptr<AudioParam> &param) const {
+  auto it = params_.find(param.get());
+  return it == params_.end() || it->second.constant;
+}
+
+void ParamCollection::setValue(const std::shared_ptr<AudioParam> &param,
+                               float value) {
+  params_[param.get()] = {{value}, true};
+}
+
+void ParamCollection::setValue(const std::shared_ptr<AudioParam> &param,
+                               float value, std::size_t frames) {
+  auto &entry = params_[param.get()];
+  entry.values.assign(frames, value);
+  entry.constant = true;
 }
 
-void ParamCollection::setValues(std::shared_ptr<AudioParam> param,
+void ParamCollection::setValues(const std::shared_ptr<AudioParam> &param,
                                 const std::vector<float> &values) {
-  params_[param] = values;
+  auto constant =
+      std::all_of(values.begin(), values.end(),
+                  [&](float value) { return value == values.front(); });
+  auto &entry = params_[param.get()];
+  entry.values.assign(values.begin(), values.end());
+  entry.constant = constant;
 }
 
 void ParamCollection::clear() { params_.clear(); }
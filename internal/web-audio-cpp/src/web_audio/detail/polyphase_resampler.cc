@@ -0,0 +1,84 @@
+#include "web_audio/detail/polyphase_resampler.hh"
+
+#include <algorithm>
+#include <stdexcept>
+
+#include "web_audio/detail/vector_math.hh"
+
+namespace web_audio::detail {
+PolyphaseUpsampler::PolyphaseUpsampler(
+    const std::vector<float> &filterCoefficients, std::size_t factor,
+    std::size_t blockSize)
+    : factor_(factor), inputBlockSize_(blockSize) {
+  tapsPerPhase_ = (filterCoefficients.size() + factor_ - 1) / factor_;
+  phases_.resize(factor_ * tapsPerPhase_, 0.0f);
+
+  // Phase p holds h[p], h[p + factor], ..., reversed so that it lines up with
+  // the history in ascending time order.
+  for (std::size_t p = 0; p < factor_; ++p) {
+    for (std::size_t j = 0; j < tapsPerPhase_; ++j) {
+      auto k = p + j * factor_;
+
+      if (k < filterCoefficients.size()) {
+        phases_[p * tapsPerPhase_ + tapsPerPhase_ - 1 - j] =
+            filterCoefficients[k];
+      }
+    }
+  }
+
+  history_.resize(tapsPerPhase_ - 1 + inputBlockSize_, 0.0f);
+}
+
+void PolyphaseUpsampler::process(const std::vector<float> &input,
+                                 std::vector<float> &output) {
+  if (input.size() != inputBlockSize_) {
+    throw std::invalid_argument("Input size must be equal to block size.");
+  }
+
+  output.resize(inputBlockSize_ * factor_);
+  std::copy(input.begin(), input.end(), history_.begin() + tapsPerPhase_ - 1);
+
+  for (std::size_t n = 0; n < inputBlockSize_; ++n) {
+    const auto *window = history_.data() + n;
+
+    for (std::size_t p = 0; p < factor_; ++p) {
+      output[n * factor_ + p] = VectorMath::dot(
+          phases_.data() + p * tapsPerPhase_, window, tapsPerPhase_);
+    }
+  }
+
+  std::copy(history_.end() - (tapsPerPhase_ - 1), history_.end(),
+            history_.begin());
+}
+
+PolyphaseDownsampler::PolyphaseDownsampler(
+    const std::vector<float> &filterCoefficients, std::size_t factor,
+    std::size_t blockSize)
+    : factor_(factor), inputBlockSize_(blockSize),
+      taps_(filterCoefficients.rbegin(), filterCoefficients.rend()) {
+  if (inputBlockSize_ % factor_ != 0) {
+    throw std::invalid_argument("Block size must be a multiple of factor.");
+  }
+
+  history_.resize(taps_.size() - 1 + inputBlockSize_, 0.0f);
+}
+
+void PolyphaseDownsampler::process(const std::vector<float> &input,
+                                   std::vector<float> &output) {
+  if (input.size() != inputBlockSize_) {
+    throw std::invalid_argument("Input size must be equal to block size.");
+  }
+
+  auto outputBlockSize = inputBlockSize_ / factor_;
+  output.resize(outputBlockSize);
+  std::copy(input.begin(), input.end(), history_.begin() + taps_.size() - 1);
+
+  for (std::size_t n = 0; n < outputBlockSize; ++n) {
+    output[n] = VectorMath::dot(taps_.data(), history_.data() + n * factor_,
+                                taps_.size());
+  }
+
+  std::copy(history_.end() - (taps_.size() - 1), history_.end(),
+            history_.begin());
+}
+} // namespace web_audio::detail
\ No newline at end of file
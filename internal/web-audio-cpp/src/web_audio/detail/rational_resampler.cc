@@ -0,0 +1,126 @@
+#include "web_audio/detail/rational_resampler.hh"
+
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+#include <numeric>
+#include <stdexcept>
+
+#include "web_audio/detail/vector_math.hh"
+
+namespace web_audio::detail {
+namespace {
+// Passband edge relative to the lower of the two Nyquist frequencies, leaving
+// room for the transition band.
+constexpr double kCutoff = 0.92;
+constexpr double kKaiserBeta = 8.0;
+
+double besselI0(double x) {
+  double sum = 1.0;
+  double term = 1.0;
+
+  for (int k = 1; k < 32; ++k) {
+    term *= (x / (2.0 * k)) * (x / (2.0 * k));
+    sum += term;
+
+    if (term < sum * 1e-12) {
+      break;
+    }
+  }
+
+  return sum;
+}
+} // namespace
+
+RationalResampler::RationalResampler(double sourceRate, double targetRate) {
+  auto source = std::llround(sourceRate);
+  auto target = std::llround(targetRate);
+
+  if (source <= 0 || target <= 0) {
+    throw std::invalid_argument("Sample rates must be positive.");
+  }
+
+  auto divisor = std::gcd(source, target);
+  auto up = target / divisor;
+  auto down = source / divisor;
+
+  if (up > kMaxPhases) {
+    down = std::max<long long>(
+        1, std::llround(static_cast<double>(down) * kMaxPhases / up));
+    up = kMaxPhases;
+    divisor = std::gcd(up, down);
+    up /= divisor;
+    down /= divisor;
+  }
+
+  upFactor_ = static_cast<std::uint32_t>(up);
+  downFactor_ = static_cast<std::uint32_t>(down);
+
+  auto scale = kCutoff * std::min(1.0, static_cast<double>(upFactor_) /
+                                           static_cast<double>(downFactor_));
+  halfWidth_ = static_cast<std::size_t>(std::ceil(kZeroCrossings / scale));
+  tapsPerPhase_ = 2 * halfWidth_;
+  phases_.resize(upFactor_ * tapsPerPhase_);
+
+  const auto window0 = besselI0(kKaiserBeta);
+  std::vector<double> weights(tapsPerPhase_);
+
+  for (std::uint32_t p = 0; p < upFactor_; ++p) {
+    auto fraction = static_cast<double>(p) / upFactor_;
+    double sum = 0;
+
+    for (std::size_t k = 0; k < tapsPerPhase_; ++k) {
+      auto x = static_cast<double>(k) - static_cast<double>(halfWidth_ - 1) -
+               fraction;
+      auto t = x / static_cast<double>(halfWidth_);
+      auto window =
+          besselI0(kKaiserBeta * std::sqrt(std::max(0.0, 1.0 - t * t))) /
+          window0;
+      auto arg = std::numbers::pi * scale * x;
+      auto sinc = arg == 0 ? 1.0 : std::sin(arg) / arg;
+      weights[k] = sinc * window;
+      sum += weights[k];
+    }
+
+    // Unity gain at DC for every phase.
+    for (std::size_t k = 0; k < tapsPerPhase_; ++k) {
+      phases_[p * tapsPerPhase_ + k] = static_cast<float>(weights[k] / sum);
+    }
+  }
+}
+
+std::size_t RationalResampler::getOutputLength(std::size_t inputLength) const {
+  return static_cast<std::size_t>(
+      (static_cast<std::uint64_t>(inputLength) * upFactor_ + downFactor_ - 1) /
+      downFactor_);
+}
+
+void RationalResampler::process(const float *input, std::size_t inputLength,
+                                std::size_t outputStart, float *output,
+                                std::size_t frames) const {
+  const auto length = static_cast<std::int64_t>(inputLength);
+  const auto taps = static_cast<std::int64_t>(tapsPerPhase_);
+
+  for (std::size_t i = 0; i < frames; ++i) {
+    auto position = static_cast<std::uint64_t>(outputStart + i) * downFactor_;
+    auto base = static_cast<std::int64_t>(position / upFactor_);
+    const auto *row = &phases_[(position % upFactor_) * tapsPerPhase_];
+    auto first = base - static_cast<std::int64_t>(halfWidth_) + 1;
+
+    if (first >= 0 && first + taps <= length) {
+      output[i] = VectorMath::dot(row, input + first, tapsPerPhase_);
+      continue;
+    }
+
+    auto begin = std::max<std::int64_t>(first, 0);
+    auto end = std::min(first + taps, length);
+    float sum = 0;
+
+    for (auto j = begin; j < end; ++j) {
+      sum += row[j - first] * input[j];
+    }
+
+    output[i] = sum;
+  }
+}
+} // namespace web_audio::detail
\ No newline at end of file
@@ -0,0 +1,327 @@
+#include "web_audio/detail/realtime_checker.hh"
+
+#include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <cstdlib>
+#include <mutex>
+#include <new>
+#include <typeinfo>
+
+#include "web_audio/audio_node.hh"
+
+#if __has_include(<cxxabi.h>)
+#include <cxxabi.h>
+#endif
+
+#if __has_include(<execinfo.h>)
+#include <execinfo.h>
+#endif
+
+#if defined(WEB_AUDIO_REALTIME_CHECKS) && defined(__linux__)
+#include <dlfcn.h>
+#include <pthread.h>
+#endif
+
+namespace web_audio::detail {
+namespace {
+// Trivial types only: operator new may run before or after thread_local
+// objects with constructors are alive.
+thread_local const AudioNode *currentNode = nullptr;
+thread_local bool rendering = false;
+thread_local std::uint64_t currentFrame = 0;
+thread_local int exemptions = 0;
+
+std::atomic<bool> enabled{false};
+std::atomic<std::uint64_t> violationCount{0};
+
+std::mutex &getHandlerMutex() {
+  static std::mutex mutex;
+  return mutex;
+}
+
+RealtimeViolationHandler &getHandler() {
+  static RealtimeViolationHandler handler;
+  return handler;
+}
+
+std::string demangle(const char *name) {
+#if __has_include(<cxxabi.h>)
+  int status = 0;
+  char *demangled = abi::__cxa_demangle(name, nullptr, nullptr, &status);
+
+  if (status == 0 && demangled) {
+    std::string result(demangled);
+    std::free(demangled);
+    return result;
+  }
+#endif
+
+  return name;
+}
+
+std::string getStack() {
+  std::string stack;
+
+#if __has_include(<execinfo.h>)
+  constexpr int kMaxFrames = 24;
+  // getStack() and RealtimeChecker::check()
+  constexpr int kSkippedFrames = 2;
+
+  void *frames[kMaxFrames];
+  auto count = backtrace(frames, kMaxFrames);
+  auto symbols = backtrace_symbols(frames, count);
+
+  if (!symbols) {
+    return stack;
+  }
+
+  for (int i = kSkippedFrames; i < count; ++i) {
+    // module(mangled+offset) [address]
+    std::string symbol(symbols[i]);
+    auto begin = symbol.find('(');
+    auto end = symbol.find('+', begin);
+
+    if (begin != std::string::npos && end != std::string::npos &&
+        end > begin + 1) {
+      auto mangled = symbol.substr(begin + 1, end - begin - 1);
+      symbol.replace(begin + 1, end - begin - 1, demangle(mangled.c_str()));
+    }
+
+    stack += symbol;
+    stack += '\n';
+  }
+
+  std::free(symbols);
+#endif
+
+  return stack;
+}
+} // namespace
+
+RealtimeChecker::NodeScope::NodeScope(const AudioNode &node,
+                                      std::uint64_t frame)
+    : previousNode_(currentNode), previousFrame_(currentFrame) {
+  currentNode = &node;
+  currentFrame = frame;
+}
+
+RealtimeChecker::NodeScope::~NodeScope() {
+  currentNode = previousNode_;
+  currentFrame = previousFrame_;
+}
+
+RealtimeChecker::RenderScope::RenderScope(std::uint64_t frame)
+    : previousRendering_(rendering), previousFrame_(currentFrame) {
+  rendering = true;
+  currentFrame = frame;
+}
+
+RealtimeChecker::RenderScope::~RenderScope() {
+  rendering = previousRendering_;
+  currentFrame = previousFrame_;
+}
+
+RealtimeChecker::Exemption::Exemption() { ++exemptions; }
+
+RealtimeChecker::Exemption::~Exemption() { --exemptions; }
+
+bool RealtimeChecker::isAvailable() {
+#ifdef WEB_AUDIO_REALTIME_CHECKS
+  return true;
+#else
+  return false;
+#endif
+}
+
+void RealtimeChecker::setEnabled(bool value) { enabled.store(value); }
+
+bool RealtimeChecker::isEnabled() { return enabled.load(); }
+
+void RealtimeChecker::setHandler(RealtimeViolationHandler handler) {
+  Exemption exemption;
+  std::lock_guard<std::mutex> lock(getHandlerMutex());
+  getHandler() = std::move(handler);
+}
+
+std::uint64_t RealtimeChecker::getViolationCount() {
+  return violationCount.load();
+}
+
+void RealtimeChecker::check(const char *kind) {
+  if (!enabled.load(std::memory_order_relaxed) ||
+      (!currentNode && !rendering) || exemptions > 0) {
+    return;
+  }
+
+  // Reporting allocates and locks itself.
+  Exemption exemption;
+  ++violationCount;
+
+  try {
+    RealtimeViolation violation{
+        kind,
+        currentNode ? demangle(typeid(*currentNode).name()) : "render loop",
+        getStack(), currentFrame};
+    std::lock_guard<std::mutex> lock(getHandlerMutex());
+
+    if (auto &handler = getHandler()) {
+      handler(violation);
+    } else {
+      std::fprintf(stderr, "web_audio: %s while processing %s\n%s",
+                   violation.kind.c_str(), violation.node.c_str(),
+                   violation.stack.c_str());
+    }
+  } catch (...) {
+    // The interceptors must not throw on behalf of the handler.
+  }
+}
+} // namespace web_audio::detail
+
+#ifdef WEB_AUDIO_REALTIME_CHECKS
+namespace {
+using web_audio::detail::RealtimeChecker;
+
+void *allocate(std::size_t size) {
+  RealtimeChecker::check("allocation");
+
+  for (;;) {
+    if (auto pointer = std::malloc(size == 0 ? 1 : size)) {
+      return pointer;
+    }
+
+    if (auto handler = std::get_new_handler()) {
+      handler();
+    } else {
+      throw std::bad_alloc();
+    }
+  }
+}
+
+void *allocate(std::size_t size, std::align_val_t alignment) {
+  RealtimeChecker::check("allocation");
+
+  // aligned_alloc() takes a multiple of the alignment.
+  auto align = static_cast<std::size_t>(alignment);
+  size = (std::max<std::size_t>(size, 1) + align - 1) / align * align;
+
+  for (;;) {
+    if (auto pointer = std::aligned_alloc(align, size)) {
+      return pointer;
+    }
+
+    if (auto handler = std::get_new_handler()) {
+      handler();
+    } else {
+      throw std::bad_alloc();
+    }
+  }
+}
+
+void deallocate(void *pointer) noexcept {
+  if (pointer) {
+    RealtimeChecker::check("deallocation");
+    std::free(pointer);
+  }
+}
+} // namespace
+
+void *operator new(std::size_t size) { return allocate(size); }
+
+void *operator new[](std::size_t size) { return allocate(size); }
+
+void *operator new(std::size_t size, std::align_val_t alignment) {
+  return allocate(size, alignment);
+}
+
+void *operator new[](std::size_t size, std::align_val_t alignment) {
+  return allocate(size, alignment);
+}
+
+void *operator new(std::size_t size, const std::nothrow_t &) noexcept {
+  try {
+    return allocate(size);
+  } catch (...) {
+    return nullptr;
+  }
+}
+
+void *operator new[](std::size_t size, const std::nothrow_t &) noexcept {
+  try {
+    return allocate(size);
+  } catch (...) {
+    return nullptr;
+  }
+}
+
+void *operator new(std::size_t size, std::align_val_t alignment,
+                   const std::nothrow_t &) noexcept {
+  try {
+    return allocate(size, alignment);
+  } catch (...) {
+    return nullptr;
+  }
+}
+
+void *operator new[](std::size_t size, std::align_val_t alignment,
+                     const std::nothrow_t &) noexcept {
+  try {
+    return allocate(size, alignment);
+  } catch (...) {
+    return nullptr;
+  }
+}
+
+void operator delete(void *pointer) noexcept { deallocate(pointer); }
+
+void operator delete[](void *pointer) noexcept { deallocate(pointer); }
+
+void operator delete(void *pointer, std::size_t) noexcept {
+  deallocate(pointer);
+}
+
+void operator delete[](void *pointer, std::size_t) noexcept {
+  deallocate(pointer);
+}
+
+void operator delete(void *pointer, std::align_val_t) noexcept {
+  deallocate(pointer);
+}
+
+void operator delete[](void *pointer, std::align_val_t) noexcept {
+  deallocate(pointer);
+}
+
+void operator delete(void *pointer, std::size_t, std::align_val_t) noexcept {
+  deallocate(pointer);
+}
+
+void operator delete[](void *pointer, std::size_t, std::align_val_t) noexcept {
+  deallocate(pointer);
+}
+
+void operator delete(void *pointer, const std::nothrow_t &) noexcept {
+  deallocate(pointer);
+}
+
+void operator delete[](void *pointer, const std::nothrow_t &) noexcept {
+  deallocate(pointer);
+}
+
+#if defined(__linux__)
+extern "C" int pthread_mutex_lock(pthread_mutex_t *mutex) noexcept {
+  using Lock = int (*)(pthread_mutex_t *);
+  // Constant-initialized, so that no guard, which could lock, is taken.
+  static std::atomic<Lock> next{nullptr};
+  auto lock = next.load(std::memory_order_relaxed);
+
+  if (!lock) {
+    lock = reinterpret_cast<Lock>(dlsym(RTLD_NEXT, "pthread_mutex_lock"));
+    next.store(lock, std::memory_order_relaxed);
+  }
+
+  RealtimeChecker::check("lock");
+  return lock(mutex);
+}
+#endif
+#endif
\ No newline at end of file
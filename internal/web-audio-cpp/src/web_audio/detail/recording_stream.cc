@@ -0,0 +1,235 @@
+#include "web_audio/detail/recording_stream.hh"
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+
+#include "web_audio/detail/wav_writer.hh"
+
+namespace web_audio::detail {
+namespace {
+WavSampleFormat toWavSampleFormat(RecordingSampleFormat sampleFormat) {
+  switch (sampleFormat) {
+  case RecordingSampleFormat::eInt16:
+    return WavSampleFormat::eInt16;
+  case RecordingSampleFormat::eInt24:
+    return WavSampleFormat::eInt24;
+  default:
+    return WavSampleFormat::eFloat32;
+  }
+}
+} // namespace
+
+RecordingStream::RecordingStream(std::uint32_t numberOfChannels,
+                                 std::uint32_t numberOfBlocks,
+                                 Consumer consumer,
+                                 std::function<void()> finish)
+    : numberOfChannels_(numberOfChannels),
+      freeBlocks_(std::max<std::uint32_t>(numberOfBlocks, 2)),
+      readyBlocks_(std::max<std::uint32_t>(numberOfBlocks, 2)),
+      consumer_(std::move(consumer)), finish_(std::move(finish)) {
+  blocks_.resize(std::max<std::uint32_t>(numberOfBlocks, 2));
+
+  for (std::uint32_t i = 0; i < blocks_.size(); ++i) {
+    blocks_[i].samples.resize(std::size_t{numberOfChannels} * kBlockFrames);
+    freeBlocks_.tryPush(i);
+  }
+
+  channels_.resize(numberOfChannels);
+  thread_ = std::thread([this] { ioLoop(); });
+}
+
+std::unique_ptr<RecordingStream>
+RecordingStream::create(const AudioRecordingOptions &options,
+                        std::uint32_t numberOfChannels, float sampleRate) {
+  auto blocks = static_cast<std::uint32_t>(std::ceil(
+      std::max(options.bufferDuration, 0.0) * sampleRate / kBlockFrames));
+
+  if (options.callback) {
+    auto views = std::make_shared<std::vector<std::span<const float>>>(
+        numberOfChannels);
+
+    return std::make_unique<RecordingStream>(
+        numberOfChannels, blocks,
+        [callback = options.callback,
+         views](const float *const *channels, std::uint32_t frames) {
+          for (std::size_t ch = 0; ch < views->size(); ++ch) {
+            (*views)[ch] = {channels[ch], frames};
+          }
+
+          callback(*views);
+        });
+  }
+
+  if (options.path.empty()) {
+    throw std::invalid_argument("Recording: no path or callback");
+  }
+
+  auto writer = std::make_shared<WavWriter>(
+      options.path, toWavSampleFormat(options.sampleFormat), numberOfChannels,
+      static_cast<std::uint32_t>(sampleRate));
+
+  return std::make_unique<RecordingStream>(
+      numberOfChannels, blocks,
+      [writer](const float *const *channels, std::uint32_t frames) {
+        writer->write(channels, frames);
+      },
+      [writer] { writer->close(); });
+}
+
+RecordingStream::~RecordingStream() {
+  try {
+    close();
+  } catch (...) {
+  }
+}
+
+std::uint32_t RecordingStream::getNumberOfChannels() const {
+  return numberOfChannels_;
+}
+
+void RecordingStream::write(const float *const *sources,
+                            std::uint32_t frames) {
+  write(sources, frames, false);
+}
+
+void RecordingStream::writeWaiting(const float *const *sources,
+                                   std::uint32_t frames) {
+  write(sources, frames, true);
+}
+
+void RecordingStream::close() {
+  if (closed_) {
+    return;
+  }
+
+  closed_ = true;
+
+  if (currentBlock_ >= 0) {
+    submit();
+  }
+
+  stopping_.store(true, std::memory_order_release);
+  wake();
+  thread_.join();
+
+  if (error_) {
+    std::rethrow_exception(error_);
+  }
+}
+
+std::uint64_t RecordingStream::getOverflowCount() const {
+  return overflowCount_.load(std::memory_order_relaxed);
+}
+
+std::uint64_t RecordingStream::getDroppedFrames() const {
+  return droppedFrames_.load(std::memory_order_relaxed);
+}
+
+void RecordingStream::write(const float *const *sources, std::uint32_t frames,
+                            bool wait) {
+  std::uint32_t done = 0;
+
+  while (done < frames) {
+    if (currentBlock_ < 0) {
+      auto next = freeBlocks_.tryPop();
+
+      while (!next && wait) {
+        auto observed = released_.load(std::memory_order_acquire);
+        next = freeBlocks_.tryPop();
+
+        if (!next) {
+          released_.wait(observed, std::memory_order_acquire);
+        }
+      }
+
+      if (!next) {
+        overflowCount_.fetch_add(1, std::memory_order_relaxed);
+        droppedFrames_.fetch_add(frames - done, std::memory_order_relaxed);
+        return;
+      }
+
+      currentBlock_ = *next;
+    }
+
+    auto &block = blocks_[static_cast<std::uint32_t>(currentBlock_)];
+    auto n = std::min(frames - done, kBlockFrames - block.frames);
+
+    for (std::uint32_t ch = 0; ch < numberOfChannels_; ++ch) {
+      auto *destination =
+          block.samples.data() + ch * kBlockFrames + block.frames;
+
+      if (sources) {
+        std::memcpy(destination, sources[ch] + done, n * sizeof(float));
+      } else {
+        std::fill_n(destination, n, 0.0f);
+      }
+    }
+
+    done += n;
+    block.frames += n;
+
+    if (block.frames == kBlockFrames) {
+      submit();
+    }
+  }
+}
+
+void RecordingStream::submit() {
+  readyBlocks_.tryPush(static_cast<std::uint32_t>(currentBlock_));
+  currentBlock_ = -1;
+  wake();
+}
+
+void RecordingStream::ioLoop() {
+  while (true) {
+    auto observed = signal_.load(std::memory_order_acquire);
+    drain();
+
+    if (stopping_.load(std::memory_order_acquire)) {
+      // The last block was queued before stopping_ was set.
+      drain();
+      break;
+    }
+
+    signal_.wait(observed, std::memory_order_acquire);
+  }
+
+  if (finish_ && !error_) {
+    try {
+      finish_();
+    } catch (...) {
+      error_ = std::current_exception();
+    }
+  }
+}
+
+void RecordingStream::drain() {
+  while (auto index = readyBlocks_.tryPop()) {
+    auto &block = blocks_[*index];
+
+    if (!error_) {
+      for (std::uint32_t ch = 0; ch < numberOfChannels_; ++ch) {
+        channels_[ch] = block.samples.data() + ch * kBlockFrames;
+      }
+
+      try {
+        consumer_(channels_.data(), block.frames);
+      } catch (...) {
+        error_ = std::current_exception();
+      }
+    }
+
+    block.frames = 0;
+    freeBlocks_.tryPush(*index);
+    released_.fetch_add(1, std::memory_order_release);
+    released_.notify_one();
+  }
+}
+
+void RecordingStream::wake() {
+  signal_.fetch_add(1, std::memory_order_release);
+  signal_.notify_one();
+}
+} // namespace web_audio::detail
\ No newline at end of file
@@ -1,7 +1,10 @@
 #include "web_audio/detail/render_quantum.hh"
 
+#include <algorithm>
 #include <stdexcept>
 
+#include "web_audio/detail/sample_buffer_pool.hh"
+
 namespace web_audio::detail {
 RenderQuantum::RenderQuantum() : RenderQuantum(0, 0) {}
 
@@ -10,8 +13,11 @@ RenderQuantum::RenderQuantum(std::uint32_t numberOfChannels)
 
 RenderQuantum::RenderQuantum(std::uint32_t numberOfChannels,
                              std::uint32_t length)
-    : length_(length),
-      channelData_(numberOfChannels, std::vector<float>(length, 0.0f)) {}
+    : length_(length) {
+  if (numberOfChannels > 0) {
+    channelData_.assign(numberOfChannels, getSilentChannel());
+  }
+}
 
 std::uint32_t RenderQuantum::getLength() const { return length_; }
 
@@ -21,13 +27,88 @@ std::uint32_t RenderQuantum::getNumberOfChannels() const {
 
 std::size_t RenderQuantum::size() const { return channelData_.size(); }
 
+void RenderQuantum::reset(std::uint32_t numberOfChannels) {
+  channelData_.assign(numberOfChannels, getSilentChannel());
+}
+
+void RenderQuantum::reserve(std::uint32_t numberOfChannels) {
+  channelData_.reserve(numberOfChannels);
+}
+
 std::vector<float> &RenderQuantum::operator[](std::uint32_t channel) {
-  return channelData_[channel];
+  auto &data = channelData_[channel];
+
+  if (!data.samples) {
+    auto value = *data.constant;
+    data = createChannel();
+    std::fill(data.samples->begin(), data.samples->end(), value);
+  } else if (isShared(channel)) {
+    auto source = std::move(data);
+    data = createChannel();
+    std::copy(source.samples->begin(), source.samples->end(),
+              data.samples->begin());
+  }
+
+  data.constant.reset();
+  return *data.samples;
 }
 
 const std::vector<float> &
 RenderQuantum::operator[](std::uint32_t channel) const {
-  return channelData_[channel];
+  auto &data = channelData_[channel];
+
+  if (!data.samples) {
+    auto filled = createChannel();
+    std::fill(filled.samples->begin(), filled.samples->end(), *data.constant);
+    data.samples = std::move(filled.samples);
+    data.pooled = filled.pooled;
+  }
+
+  return *data.samples;
+}
+
+void RenderQuantum::setChannel(std::uint32_t channel,
+                               const RenderQuantum &source,
+                               std::uint32_t sourceChannel) {
+  channelData_[channel] = source.channelData_[sourceChannel];
+}
+
+bool RenderQuantum::isShared(std::uint32_t channel) const {
+  auto &data = channelData_[channel];
+  return data.samples.use_count() > (data.pooled ? 2 : 1);
+}
+
+void RenderQuantum::setConstant(std::uint32_t channel, float value) {
+  channelData_[channel] =
+      value == 0 ? getSilentChannel() : Channel{nullptr, value};
+}
+
+bool RenderQuantum::isConstant(std::uint32_t channel) const {
+  return channelData_[channel].constant.has_value();
+}
+
+float RenderQuantum::getConstant(std::uint32_t channel) const {
+  return *channelData_[channel].constant;
+}
+
+RenderQuantum::Channel RenderQuantum::createChannel() const {
+  if (auto pool = SampleBufferPool::getCurrent()) {
+    return {pool->acquire(length_), std::nullopt, true};
+  }
+
+  return {std::make_shared<std::vector<float>>(length_), std::nullopt, false};
+}
+
+RenderQuantum::Channel RenderQuantum::getSilentChannel() const {
+  // Holding a reference here keeps the buffer shared, so it is copied rather
+  // than written to.
+  thread_local std::shared_ptr<std::vector<float>> silence;
+
+  if (!silence || silence->size() != length_) {
+    silence = std::make_shared<std::vector<float>>(length_, 0.0f);
+  }
+
+  return {silence, 0.0f};
 }
 
 void RenderQuantum::mix(std::uint32_t computedNumberOfChannels,
@@ -36,6 +117,8 @@ void RenderQuantum::mix(std::uint32_t computedNumberOfChannels,
     return;
   }
 
+  const auto &input = *this;
+
   if (channelInterpretation == ChannelInterpretation::eSpeakers) {
     switch (channelData_.size()) {
     case 1:
@@ -55,8 +138,8 @@ void RenderQuantum::mix(std::uint32_t computedNumberOfChannels,
          * output.SR = 0;
          */
         channelData_.emplace_back(channelData_[0]);
-        channelData_.emplace_back(std::vector<float>(length_, 0.0f));
-        channelData_.emplace_back(std::vector<float>(length_, 0.0f));
+        channelData_.emplace_back(getSilentChannel());
+        channelData_.emplace_back(getSilentChannel());
         return;
       case 6:
         /*
@@ -67,11 +150,11 @@ void RenderQuantum::mix(std::uint32_t computedNumberOfChannels,
          * output.SL = 0;
          * output.SR = 0;
          */
-        channelData_.emplace_back(std::vector<float>(length_, 0.0f));
-        channelData_.emplace_back(std::vector<float>(length_, 0.0f));
-        channelData_.emplace_back(std::vector<float>(length_, 0.0f));
-        channelData_.emplace_back(std::vector<float>(length_, 0.0f));
-        channelData_.emplace_back(std::vector<float>(length_, 0.0f));
+        channelData_.emplace_back(getSilentChannel());
+        channelData_.emplace_back(getSilentChannel());
+        channelData_.emplace_back(getSilentChannel());
+        channelData_.emplace_back(getSilentChannel());
+        channelData_.emplace_back(getSilentChannel());
         std::swap(channelData_[2], channelData_[0]);
         return;
       }
@@ -81,9 +164,15 @@ void RenderQuantum::mix(std::uint32_t computedNumberOfChannels,
         /*
          * output = 0.5 * (input.L + input.R);
          */
-        for (std::uint32_t i = 0; i < length_; ++i) {
-          channelData_[0][i] = 0.5f * (channelData_[0][i] + channelData_[1][i]);
+        {
+          auto &left = (*this)[0];
+          const auto &right = input[1];
+
+          for (std::uint32_t i = 0; i < length_; ++i) {
+            left[i] = 0.5f * (left[i] + right[i]);
+          }
         }
+
         channelData_.resize(1);
         return;
       case 4:
@@ -93,8 +182,8 @@ void RenderQuantum::mix(std::uint32_t computedNumberOfChannels,
          * output.SL = 0;
          * output.SR = 0;
          */
-        channelData_.emplace_back(std::vector<float>(length_, 0.0f));
-        channelData_.emplace_back(std::vector<float>(length_, 0.0f));
+        channelData_.emplace_back(getSilentChannel());
+        channelData_.emplace_back(getSilentChannel());
         return;
       case 6:
         /*
@@ -105,10 +194,10 @@ void RenderQuantum::mix(std::uint32_t computedNumberOfChannels,
          * output.SL = 0;
          * output.SR = 0;
          */
-        channelData_.emplace_back(std::vector<float>(length_, 0.0f));
-        channelData_.emplace_back(std::vector<float>(length_, 0.0f));
-        channelData_.emplace_back(std::vector<float>(length_, 0.0f));
-        channelData_.emplace_back(std::vector<float>(length_, 0.0f));
+        channelData_.emplace_back(getSilentChannel());
+        channelData_.emplace_back(getSilentChannel());
+        channelData_.emplace_back(getSilentChannel());
+        channelData_.emplace_back(getSilentChannel());
         return;
       }
     case 4:
@@ -117,10 +206,16 @@ void RenderQuantum::mix(std::uint32_t computedNumberOfChannels,
         /*
          * output = 0.25 * (input.L + input.R + input.SL + input.SR);
          */
-        for (std::uint32_t i = 0; i < length_; ++i) {
-          channelData_[0][i] =
-              0.25f * (channelData_[0][i] + channelData_[1][i] +
-                       channelData_[2][i] + channelData_[3][i]);
+        {
+          auto &left = (*this)[0];
+          const auto &right = input[1];
+          const auto &surroundLeft = input[2];
+          const auto &surroundRight = input[3];
+
+          for (std::uint32_t i = 0; i < length_; ++i) {
+            left[i] = 0.25f * (left[i] + right[i] + surroundLeft[i] +
+                               surroundRight[i]);
+          }
         }
 
         channelData_.resize(1);
@@ -130,9 +225,16 @@ void RenderQuantum::mix(std::uint32_t computedNumberOfChannels,
          * output.L = 0.5 * (input.L + input.SL);
          * output.R = 0.5 * (input.R + input.SR);
          */
-        for (std::uint32_t i = 0; i < length_; ++i) {
-          channelData_[0][i] = 0.5f * (channelData_[0][i] + channelData_[2][i]);
-          channelData_[1][i] = 0.5f * (channelData_[1][i] + channelData_[3][i]);
+        {
+          auto &left = (*this)[0];
+          auto &right = (*this)[1];
+          const auto &surroundLeft = input[2];
+          const auto &surroundRight = input[3];
+
+          for (std::uint32_t i = 0; i < length_; ++i) {
+            left[i] = 0.5f * (left[i] + surroundLeft[i]);
+            right[i] = 0.5f * (right[i] + surroundRight[i]);
+          }
         }
 
         channelData_.resize(2);
@@ -146,8 +248,8 @@ void RenderQuantum::mix(std::uint32_t computedNumberOfChannels,
          * output.SL = input.SL;
          * output.SR = input.SR;
          */
-        channelData_.emplace_back(std::vector<float>(length_, 0.0f));
-        channelData_.emplace_back(std::vector<float>(length_, 0.0f));
+        channelData_.emplace_back(getSilentChannel());
+        channelData_.emplace_back(getSilentChannel());
         std::swap(channelData_[4], channelData_[2]);
         std::swap(channelData_[5], channelData_[3]);
         return;
@@ -159,12 +261,19 @@ void RenderQuantum::mix(std::uint32_t computedNumberOfChannels,
          * output = sqrt(0.5) * (input.L + input.R) + input.C + 0.5 *
          * (input.SL + input.SR)
          */
-        for (std::uint32_t i = 0; i < length_; ++i) {
-          channelData_[0][i] =
-              std::sqrt(0.5f) * (channelData_[0][i] + channelData_[1][i]) +
-              channelData_[2][i] +
-              0.5f * (channelData_[4][i] + channelData_[5][i]);
+        {
+          auto &left = (*this)[0];
+          const auto &right = input[1];
+          const auto &center = input[2];
+          const auto &surroundLeft = input[4];
+          const auto &surroundRight = input[5];
+
+          for (std::uint32_t i = 0; i < length_; ++i) {
+            left[i] = std::sqrt(0.5f) * (left[i] + right[i]) + center[i] +
+                      0.5f * (surroundLeft[i] + surroundRight[i]);
+          }
         }
+
         channelData_.resize(1);
         return;
       case 2:
@@ -172,13 +281,17 @@ void RenderQuantum::mix(std::uint32_t computedNumberOfChannels,
          * output.L = L + sqrt(0.5) * (input.C + input.SL)
          * output.R = R + sqrt(0.5) * (input.C + input.SR)
          */
-        for (std::uint32_t i = 0; i < length_; ++i) {
-          channelData_[0][i] =
-              channelData_[0][i] +
-              std::sqrt(0.5f) * (channelData_[2][i] + channelData_[4][i]);
-          channelData_[1][i] =
-              channelData_[1][i] +
-              std::sqrt(0.5f) * (channelData_[2][i] + channelData_[5][i]);
+        {
+          auto &left = (*this)[0];
+          auto &right = (*this)[1];
+          const auto &center = input[2];
+          const auto &surroundLeft = input[4];
+          const auto &surroundRight = input[5];
+
+          for (std::uint32_t i = 0; i < length_; ++i) {
+            left[i] += std::sqrt(0.5f) * (center[i] + surroundLeft[i]);
+            right[i] += std::sqrt(0.5f) * (center[i] + surroundRight[i]);
+          }
         }
 
         channelData_.resize(2);
@@ -190,11 +303,15 @@ void RenderQuantum::mix(std::uint32_t computedNumberOfChannels,
          * output.SL = input.SL
          * output.SR = input.SR
          */
-        for (std::uint32_t i = 0; i < length_; ++i) {
-          channelData_[0][i] =
-              channelData_[0][i] + std::sqrt(0.5f) * channelData_[2][i];
-          channelData_[1][i] =
-              channelData_[1][i] + std::sqrt(0.5f) * channelData_[2][i];
+        {
+          auto &left = (*this)[0];
+          auto &right = (*this)[1];
+          const auto &center = input[2];
+
+          for (std::uint32_t i = 0; i < length_; ++i) {
+            left[i] += std::sqrt(0.5f) * center[i];
+            right[i] += std::sqrt(0.5f) * center[i];
+          }
         }
 
         channelData_.erase(channelData_.begin() + 2, channelData_.begin() + 4);
@@ -204,8 +321,7 @@ void RenderQuantum::mix(std::uint32_t computedNumberOfChannels,
   }
 
   if (computedNumberOfChannels > channelData_.size()) {
-    channelData_.resize(computedNumberOfChannels,
-                        std::vector<float>(length_, 0.0f));
+    channelData_.resize(computedNumberOfChannels, getSilentChannel());
   } else {
     channelData_.resize(computedNumberOfChannels);
   }
@@ -224,9 +340,22 @@ void RenderQuantum::add(const RenderQuantum &other,
               channelInterpretation);
     add(clone, channelInterpretation);
   } else {
-    for (std::size_t ch = 0; ch < channelData_.size(); ++ch) {
-      for (std::size_t i = 0; i < length_; ++i) {
-        channelData_[ch][i] += other.channelData_[ch][i];
+    for (std::uint32_t ch = 0; ch < channelData_.size(); ++ch) {
+      if (!other.isConstant(ch)) {
+        auto &channel = (*this)[ch];
+        const auto &source = other[ch];
+
+        for (std::size_t i = 0; i < length_; ++i) {
+          channel[i] += source[i];
+        }
+      } else if (isConstant(ch)) {
+        setConstant(ch, getConstant(ch) + other.getConstant(ch));
+      } else if (auto value = other.getConstant(ch); value != 0) {
+        auto &channel = (*this)[ch];
+
+        for (std::size_t i = 0; i < length_; ++i) {
+          channel[i] += value;
+        }
       }
     }
   }
@@ -237,8 +366,8 @@ std::vector<float> RenderQuantum::getInterleaved() const {
   interleaved.reserve(length_ * channelData_.size());
 
   for (std::uint32_t i = 0; i < length_; ++i) {
-    for (const auto &channel : channelData_) {
-      interleaved.push_back(channel[i]);
+    for (std::uint32_t ch = 0; ch < channelData_.size(); ++ch) {
+      interleaved.push_back((*this)[ch][i]);
     }
   }
 
@@ -0,0 +1,51 @@
+#include "web_audio/detail/resampler.hh"
+
+#include <stdexcept>
+
+#include "web_audio/detail/downsampler.hh"
+#include "web_audio/detail/polyphase_resampler.hh"
+#include "web_audio/detail/upsampler.hh"
+
+namespace web_audio::detail {
+std::unique_ptr<Resampler> Resampler::createUpsampler(ResamplerType type,
+                                                      std::size_t factor,
+                                                      std::size_t blockSize) {
+  if (factor != 2 && factor != 4) {
+    throw std::invalid_argument("Unsupported resampling factor.");
+  }
+
+  if (type == ResamplerType::ePolyphase) {
+    return std::make_unique<PolyphaseUpsampler>(
+        factor == 2 ? Upsampler2x::getFilterCoefficients()
+                    : Upsampler4x::getFilterCoefficients(),
+        factor, blockSize);
+  }
+
+  if (factor == 2) {
+    return std::make_unique<Upsampler2x>(blockSize);
+  }
+
+  return std::make_unique<Upsampler4x>(blockSize);
+}
+
+std::unique_ptr<Resampler>
+Resampler::createDownsampler(ResamplerType type, std::size_t factor,
+                             std::size_t blockSize) {
+  if (factor != 2 && factor != 4) {
+    throw std::invalid_argument("Unsupported resampling factor.");
+  }
+
+  if (type == ResamplerType::ePolyphase) {
+    return std::make_unique<PolyphaseDownsampler>(
+        factor == 2 ? Downsampler2x::getFilterCoefficients()
+                    : Downsampler4x::getFilterCoefficients(),
+        factor, blockSize);
+  }
+
+  if (factor == 2) {
+    return std::make_unique<Downsampler2x>(blockSize);
+  }
+
+  return std::make_unique<Downsampler4x>(blockSize);
+}
+} // namespace web_audio::detail
\ No newline at end of file
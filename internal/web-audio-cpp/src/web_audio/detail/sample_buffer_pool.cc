@@ -0,0 +1,40 @@
+#include "web_audio/detail/sample_buffer_pool.hh"
+
+#include <atomic>
+
+namespace web_audio::detail {
+namespace {
+thread_local SampleBufferPool *currentPool = nullptr;
+} // namespace
+
+SampleBufferPool::Scope::Scope(SampleBufferPool &pool)
+    : previous_(currentPool) {
+  currentPool = &pool;
+}
+
+SampleBufferPool::Scope::~Scope() { currentPool = previous_; }
+
+SampleBufferPool *SampleBufferPool::getCurrent() { return currentPool; }
+
+std::shared_ptr<std::vector<float>>
+SampleBufferPool::acquire(std::uint32_t length) {
+  auto count = buffers_.size();
+
+  for (std::size_t i = 0; i < count; ++i) {
+    auto index = next_ + i < count ? next_ + i : next_ + i - count;
+    auto &buffer = buffers_[index];
+
+    if (buffer.use_count() == 1 && buffer->size() == length) {
+      // Orders the writes to come after the reads of whoever released the
+      // buffer last, possibly on another thread.
+      std::atomic_thread_fence(std::memory_order_acquire);
+      next_ = index + 1 < count ? index + 1 : 0;
+      return buffer;
+    }
+  }
+
+  buffers_.push_back(std::make_shared<std::vector<float>>(length));
+  next_ = 0;
+  return buffers_.back();
+}
+} // namespace web_audio::detail
\ No newline at end of file
@@ -0,0 +1,62 @@
+#include "web_audio/detail/snapshot_ring.hh"
+
+#include "web_audio/detail/math_helper.hh"
+
+namespace web_audio::detail {
+SnapshotRing::SnapshotRing(std::size_t capacity)
+    : capacity_(MathHelper::nextPowerOfTwo(capacity)),
+      samples_(new std::atomic<float>[capacity_]) {
+  for (std::size_t i = 0; i < capacity_; ++i) {
+    samples_[i].store(0, std::memory_order_relaxed);
+  }
+}
+
+std::size_t SnapshotRing::getCapacity() const { return capacity_; }
+
+void SnapshotRing::write(const float *samples, std::size_t frames) {
+  auto position = written_.load(std::memory_order_relaxed);
+  claimed_.store(position + frames, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+
+  const auto mask = capacity_ - 1;
+
+  for (std::size_t i = 0; i < frames; ++i) {
+    samples_[(position + i) & mask].store(samples ? samples[i] : 0.0f,
+                                          std::memory_order_relaxed);
+  }
+
+  written_.store(position + frames, std::memory_order_release);
+}
+
+std::uint64_t SnapshotRing::getWritten() const {
+  return written_.load(std::memory_order_acquire);
+}
+
+std::uint64_t SnapshotRing::read(float *output, std::size_t frames) const {
+  const auto mask = capacity_ - 1;
+
+  while (true) {
+    auto end = written_.load(std::memory_order_acquire);
+    // Frames before the first sample written are silent.
+    auto silent = end < frames ? frames - end : 0;
+    auto start = end - (frames - silent);
+
+    for (std::size_t i = 0; i < silent; ++i) {
+      output[i] = 0;
+    }
+
+    for (std::size_t i = silent; i < frames; ++i) {
+      output[i] = samples_[(start + i - silent) & mask].load(
+          std::memory_order_relaxed);
+    }
+
+    std::atomic_thread_fence(std::memory_order_acquire);
+
+    // The copy is intact unless the writer has since started on the slots
+    // of the oldest sample.
+    if (claimed_.load(std::memory_order_relaxed) - start <= capacity_) {
+      return end;
+    }
+  }
+}
+} // namespace web_audio::detail
\ No newline at end of file
@@ -0,0 +1,256 @@
+#include "web_audio/detail/spatial_batch.hh"
+
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+
+namespace web_audio::detail {
+namespace {
+constexpr float kRadiansToDegrees = 180 / std::numbers::pi_v<float>;
+
+float acosDegrees(float x) {
+  return std::acos(std::clamp(x, -1.0f, 1.0f)) * kRadiansToDegrees;
+}
+} // namespace
+
+ListenerBasis ListenerBasis::create(const Vec3 &position, const Vec3 &forward,
+                                    const Vec3 &up) {
+  auto right = forward.cross(up).normalize();
+  auto front = forward.normalize();
+  // SPEC: Compute up vector.
+  auto upright = right.cross(front);
+
+  ListenerBasis basis;
+  basis.positionX = position.getX();
+  basis.positionY = position.getY();
+  basis.positionZ = position.getZ();
+  basis.rightX = right.getX();
+  basis.rightY = right.getY();
+  basis.rightZ = right.getZ();
+  basis.forwardX = front.getX();
+  basis.forwardY = front.getY();
+  basis.forwardZ = front.getZ();
+  basis.upX = upright.getX();
+  basis.upY = upright.getY();
+  basis.upZ = upright.getZ();
+  return basis;
+}
+
+SpatialBatch::SpatialBatch(std::size_t capacity) : size_(capacity) {
+  positionX_.resize(capacity, 0);
+  positionY_.resize(capacity, 0);
+  positionZ_.resize(capacity, 0);
+  orientationX_.resize(capacity, 1);
+  orientationY_.resize(capacity, 0);
+  orientationZ_.resize(capacity, 0);
+  distanceModel_.resize(capacity, DistanceModelType::eInverse);
+  refDistance_.resize(capacity, 1);
+  maxDistance_.resize(capacity, 10000);
+  rolloffFactor_.resize(capacity, 1);
+  coneInnerAngle_.resize(capacity, 360);
+  coneOuterAngle_.resize(capacity, 360);
+  coneOuterGain_.resize(capacity, 0);
+  directionX_.resize(capacity);
+  directionY_.resize(capacity);
+  directionZ_.resize(capacity);
+  distance_.resize(capacity);
+  azimuth_.resize(capacity);
+  elevation_.resize(capacity);
+  gain_.resize(capacity);
+}
+
+std::size_t SpatialBatch::getSize() const { return size_; }
+
+std::size_t SpatialBatch::getCapacity() const { return positionX_.size(); }
+
+void SpatialBatch::resize(std::size_t size) {
+  size_ = std::min(size, getCapacity());
+}
+
+void SpatialBatch::setPosition(std::size_t index, float x, float y, float z) {
+  positionX_[index] = x;
+  positionY_[index] = y;
+  positionZ_[index] = z;
+}
+
+void SpatialBatch::setOrientation(std::size_t index, float x, float y,
+                                  float z) {
+  orientationX_[index] = x;
+  orientationY_[index] = y;
+  orientationZ_[index] = z;
+}
+
+void SpatialBatch::setDistance(std::size_t index, DistanceModelType model,
+                               float refDistance, float maxDistance,
+                               float rolloffFactor) {
+  distanceModel_[index] = model;
+  refDistance_[index] = refDistance;
+  maxDistance_[index] = maxDistance;
+  rolloffFactor_[index] = rolloffFactor;
+}
+
+void SpatialBatch::setCone(std::size_t index, float innerAngle,
+                           float outerAngle, float outerGain) {
+  coneInnerAngle_[index] = innerAngle;
+  coneOuterAngle_[index] = outerAngle;
+  coneOuterGain_[index] = outerGain;
+}
+
+void SpatialBatch::process(const ListenerBasis &listener) {
+  process(&listener, 0);
+}
+
+void SpatialBatch::process(const ListenerBasis *listeners) {
+  process(listeners, 1);
+}
+
+void SpatialBatch::process(const ListenerBasis *listeners,
+                           std::size_t stride) {
+  computeDirections(listeners, stride);
+  computeAngles(listeners, stride);
+  computeDistanceGains();
+  computeConeGains();
+}
+
+const float *SpatialBatch::getAzimuths() const { return azimuth_.data(); }
+
+const float *SpatialBatch::getElevations() const { return elevation_.data(); }
+
+const float *SpatialBatch::getGains() const { return gain_.data(); }
+
+void SpatialBatch::computeDirections(const ListenerBasis *listeners,
+                                     std::size_t stride) {
+  for (std::size_t i = 0; i < size_; ++i) {
+    const auto &listener = listeners[i * stride];
+    auto x = positionX_[i] - listener.positionX;
+    auto y = positionY_[i] - listener.positionY;
+    auto z = positionZ_[i] - listener.positionZ;
+    auto distance = std::sqrt(x * x + y * y + z * z);
+    auto scale = distance > 0 ? 1 / distance : 0.0f;
+    directionX_[i] = x * scale;
+    directionY_[i] = y * scale;
+    directionZ_[i] = z * scale;
+    distance_[i] = distance;
+  }
+}
+
+void SpatialBatch::computeAngles(const ListenerBasis *listeners,
+                                 std::size_t stride) {
+  // A source at the listener position has a zero direction, which yields the
+  // specified azimuth and elevation of 0 without a special case.
+  for (std::size_t i = 0; i < size_; ++i) {
+    const auto &listener = listeners[i * stride];
+    auto x = directionX_[i];
+    auto y = directionY_[i];
+    auto z = directionZ_[i];
+
+    // SPEC: Project the source-listener vector on the x-z plane.
+    auto upProjection = x * listener.upX + y * listener.upY + z * listener.upZ;
+    auto px = x - upProjection * listener.upX;
+    auto py = y - upProjection * listener.upY;
+    auto pz = z - upProjection * listener.upZ;
+    auto length = std::sqrt(px * px + py * py + pz * pz);
+    auto scale = length > 0 ? 1 / length : 0.0f;
+    px *= scale;
+    py *= scale;
+    pz *= scale;
+
+    // SPEC: Compute azimuth.
+    auto azimuth = acosDegrees(px * listener.rightX + py * listener.rightY +
+                               pz * listener.rightZ);
+
+    // SPEC: Source in front or behind the listener.
+    auto frontBack = px * listener.forwardX + py * listener.forwardY +
+                     pz * listener.forwardZ;
+    azimuth = frontBack < 0 ? 360 - azimuth : azimuth;
+
+    // SPEC: Make azimuth relative to "forward" and not "right" listener
+    // vector.
+    azimuth = azimuth <= 270 ? 90 - azimuth : 450 - azimuth;
+
+    // SPEC: Elevation
+    auto elevation = 90 - acosDegrees(upProjection);
+    elevation = elevation > 90    ? 180 - elevation
+                : elevation < -90 ? -180 - elevation
+                                  : elevation;
+
+    azimuth_[i] = azimuth;
+    elevation_[i] = elevation;
+  }
+}
+
+void SpatialBatch::computeDistanceGains() {
+  for (std::size_t i = 0; i < size_; ++i) {
+    auto distance = distance_[i];
+    auto refDistance = refDistance_[i];
+    auto maxDistance = maxDistance_[i];
+    auto rolloffFactor = rolloffFactor_[i];
+    float gain = 1;
+
+    switch (distanceModel_[i]) {
+    case DistanceModelType::eLinear: {
+      // SPEC: rolloffFactor is clamped to [0, 1] for the linear model.
+      rolloffFactor = std::clamp(rolloffFactor, 0.0f, 1.0f);
+
+      if (maxDistance == refDistance) {
+        gain = 1 - rolloffFactor;
+      } else {
+        auto d = std::max(std::min(distance, maxDistance), refDistance);
+        gain = 1 - rolloffFactor * (d - refDistance) /
+                       (maxDistance - refDistance);
+      }
+      break;
+    }
+    case DistanceModelType::eInverse: {
+      auto d = std::max(distance, refDistance);
+      auto denominator = refDistance + rolloffFactor * (d - refDistance);
+      gain = denominator > 0 ? refDistance / denominator : 1.0f;
+      break;
+    }
+    case DistanceModelType::eExponential: {
+      auto d = std::max(distance, refDistance);
+      gain = d > 0 ? std::pow(d / refDistance, -rolloffFactor) : 1.0f;
+      break;
+    }
+    }
+
+    gain_[i] = gain;
+  }
+}
+
+void SpatialBatch::computeConeGains() {
+  for (std::size_t i = 0; i < size_; ++i) {
+    auto innerAngle = std::abs(coneInnerAngle_[i]) / 2;
+    auto outerAngle = std::abs(coneOuterAngle_[i]) / 2;
+    auto ox = orientationX_[i];
+    auto oy = orientationY_[i];
+    auto oz = orientationZ_[i];
+    auto length = std::sqrt(ox * ox + oy * oy + oz * oz);
+
+    // SPEC: A zero orientation or a full cone means no cone effect.
+    if (length == 0 || (innerAngle == 180 && outerAngle == 180)) {
+      continue;
+    }
+
+    // SPEC: Normalized source-listener vector, which points from the source
+    // to the listener.
+    auto cosine = -(directionX_[i] * ox + directionY_[i] * oy +
+                    directionZ_[i] * oz) /
+                  length;
+    auto angle = acosDegrees(cosine);
+    auto outerGain = coneOuterGain_[i];
+    float gain;
+
+    if (angle <= innerAngle) {
+      gain = 1;
+    } else if (angle >= outerAngle) {
+      gain = outerGain;
+    } else {
+      auto x = (angle - innerAngle) / (outerAngle - innerAngle);
+      gain = (1 - x) + outerGain * x;
+    }
+
+    gain_[i] *= gain;
+  }
+}
+} // namespace web_audio::detail
\ No newline at end of file
@@ -5,6 +5,12 @@
 namespace web_audio::detail {
 Vec3::Vec3(float x, float y, float z) : x(x), y(y), z(z) {}
 
+float Vec3::getX() const { return x; }
+
+float Vec3::getY() const { return y; }
+
+float Vec3::getZ() const { return z; }
+
 float Vec3::dot(const Vec3 &v) const {
   return (this->x * v.x) + (this->y * v.y) + (this->z * v.z);
 }
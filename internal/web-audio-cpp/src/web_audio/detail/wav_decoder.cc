@@ -0,0 +1,216 @@
+#include "web_audio/detail/wav_decoder.hh"
+
+#include <algorithm>
+#include <cstring>
+#include <istream>
+#include <optional>
+#include <stdexcept>
+
+#include "web_audio/detail/sample_conversion.hh"
+
+namespace web_audio::detail {
+namespace {
+constexpr std::uint16_t kFormatPcm = 0x0001;
+constexpr std::uint16_t kFormatIeeeFloat = 0x0003;
+constexpr std::uint16_t kFormatExtensible = 0xFFFE;
+
+std::uint16_t readUint16(const std::uint8_t *p) {
+  return static_cast<std::uint16_t>(p[0] | (p[1] << 8));
+}
+
+std::uint32_t readUint32(const std::uint8_t *p) {
+  return static_cast<std::uint32_t>(p[0]) |
+         (static_cast<std::uint32_t>(p[1]) << 8) |
+         (static_cast<std::uint32_t>(p[2]) << 16) |
+         (static_cast<std::uint32_t>(p[3]) << 24);
+}
+
+bool matchTag(const std::uint8_t *p, const char *tag) {
+  return std::memcmp(p, tag, 4) == 0;
+}
+
+WavSampleFormat toSampleFormat(std::uint16_t formatTag,
+                               std::size_t containerBytes) {
+  if (formatTag == kFormatPcm) {
+    switch (containerBytes) {
+    case 1:
+      return WavSampleFormat::eUint8;
+    case 2:
+      return WavSampleFormat::eInt16;
+    case 3:
+      return WavSampleFormat::eInt24;
+    case 4:
+      return WavSampleFormat::eInt32;
+    }
+  } else if (formatTag == kFormatIeeeFloat) {
+    switch (containerBytes) {
+    case 4:
+      return WavSampleFormat::eFloat32;
+    case 8:
+      return WavSampleFormat::eFloat64;
+    }
+  }
+
+  throw std::invalid_argument("WAVE: unsupported sample format");
+}
+
+
+/**
+ * Walks the chunks of a WAVE file of `size` bytes. `read(offset, count, out)`
+ * copies bytes of the file and returns false if they are not available.
+ */
+template <typename Read> WavFormat parseChunks(Read read, std::uint64_t size) {
+  std::uint8_t header[12];
+
+  if (!read(0, 12, header) || !matchTag(header, "RIFF") ||
+      !matchTag(header + 8, "WAVE")) {
+    throw std::invalid_argument("WAVE: missing RIFF header");
+  }
+
+  std::optional<WavFormat> format;
+  std::uint64_t position = 12;
+
+  while (position + 8 <= size) {
+    std::uint8_t chunk[8];
+    read(position, 8, chunk);
+    std::uint64_t chunkSize = readUint32(chunk + 4);
+    auto bodyOffset = position + 8;
+    auto available = size - bodyOffset;
+
+    if (matchTag(chunk, "fmt ")) {
+      std::uint8_t body[40];
+
+      if (chunkSize < 16 || chunkSize > available ||
+          !read(bodyOffset, std::min<std::uint64_t>(chunkSize, 40), body)) {
+        throw std::invalid_argument("WAVE: truncated fmt chunk");
+      }
+
+      auto formatTag = readUint16(body);
+      auto channels = readUint16(body + 2);
+      auto sampleRate = readUint32(body + 4);
+      auto blockAlign = readUint16(body + 12);
+
+      if (formatTag == kFormatExtensible) {
+        if (chunkSize < 40) {
+          throw std::invalid_argument("WAVE: truncated extensible format");
+        }
+
+        // The first two bytes of the SubFormat GUID hold the format tag.
+        formatTag = readUint16(body + 24);
+      }
+
+      if (channels == 0 || sampleRate == 0 || blockAlign % channels != 0) {
+        throw std::invalid_argument("WAVE: invalid fmt chunk");
+      }
+
+      format = WavFormat{
+          .sampleFormat = toSampleFormat(formatTag, blockAlign / channels),
+          .numberOfChannels = channels,
+          .sampleRate = sampleRate,
+          .length = 0,
+          .dataOffset = 0,
+          .blockAlign = blockAlign,
+      };
+    } else if (matchTag(chunk, "data")) {
+      if (!format) {
+        throw std::invalid_argument("WAVE: data chunk precedes fmt chunk");
+      }
+
+      // Streamed files may carry a placeholder size; use what is there.
+      auto length = std::min(chunkSize, available) / format->blockAlign;
+
+      if (length > UINT32_MAX) {
+        throw std::invalid_argument("WAVE: data chunk is too long");
+      }
+
+      format->dataOffset = static_cast<std::size_t>(bodyOffset);
+      format->length = static_cast<std::uint32_t>(length);
+      return *format;
+    }
+
+    // Chunks are padded to an even size.
+    position = bodyOffset + chunkSize + (chunkSize & 1);
+  }
+
+  throw std::invalid_argument("WAVE: missing data chunk");
+}
+} // namespace
+
+WavFormat WavDecoder::parse(std::span<const std::uint8_t> data) {
+  return parseChunks(
+      [data](std::uint64_t offset, std::uint64_t count, std::uint8_t *out) {
+        if (offset + count > data.size()) {
+          return false;
+        }
+
+        std::memcpy(out, data.data() + offset, count);
+        return true;
+      },
+      data.size());
+}
+
+WavFormat WavDecoder::parse(std::istream &stream) {
+  stream.seekg(0, std::ios::end);
+  auto size = static_cast<std::uint64_t>(stream.tellg());
+
+  return parseChunks(
+      [&stream](std::uint64_t offset, std::uint64_t count, std::uint8_t *out) {
+        stream.seekg(static_cast<std::streamoff>(offset));
+        stream.read(reinterpret_cast<char *>(out),
+                    static_cast<std::streamsize>(count));
+        return static_cast<std::uint64_t>(stream.gcount()) == count;
+      },
+      size);
+}
+
+std::size_t WavDecoder::getSampleSize(WavSampleFormat sampleFormat) {
+  switch (sampleFormat) {
+  case WavSampleFormat::eUint8:
+    return 1;
+  case WavSampleFormat::eInt16:
+    return 2;
+  case WavSampleFormat::eInt24:
+    return 3;
+  case WavSampleFormat::eInt32:
+  case WavSampleFormat::eFloat32:
+    return 4;
+  case WavSampleFormat::eFloat64:
+    return 8;
+  }
+
+  return 0;
+}
+
+void WavDecoder::decode(const WavFormat &format,
+                        std::span<const std::uint8_t> data,
+                        std::uint32_t startFrame, std::uint32_t frames,
+                        float *const *destinations, float *scratch) {
+  const auto *source = data.data() + format.dataOffset +
+                       std::uint64_t{startFrame} * format.blockAlign;
+  std::size_t samples = std::size_t{frames} * format.numberOfChannels;
+
+  switch (format.sampleFormat) {
+  case WavSampleFormat::eUint8:
+    SampleConversion::fromUint8(source, scratch, samples);
+    break;
+  case WavSampleFormat::eInt16:
+    SampleConversion::fromInt16(source, scratch, samples);
+    break;
+  case WavSampleFormat::eInt24:
+    SampleConversion::fromInt24(source, scratch, samples);
+    break;
+  case WavSampleFormat::eInt32:
+    SampleConversion::fromInt32(source, scratch, samples);
+    break;
+  case WavSampleFormat::eFloat32:
+    SampleConversion::fromFloat32(source, scratch, samples);
+    break;
+  case WavSampleFormat::eFloat64:
+    SampleConversion::fromFloat64(source, scratch, samples);
+    break;
+  }
+
+  SampleConversion::deinterleave(scratch, format.numberOfChannels, frames,
+                                 destinations);
+}
+} // namespace web_audio::detail
\ No newline at end of file
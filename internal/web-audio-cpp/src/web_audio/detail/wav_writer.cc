@@ -0,0 +1,203 @@
+#include "web_audio/detail/wav_writer.hh"
+
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+
+#include "web_audio/detail/sample_conversion.hh"
+
+namespace web_audio::detail {
+namespace {
+constexpr std::uint16_t kFormatPcm = 0x0001;
+constexpr std::uint16_t kFormatIeeeFloat = 0x0003;
+constexpr std::uint16_t kFormatExtensible = 0xFFFE;
+// Body of the ds64 chunk: RIFF size, data size, sample count and an empty
+// table.
+constexpr std::uint32_t kDs64Size = 28;
+// Frames converted at a time.
+constexpr std::uint32_t kChunkFrames = 1024;
+
+void appendTag(std::vector<std::uint8_t> &out, const char *tag) {
+  out.insert(out.end(), tag, tag + 4);
+}
+
+void appendUint(std::vector<std::uint8_t> &out, std::uint64_t value,
+                std::size_t size) {
+  for (std::size_t i = 0; i < size; ++i) {
+    out.push_back(static_cast<std::uint8_t>(value >> (8 * i)));
+  }
+}
+} // namespace
+
+WavWriter::WavWriter(const std::string &path, WavSampleFormat sampleFormat,
+                     std::uint32_t numberOfChannels, std::uint32_t sampleRate)
+    : sampleFormat_(sampleFormat), numberOfChannels_(numberOfChannels) {
+  if (sampleFormat != WavSampleFormat::eInt16 &&
+      sampleFormat != WavSampleFormat::eInt24 &&
+      sampleFormat != WavSampleFormat::eFloat32) {
+    throw std::invalid_argument("WAVE: unsupported sample format");
+  }
+
+  if (numberOfChannels == 0 || numberOfChannels > UINT16_MAX) {
+    throw std::invalid_argument("WAVE: unsupported number of channels");
+  }
+
+  file_.open(path, std::ios::binary | std::ios::trunc);
+
+  if (!file_) {
+    throw std::runtime_error("Failed to create " + path);
+  }
+
+  auto sampleSize = WavDecoder::getSampleSize(sampleFormat);
+  auto formatTag =
+      sampleFormat == WavSampleFormat::eFloat32 ? kFormatIeeeFloat : kFormatPcm;
+  // Layouts beyond stereo need WAVE_FORMAT_EXTENSIBLE.
+  auto extensible = numberOfChannels > 2;
+  blockAlign_ = sampleSize * numberOfChannels;
+
+  std::vector<std::uint8_t> header;
+  appendTag(header, "RIFF");
+  appendUint(header, 0, 4);
+  appendTag(header, "WAVE");
+
+  appendTag(header, "JUNK");
+  appendUint(header, kDs64Size, 4);
+  appendUint(header, 0, kDs64Size);
+
+  appendTag(header, "fmt ");
+  appendUint(header, extensible ? 40 : 16, 4);
+  appendUint(header, extensible ? kFormatExtensible : formatTag, 2);
+  appendUint(header, numberOfChannels, 2);
+  appendUint(header, sampleRate, 4);
+  appendUint(header, std::uint64_t{sampleRate} * blockAlign_, 4);
+  appendUint(header, blockAlign_, 2);
+  appendUint(header, sampleSize * 8, 2);
+
+  if (extensible) {
+    appendUint(header, 22, 2);
+    appendUint(header, sampleSize * 8, 2);
+    // No speaker positions.
+    appendUint(header, 0, 4);
+    // KSDATAFORMAT_SUBTYPE_PCM or _IEEE_FLOAT.
+    appendUint(header, formatTag, 2);
+    const std::uint8_t guid[] = {0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x80,
+                                 0x00, 0x00, 0xAA, 0x00, 0x38, 0x9B, 0x71};
+    header.insert(header.end(), std::begin(guid), std::end(guid));
+  }
+
+  appendTag(header, "data");
+  appendUint(header, 0, 4);
+  dataOffset_ = header.size();
+
+  file_.write(reinterpret_cast<const char *>(header.data()),
+              static_cast<std::streamsize>(header.size()));
+
+  if (!file_) {
+    throw std::runtime_error("Failed to write " + path);
+  }
+
+  sources_.resize(numberOfChannels);
+  interleaved_.resize(std::size_t{kChunkFrames} * numberOfChannels);
+  bytes_.resize(kChunkFrames * blockAlign_);
+}
+
+WavWriter::~WavWriter() {
+  try {
+    close();
+  } catch (const std::runtime_error &) {
+  }
+}
+
+void WavWriter::write(const float *const *sources, std::uint32_t frames) {
+  for (std::uint32_t done = 0; done < frames; done += kChunkFrames) {
+    auto n = std::min(kChunkFrames, frames - done);
+    std::size_t samples = std::size_t{n} * numberOfChannels_;
+
+    for (std::uint32_t ch = 0; ch < numberOfChannels_; ++ch) {
+      sources_[ch] = sources[ch] + done;
+    }
+
+    SampleConversion::interleave(sources_.data(), numberOfChannels_, n,
+                                 interleaved_.data());
+
+    switch (sampleFormat_) {
+    case WavSampleFormat::eInt16:
+      SampleConversion::toInt16(interleaved_.data(), bytes_.data(), samples);
+      break;
+    case WavSampleFormat::eInt24:
+      SampleConversion::toInt24(interleaved_.data(), bytes_.data(), samples);
+      break;
+    default:
+      SampleConversion::toFloat32(interleaved_.data(), bytes_.data(),
+                                  samples);
+      break;
+    }
+
+    file_.write(reinterpret_cast<const char *>(bytes_.data()),
+                static_cast<std::streamsize>(n * blockAlign_));
+
+    if (!file_) {
+      throw std::runtime_error("WAVE: write failed");
+    }
+
+    length_ += n;
+  }
+}
+
+void WavWriter::close() {
+  if (closed_) {
+    return;
+  }
+
+  closed_ = true;
+  auto dataSize = length_ * blockAlign_;
+
+  // Chunks are padded to an even size.
+  if (dataSize & 1) {
+    file_.put(0);
+  }
+
+  auto riffSize = dataOffset_ - 8 + dataSize + (dataSize & 1);
+  std::vector<std::uint8_t> bytes;
+
+  if (riffSize <= UINT32_MAX) {
+    appendUint(bytes, riffSize, 4);
+    file_.seekp(4);
+    file_.write(reinterpret_cast<const char *>(bytes.data()), 4);
+
+    bytes.clear();
+    appendUint(bytes, dataSize, 4);
+    file_.seekp(static_cast<std::streamoff>(dataOffset_ - 4));
+    file_.write(reinterpret_cast<const char *>(bytes.data()), 4);
+  } else {
+    appendTag(bytes, "RF64");
+    appendUint(bytes, UINT32_MAX, 4);
+    file_.seekp(0);
+    file_.write(reinterpret_cast<const char *>(bytes.data()), 8);
+
+    bytes.clear();
+    appendTag(bytes, "ds64");
+    appendUint(bytes, kDs64Size, 4);
+    appendUint(bytes, riffSize, 8);
+    appendUint(bytes, dataSize, 8);
+    appendUint(bytes, length_, 8);
+    appendUint(bytes, 0, 4);
+    file_.seekp(12);
+    file_.write(reinterpret_cast<const char *>(bytes.data()),
+                static_cast<std::streamsize>(bytes.size()));
+
+    bytes.clear();
+    appendUint(bytes, UINT32_MAX, 4);
+    file_.seekp(static_cast<std::streamoff>(dataOffset_ - 4));
+    file_.write(reinterpret_cast<const char *>(bytes.data()), 4);
+  }
+
+  file_.close();
+
+  if (!file_) {
+    throw std::runtime_error("WAVE: write failed");
+  }
+}
+
+std::uint64_t WavWriter::getLength() const { return length_; }
+} // namespace web_audio::detail
\ No newline at end of file
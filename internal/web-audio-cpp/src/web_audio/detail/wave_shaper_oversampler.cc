@@ -0,0 +1,41 @@
+#include "web_audio/detail/wave_shaper_oversampler.hh"
+
+namespace web_audio::detail {
+WaveShaperOversampler::WaveShaperOversampler(ResamplerType type,
+                                             std::size_t factor,
+                                             std::size_t blockSize,
+                                             std::uint32_t numberOfChannels)
+    : type_(type), factor_(factor), blockSize_(blockSize) {
+  setNumberOfChannels(numberOfChannels);
+}
+
+std::size_t WaveShaperOversampler::getFactor() const { return factor_; }
+
+std::uint32_t WaveShaperOversampler::getNumberOfChannels() const {
+  return static_cast<std::uint32_t>(channels_.size());
+}
+
+void WaveShaperOversampler::setNumberOfChannels(
+    std::uint32_t numberOfChannels) {
+  channels_.reserve(numberOfChannels);
+
+  while (channels_.size() < numberOfChannels) {
+    channels_.push_back(createChannel());
+  }
+}
+
+WaveShaperOversampler::Channel &
+WaveShaperOversampler::getChannel(std::uint32_t channel) {
+  return channels_[channel];
+}
+
+WaveShaperOversampler::Channel WaveShaperOversampler::createChannel() const {
+  Channel channel;
+  channel.upsampler = Resampler::createUpsampler(type_, factor_, blockSize_);
+  channel.downsampler =
+      Resampler::createDownsampler(type_, factor_, blockSize_ * factor_);
+  // The resamplers resize their output to this on every block.
+  channel.oversampled.resize(blockSize_ * factor_);
+  return channel;
+}
+} // namespace web_audio::detail
\ No newline at end of file
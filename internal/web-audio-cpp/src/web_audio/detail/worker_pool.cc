@@ -0,0 +1,64 @@
+#include "web_audio/detail/worker_pool.hh"
+
+#include <algorithm>
+
+namespace web_audio::detail {
+WorkerPool::WorkerPool(std::size_t threadCount, std::size_t capacity)
+    : queue_(capacity) {
+  threads_.reserve(threadCount);
+
+  for (std::size_t i = 0; i < threadCount; ++i) {
+    threads_.emplace_back([this] { workerLoop(); });
+  }
+}
+
+WorkerPool::~WorkerPool() {
+  stopping_.store(true, std::memory_order_release);
+  signal_.fetch_add(1, std::memory_order_release);
+  signal_.notify_all();
+
+  for (auto &thread : threads_) {
+    thread.join();
+  }
+}
+
+bool WorkerPool::submit(std::shared_ptr<WorkerTask> task) {
+  if (!queue_.tryPush(std::move(task))) {
+    return false;
+  }
+
+  signal_.fetch_add(1, std::memory_order_release);
+  signal_.notify_one();
+  return true;
+}
+
+std::size_t WorkerPool::getThreadCount() const { return threads_.size(); }
+
+std::size_t WorkerPool::getDefaultThreadCount() {
+  auto concurrency = std::thread::hardware_concurrency();
+  // Leave one core for the rendering thread.
+  return std::clamp<std::size_t>(concurrency > 1 ? concurrency - 1 : 1, 1, 4);
+}
+
+WorkerPool &WorkerPool::getBackground() {
+  static WorkerPool pool;
+  return pool;
+}
+
+void WorkerPool::workerLoop() {
+  while (true) {
+    auto observed = signal_.load(std::memory_order_acquire);
+
+    if (auto task = queue_.tryPop()) {
+      (*task)->run();
+      continue;
+    }
+
+    if (stopping_.load(std::memory_order_acquire)) {
+      break;
+    }
+
+    signal_.wait(observed, std::memory_order_acquire);
+  }
+}
+} // namespace web_audio::detail
\ No newline at end of file
@@ -0,0 +1,172 @@
+#include "web_audio/dynamics_compressor_node.hh"
+
+#include "web_audio/audio_param.hh"
+#include "web_audio/base_audio_context.hh"
+#include "web_audio/dom_exception.hh"
+
+namespace web_audio {
+DynamicsCompressorNode::DynamicsCompressorNode(float sampleRate)
+    : kernel_(sampleRate) {}
+
+std::shared_ptr<DynamicsCompressorNode>
+DynamicsCompressorNode::create(std::shared_ptr<BaseAudioContext> context,
+                               const DynamicsCompressorOptions &options) {
+  auto node = std::shared_ptr<DynamicsCompressorNode>(
+      new DynamicsCompressorNode(context->getSampleRate()));
+  node->initialize(context);
+
+  node->numberOfInputs_ = 1;
+  node->numberOfOutputs_ = 1;
+  node->setChannelCount(options.channelCount.value_or(2));
+  node->setChannelCountMode(
+      options.channelCountMode.value_or(ChannelCountMode::eClampedMax));
+  node->channelInterpretation_ =
+      options.channelInterpretation.value_or(ChannelInterpretation::eSpeakers);
+
+  // SPEC: All parameters have automation rate "k-rate", and the automation
+  // rate cannot be changed.
+  auto createParam = [&](float defaultValue, float minValue, float maxValue,
+                         float value) {
+    auto param = AudioParam::create(node, defaultValue, minValue, maxValue,
+                                    AutomationRate::eKRate, false);
+    param->setValue(value);
+    return param;
+  };
+
+  node->threshold_ = createParam(-24, -100, 0, options.threshold);
+  node->knee_ = createParam(30, 0, 40, options.knee);
+  node->ratio_ = createParam(12, 1, 20, options.ratio);
+  node->attack_ = createParam(0.003f, 0, 1, options.attack);
+  node->release_ = createParam(0.25f, 0, 1, options.release);
+
+  return node;
+}
+
+std::shared_ptr<AudioParam> DynamicsCompressorNode::getThreshold() const {
+  return threshold_;
+}
+
+std::shared_ptr<AudioParam> DynamicsCompressorNode::getKnee() const {
+  return knee_;
+}
+
+std::shared_ptr<AudioParam> DynamicsCompressorNode::getRatio() const {
+  return ratio_;
+}
+
+float DynamicsCompressorNode::getReduction() const {
+  return reduction_.load(std::memory_order_relaxed);
+}
+
+std::shared_ptr<AudioParam> DynamicsCompressorNode::getAttack() const {
+  return attack_;
+}
+
+std::shared_ptr<AudioParam> DynamicsCompressorNode::getRelease() const {
+  return release_;
+}
+
+void DynamicsCompressorNode::setChannelCount(std::uint32_t channelCount) {
+  // SPEC: NotSupportedError exception MUST be thrown for any attempt to
+  // change it to a value greater than two.
+  if (channelCount > 2) {
+    throw DOMException(
+        "DynamicsCompressorNode: channelCount cannot be greater than 2",
+        "NotSupportedError");
+  }
+
+  AudioNode::setChannelCount(channelCount);
+}
+
+void DynamicsCompressorNode::setChannelCountMode(
+    ChannelCountMode channelCountMode) {
+  // SPEC: NotSupportedError exception MUST be thrown for any attempt to
+  // change it to "max".
+  if (channelCountMode == ChannelCountMode::eMax) {
+    throw DOMException(
+        "DynamicsCompressorNode: channelCountMode cannot be \"max\"",
+        "NotSupportedError");
+  }
+
+  AudioNode::setChannelCountMode(channelCountMode);
+}
+
+std::vector<std::shared_ptr<AudioParam>>
+DynamicsCompressorNode::getParams() const {
+  return {threshold_, knee_, ratio_, attack_, release_};
+}
+
+void DynamicsCompressorNode::process(
+    const std::vector<detail::RenderQuantum> &inputs,
+    std::vector<detail::RenderQuantum> &outputs,
+    const detail::ParamCollection &params) {
+  auto &input = inputs[0];
+  auto &output = outputs[0];
+  auto frames = input.getLength();
+  auto channels = input.getNumberOfChannels();
+
+  // A disconnected input keeps the channels of the lookahead so that its
+  // tail is played out.
+  if (channels != 0) {
+    kernel_.setNumberOfChannels(channels);
+  }
+
+  channels = kernel_.getNumberOfChannels();
+  output.reset(channels);
+
+  if (channels == 0) {
+    return;
+  }
+
+  const float *in[detail::CompressorKernel::kMaxChannels];
+  float *out[detail::CompressorKernel::kMaxChannels];
+
+  for (std::uint32_t c = 0; c < channels; ++c) {
+    // The new output quantum is silent.
+    in[c] = input.getNumberOfChannels() != 0 ? input[c].data()
+                                             : output[c].data();
+    out[c] = output[c].data();
+  }
+
+  kernel_.process(in, out, frames, getParameters(params));
+  reduction_.store(kernel_.getReduction(), std::memory_order_relaxed);
+}
+
+bool DynamicsCompressorNode::processInPlace(
+    detail::RenderQuantum &quantum, const detail::ParamCollection &params) {
+  auto channels = quantum.getNumberOfChannels();
+
+  // The lookahead of a disconnected input is played out by process().
+  if (channels == 0) {
+    return false;
+  }
+
+  kernel_.setNumberOfChannels(channels);
+  float *samples[detail::CompressorKernel::kMaxChannels];
+
+  for (std::uint32_t c = 0; c < channels; ++c) {
+    samples[c] = quantum[c].data();
+  }
+
+  kernel_.process(samples, samples, quantum.getLength(),
+                  getParameters(params));
+  reduction_.store(kernel_.getReduction(), std::memory_order_relaxed);
+  return true;
+}
+
+void DynamicsCompressorNode::resetState() {
+  kernel_.reset();
+  reduction_.store(0.0f, std::memory_order_relaxed);
+}
+
+detail::CompressorParameters DynamicsCompressorNode::getParameters(
+    const detail::ParamCollection &params) const {
+  return {
+      .threshold = params.getValue(threshold_, 0),
+      .knee = params.getValue(knee_, 0),
+      .ratio = params.getValue(ratio_, 0),
+      .attack = params.getValue(attack_, 0),
+      .release = params.getValue(release_, 0),
+  };
+}
+} // namespace web_audio
\ No newline at end of file
@@ -32,16 +32,49 @@ std::shared_ptr<AudioParam> GainNode::getGain() const { return gain_; }
 void GainNode::process(const std::vector<detail::RenderQuantum> &inputs,
                        std::vector<detail::RenderQuantum> &outputs,
                        const detail::ParamCollection &params) {
-  auto &input = inputs[0];
-  auto &output = outputs[0];
+  outputs[0] = inputs[0];
+  processInPlace(outputs[0], params);
+}
+
+bool GainNode::processInPlace(detail::RenderQuantum &quantum,
+                              const detail::ParamCollection &params) {
+  auto frames = quantum.getLength();
 
-  for (std::uint32_t i = 0; i < output.getLength(); ++i) {
-    auto gain = params.getValue(gain_, i);
+  if (params.isConstant(gain_)) {
+    auto gain = params.getValue(gain_, 0);
 
-    for (std::uint32_t ch = 0; ch < output.getNumberOfChannels(); ++ch) {
-      output[ch][i] = input[ch][i] * gain;
+    // Unity gain passes the channels through without touching them.
+    if (gain == 1) {
+      return true;
     }
+
+    for (std::uint32_t ch = 0; ch < quantum.getNumberOfChannels(); ++ch) {
+      if (quantum.isConstant(ch)) {
+        quantum.setConstant(ch, quantum.getConstant(ch) * gain);
+        continue;
+      }
+
+      auto *samples = quantum[ch].data();
+
+      for (std::uint32_t i = 0; i < frames; ++i) {
+        samples[i] *= gain;
+      }
+    }
+
+    return true;
   }
+
+  const auto *gain = params.getValues(gain_).data();
+
+  for (std::uint32_t ch = 0; ch < quantum.getNumberOfChannels(); ++ch) {
+    auto *samples = quantum[ch].data();
+
+    for (std::uint32_t i = 0; i < frames; ++i) {
+      samples[i] *= gain[i];
+    }
+  }
+
+  return true;
 }
 
 std::vector<std::shared_ptr<AudioParam>> GainNode::getParams() const {
@@ -5,7 +5,6 @@
 #include <numbers>
 
 #include "web_audio/base_audio_context.hh"
-#include "web_audio/detail/vector_helper.hh"
 
 namespace web_audio {
 std::shared_ptr<IIRFilterNode>
@@ -38,6 +37,13 @@ IIRFilterNode::create(std::shared_ptr<BaseAudioContext> context,
                        "NotSupportedError");
   }
 
+  // SPEC: If the first element of the array is 0, an InvalidStateError MUST be
+  // thrown.
+  if (options.feedback[0] == 0.0) {
+    throw DOMException("IIRFilterNode: the first feedback value is zero",
+                       "InvalidStateError");
+  }
+
   auto node = std::shared_ptr<IIRFilterNode>(new IIRFilterNode());
   node->initialize(context);
 
@@ -51,6 +57,12 @@ IIRFilterNode::create(std::shared_ptr<BaseAudioContext> context,
 
   node->feedforward_ = options.feedforward;
   node->feedback_ = options.feedback;
+  node->kernel_ =
+      std::make_unique<detail::IIRKernel>(node->feedforward_, node->feedback_);
+  // The rendering thread only changes the number of active channels.
+  node->kernel_->reserve(detail::RenderQuantum::kMaxChannelCount);
+  node->inputChannels_.resize(detail::RenderQuantum::kMaxChannelCount);
+  node->outputChannels_.resize(detail::RenderQuantum::kMaxChannelCount);
 
   return node;
 }
@@ -98,64 +110,38 @@ void IIRFilterNode::process(const std::vector<detail::RenderQuantum> &inputs,
   outputs.resize(1);
   auto &output = outputs[0];
 
-  for (std::uint32_t i = 0; i < output.getLength(); ++i) {
-    for (std::uint32_t ch = 0; ch < output.getNumberOfChannels(); ++ch) {
-      auto prevX = web_audio::detail::VectorHelper::getOrDefault(
-          x_, ch, std::vector<float>{});
-      auto prevY = web_audio::detail::VectorHelper::getOrDefault(
-          y_, ch, std::vector<double>{});
-      auto x = std::vector<float>(feedforward_.size(), 0.0f);
-      auto y = std::vector<double>(feedback_.size(), 0.0);
-
-      x[0] = input[ch][i];
-      for (std::size_t j = 1; j < x.size(); ++j) {
-        if (j - 1 < prevX.size()) {
-          x[j] = prevX[j - 1];
-        }
-      }
-
-      for (std::size_t j = 1; j < y.size(); ++j) {
-        if (j - 1 < prevY.size()) {
-          y[j] = prevY[j - 1];
-        }
-      }
-
-      transferTime(feedback_, feedforward_, x, y);
-
-      output[ch][i] = static_cast<float>(y[0]);
-      web_audio::detail::VectorHelper::resizeAndSet(x_, ch, std::move(x));
-      web_audio::detail::VectorHelper::resizeAndSet(y_, ch, std::move(y));
-    }
-  }
-}
+  auto numberOfChannels = output.getNumberOfChannels();
 
-void IIRFilterNode::transferTime(const std::vector<double> &a,
-                                 const std::vector<double> &b,
-                                 const std::vector<float> &x,
-                                 std::vector<double> &y) {
-  for (std::size_t i = 0; i < x.size(); ++i) {
-    y[0] += b[i] * x[i];
+  if (kernel_->getNumberOfChannels() != numberOfChannels) {
+    kernel_->setNumberOfChannels(numberOfChannels);
   }
 
-  for (std::size_t i = 1; i < a.size(); ++i) {
-    y[0] -= a[i] * y[i];
+  for (std::uint32_t ch = 0; ch < numberOfChannels; ++ch) {
+    inputChannels_[ch] = input[ch].data();
+    outputChannels_[ch] = output[ch].data();
   }
 
-  y[0] /= a[0];
+  kernel_->process(inputChannels_.data(), outputChannels_.data(),
+                   output.getLength());
 }
 
+void IIRFilterNode::resetState() { kernel_->reset(); }
+
 void IIRFilterNode::transferFrequency(const std::vector<double> &a,
                                       const std::vector<double> &b,
                                       const std::complex<double> &z,
                                       std::complex<double> &H) {
-  H = 0;
+  std::complex<double> numerator = 0;
+  std::complex<double> denominator = 0;
 
   for (std::size_t i = 0; i < b.size(); ++i) {
-    H += b[i] * std::pow(z, -static_cast<double>(i));
+    numerator += b[i] * std::pow(z, -static_cast<double>(i));
   }
 
   for (std::size_t i = 0; i < a.size(); ++i) {
-    H /= a[i] * std::pow(z, -static_cast<double>(i));
+    denominator += a[i] * std::pow(z, -static_cast<double>(i));
   }
+
+  H = numerator / denominator;
 }
-} // namespace web_audio
+} // namespace web_audio
\ No newline at end of file
@@ -0,0 +1,24 @@
+#include "web_audio/message_port.hh"
+
+namespace web_audio {
+MessagePort::MessagePort(std::shared_ptr<Queue> incoming,
+                         std::shared_ptr<Queue> outgoing)
+    : incoming_(std::move(incoming)), outgoing_(std::move(outgoing)) {}
+
+std::pair<std::shared_ptr<MessagePort>, std::shared_ptr<MessagePort>>
+MessagePort::createPair(std::size_t capacity) {
+  auto forward = std::make_shared<Queue>(capacity);
+  auto backward = std::make_shared<Queue>(capacity);
+
+  return {std::shared_ptr<MessagePort>(new MessagePort(backward, forward)),
+          std::shared_ptr<MessagePort>(new MessagePort(forward, backward))};
+}
+
+bool MessagePort::postMessage(const AudioWorkletMessage &message) {
+  return outgoing_->tryPush(message);
+}
+
+std::optional<AudioWorkletMessage> MessagePort::receiveMessage() {
+  return incoming_->tryPop();
+}
+} // namespace web_audio
\ No newline at end of file
@@ -1,6 +1,7 @@
 #include "web_audio/offline_audio_context.hh"
 
 #include <algorithm>
+#include <stdexcept>
 
 namespace web_audio {
 Promise<std::shared_ptr<AudioBuffer>> OfflineAudioContext::startRendering() {
@@ -44,7 +45,7 @@ Promise<std::shared_ptr<AudioBuffer>> OfflineAudioContext::startRendering() {
   // begin offline rendering.
   renderingPromiseInternal_ = promise.getInternal();
 
-  this->controlMessageQueue_.push(detail::MessageBeginRendering());
+  this->queueMessage(detail::MessageBeginRendering());
 
   // SPEC: Append promise to [[pending promises]].
 
@@ -52,6 +53,42 @@ Promise<std::shared_ptr<AudioBuffer>> OfflineAudioContext::startRendering() {
   return std::move(promise);
 }
 
+Promise<void>
+OfflineAudioContext::startRendering(const AudioRecordingOptions &options) {
+  Promise<void> promise(eventQueue_);
+
+  if (renderingStarted_) {
+    promise.getInternal()->reject(std::make_exception_ptr(DOMException(
+        "OfflineAudioContext: startRendering has already been called",
+        "InvalidStateError")));
+    return promise;
+  }
+
+  renderingStarted_ = true;
+  auto channels = audioGraph_.getDestinationNode()->channelCount_;
+
+  try {
+    recordingStream_ =
+        detail::RecordingStream::create(options, channels, sampleRate_);
+  } catch (const std::invalid_argument &e) {
+    promise.getInternal()->reject(std::make_exception_ptr(DOMException(
+        std::string("OfflineAudioContext: ") + e.what(),
+        "NotSupportedError")));
+    return promise;
+  } catch (const std::runtime_error &e) {
+    promise.getInternal()->reject(std::make_exception_ptr(DOMException(
+        std::string("OfflineAudioContext: ") + e.what(), "NotAllowedError")));
+    return promise;
+  }
+
+  recordingSources_.resize(channels);
+  recordingPromiseInternal_ = promise.getInternal();
+
+  this->queueMessage(detail::MessageBeginRendering());
+
+  return promise;
+}
+
 Promise<void> OfflineAudioContext::resume() {
   // TODO
   throw std::runtime_error("Not implemented");
@@ -74,6 +111,10 @@ std::shared_ptr<OfflineAudioContext>
 OfflineAudioContext::create(const OfflineAudioContextOptions &options) {
   auto context =
       std::shared_ptr<OfflineAudioContext>(new OfflineAudioContext());
+  // Before initialize(), as nodes copy them on creation.
+  // TODO: renderSizehint
+  context->renderQuantumSize_ = 128;
+  context->sampleRate_ = options.sampleRate;
   context->initialize(options.numberOfChannels);
 
   if (options.numberOfChannels == 0) {
@@ -95,13 +136,10 @@ OfflineAudioContext::create(const OfflineAudioContextOptions &options) {
 
   context->controlThreadState_ = AudioContextState::eSuspended;
   context->renderThreadState_ = AudioContextState::eSuspended;
-  // TODO: renderSizehint
-  context->renderQuantumSize_ = 128;
 
   // TODO: worklet
 
   context->length_ = options.length;
-  context->sampleRate_ = options.sampleRate;
   return context;
 }
 
@@ -121,16 +159,10 @@ void OfflineAudioContext::process() {
     auto frame = currentFrame_.load();
     auto rendered = this->render();
 
-    for (std::uint32_t ch = 0;
-         ch < this->renderedBuffer_->getNumberOfChannels(); ++ch) {
-      auto &channelData = this->renderedBuffer_->getChannelData(ch);
-      auto &renderedChannelData = (*rendered)[ch];
-
-      std::size_t copySize =
-          std::min(static_cast<std::uint64_t>(renderedChannelData.size()),
-                   channelData.size() > frame ? channelData.size() - frame : 0);
-      std::copy_n(renderedChannelData.begin(), copySize,
-                  channelData.begin() + frame);
+    if (recordingStream_) {
+      writeRecording(*rendered, frame);
+    } else {
+      copyRendered(*rendered, frame);
     }
   }
 
@@ -144,6 +176,47 @@ void OfflineAudioContext::process() {
       renderingPromiseInternal_->resolve(this->renderedBuffer_);
       renderingPromiseInternal_.reset();
     }
+
+    if (recordingPromiseInternal_) {
+      try {
+        recordingStream_->close();
+        recordingPromiseInternal_->resolve();
+      } catch (...) {
+        recordingPromiseInternal_->reject(std::current_exception());
+      }
+
+      recordingPromiseInternal_.reset();
+    }
+  }
+}
+
+void OfflineAudioContext::writeRecording(const detail::RenderQuantum &rendered,
+                                         std::uint64_t frame) {
+  auto frames = static_cast<std::uint32_t>(std::min<std::uint64_t>(
+      rendered.getLength(), length_ - frame));
+  auto channels = recordingStream_->getNumberOfChannels();
+  auto complete = rendered.getNumberOfChannels() >= channels;
+
+  for (std::uint32_t ch = 0; ch < channels && complete; ++ch) {
+    recordingSources_[ch] = rendered[ch].data();
+  }
+
+  recordingStream_->writeWaiting(complete ? recordingSources_.data() : nullptr,
+                                 frames);
+}
+
+void OfflineAudioContext::copyRendered(const detail::RenderQuantum &rendered,
+                                       std::uint64_t frame) {
+  for (std::uint32_t ch = 0;
+       ch < this->renderedBuffer_->getNumberOfChannels(); ++ch) {
+    auto &channelData = this->renderedBuffer_->getWritableChannelData(ch);
+    auto &renderedChannelData = rendered[ch];
+
+    std::size_t copySize =
+        std::min(static_cast<std::uint64_t>(renderedChannelData.size()),
+                 channelData.size() > frame ? channelData.size() - frame : 0);
+    std::copy_n(renderedChannelData.begin(), copySize,
+                channelData.begin() + frame);
   }
 }
 } // namespace web_audio
\ No newline at end of file
@@ -4,7 +4,11 @@
 #include "web_audio/base_audio_context.hh"
 #include "web_audio/periodic_wave.hh"
 
-#include <numbers>
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <cmath>
+#include <span>
 
 namespace web_audio {
 std::shared_ptr<OscillatorNode>
@@ -46,6 +50,13 @@ OscillatorNode::create(std::shared_ptr<BaseAudioContext> context,
 
   node->periodicWave_ = options.periodicWave;
 
+  if (node->periodicWave_) {
+    node->wave_ = node->periodicWave_;
+  } else {
+    node->wave_ =
+        PeriodicWave::getBuiltIn(context->getSampleRate(), node->type_);
+  }
+
   return node;
 }
 
@@ -59,6 +70,7 @@ void OscillatorNode::setType(OscillatorType type) {
                        "InvalidStateError");
   }
 
+  wave_ = PeriodicWave::getBuiltIn(getContext()->getSampleRate(), type);
   type_ = type;
 }
 
@@ -76,6 +88,7 @@ void OscillatorNode::setPeriodicWave(
   // which results in this attribute being set to "custom".
 
   periodicWave_ = periodicWave;
+  wave_ = periodicWave;
   type_ = OscillatorType::eCustom;
 }
 
@@ -87,36 +100,92 @@ void OscillatorNode::process(const std::vector<detail::RenderQuantum> &inputs,
   }
 
   auto &output = outputs[0];
-  output = detail::RenderQuantum(1, output.getLength());
-
-  for (std::uint32_t i = 0; i < output.getLength(); ++i) {
-    auto frequency = params.getValue(frequency_, i);
-    auto detune = params.getValue(detune_, i);
-    auto computedOscFrequency = frequency * std::pow(2.0f, detune / 1200.0f);
-    auto phaseIncrement = computedOscFrequency / getContext()->getSampleRate();
-    phase_ += phaseIncrement;
-    if (phase_ >= 1.0f) {
-      phase_ -= 1.0f;
+  output.reset(1);
+  auto *data = output[0].data();
+
+  if (!params.isConstant(frequency_) || !params.isConstant(detune_)) {
+    processAutomated(params, sampleRate_, data, output.getLength());
+    return;
+  }
+
+  auto frequency = params.getValue(frequency_, 0) *
+                   std::exp2(params.getValue(detune_, 0) / 1200.0f);
+  render(frequency,
+         detail::OscillatorKernel::toPhaseIncrement(
+             static_cast<double>(frequency) / sampleRate_),
+         data, output.getLength());
+}
+
+void OscillatorNode::processAutomated(const detail::ParamCollection &params,
+                                      float sampleRate, float *output,
+                                      std::uint32_t frames) {
+  auto frequencies = params.getValues(frequency_);
+  auto detunes = params.getValues(detune_);
+  auto valueAt = [](std::span<const float> values, std::uint32_t frame) {
+    if (values.empty()) {
+      return 0.0f;
     }
 
-    if (type_ == OscillatorType::eSine) {
-      output[0][i] = std::sin(phase_ * 2.0f * std::numbers::pi);
-    } else if (type_ == OscillatorType::eSquare) {
-      output[0][i] = phase_ < 0.5f ? 1.0f : -1.0f;
-    } else if (type_ == OscillatorType::eSawtooth) {
-      output[0][i] = 1.0f - 2.0f * phase_;
-    } else if (type_ == OscillatorType::eTriangle) {
-      output[0][i] =
-          phase_ < 0.5f ? 2.0f * phase_ : 1.0f - 2.0f * (phase_ - 0.5f);
-    } else if (type_ == OscillatorType::eCustom && periodicWave_) {
-      output[0][i] = periodicWave_->getSample(phase_);
-    } else {
-      output[0][i] = 0.0f;
+    return frame < values.size() ? values[frame] : values.front();
+  };
+
+  auto detuneConstant = params.isConstant(detune_);
+  auto detuneScale = std::exp2(valueAt(detunes, 0) / 1200.0f);
+  std::array<std::uint32_t, kSubBlockSize> increments;
+
+  for (std::uint32_t start = 0; start < frames; start += kSubBlockSize) {
+    auto n = std::min(kSubBlockSize, frames - start);
+    auto peakFrequency = 0.0f;
+
+    for (std::uint32_t i = 0; i < n; ++i) {
+      auto scale = detuneConstant
+                       ? detuneScale
+                       : std::exp2(valueAt(detunes, start + i) / 1200.0f);
+      auto frequency = valueAt(frequencies, start + i) * scale;
+      increments[i] = detail::OscillatorKernel::toPhaseIncrement(
+          static_cast<double>(frequency) / sampleRate);
+      peakFrequency = std::max(peakFrequency, std::abs(frequency));
     }
+
+    // Choosing tables for the highest frequency in the sub-block keeps the
+    // whole sub-block free of aliasing.
+    render(peakFrequency, increments.data(), output + start, n);
+  }
+}
+
+void OscillatorNode::render(float frequency, std::uint32_t increment,
+                            float *output, std::uint32_t frames) {
+  if (type_ == OscillatorType::eSine) {
+    kernel_.processSine(increment, output, frames);
+    return;
   }
+
+  auto selection = wave_->selectTables(frequency);
+  kernel_.processTables(selection.table0, selection.table1, selection.weight,
+                        std::countr_zero(wave_->getTableSize()), increment,
+                        output, frames);
+}
+
+void OscillatorNode::render(float peakFrequency,
+                            const std::uint32_t *increments, float *output,
+                            std::uint32_t frames) {
+  if (type_ == OscillatorType::eSine) {
+    kernel_.processSine(increments, output, frames);
+    return;
+  }
+
+  auto selection = wave_->selectTables(peakFrequency);
+  kernel_.processTables(selection.table0, selection.table1, selection.weight,
+                        std::countr_zero(wave_->getTableSize()), increments,
+                        output, frames);
 }
 
 std::vector<std::shared_ptr<AudioParam>> OscillatorNode::getParams() const {
   return {frequency_, detune_};
 }
+
+void OscillatorNode::resetState() {
+  AudioScheduledSourceNode::resetState();
+  kernel_.setPhase(0);
+}
 } // namespace web_audio
\ No newline at end of file
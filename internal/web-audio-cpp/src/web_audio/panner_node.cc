@@ -0,0 +1,383 @@
+#include "web_audio/panner_node.hh"
+
+#include <algorithm>
+#include <limits>
+#include <span>
+
+#include "web_audio/audio_listener.hh"
+#include "web_audio/audio_param.hh"
+#include "web_audio/base_audio_context.hh"
+#include "web_audio/detail/equal_power_panner.hh"
+#include "web_audio/detail/vec3.hh"
+#include "web_audio/dom_exception.hh"
+
+namespace web_audio {
+namespace {
+void applyGain(float *samples, float gain, std::size_t frames) {
+  for (std::size_t i = 0; i < frames; ++i) {
+    samples[i] *= gain;
+  }
+}
+
+void applyGain(float *samples, const float *gain, std::size_t frames) {
+  for (std::size_t i = 0; i < frames; ++i) {
+    samples[i] *= gain[i];
+  }
+}
+} // namespace
+
+std::shared_ptr<PannerNode>
+PannerNode::create(std::shared_ptr<BaseAudioContext> context,
+                   const PannerOptions &options) {
+  auto node = std::shared_ptr<PannerNode>(new PannerNode());
+  node->initialize(context);
+  node->listener_ = context->getListener().get();
+
+  node->numberOfInputs_ = 1;
+  node->numberOfOutputs_ = 1;
+  node->setChannelCount(options.channelCount.value_or(2));
+  node->setChannelCountMode(
+      options.channelCountMode.value_or(ChannelCountMode::eClampedMax));
+  node->channelInterpretation_ =
+      options.channelInterpretation.value_or(ChannelInterpretation::eSpeakers);
+
+  auto createParam = [&](float defaultValue, float value) {
+    auto param = AudioParam::create(node, defaultValue,
+                                    std::numeric_limits<float>::lowest(),
+                                    std::numeric_limits<float>::max());
+    param->setValue(value);
+    return param;
+  };
+
+  node->positionX_ = createParam(0, options.positionX);
+  node->positionY_ = createParam(0, options.positionY);
+  node->positionZ_ = createParam(0, options.positionZ);
+  node->orientationX_ = createParam(1, options.orientationX);
+  node->orientationY_ = createParam(0, options.orientationY);
+  node->orientationZ_ = createParam(0, options.orientationZ);
+
+  // Room for a source per frame, should the params become automated.
+  node->batch_ = detail::SpatialBatch(context->getRenderQuantumSize());
+  node->pan_.resize(context->getRenderQuantumSize());
+  node->hrtfLoader_ = std::make_unique<detail::HrtfFilterLoader>(
+      context, context->getRenderQuantumSize());
+  node->setPanningModel(options.panningModel);
+  node->setDistanceModel(options.distanceModel);
+  node->setRefDistance(options.refDistance);
+  node->setMaxDistance(options.maxDistance);
+  node->setRolloffFactor(options.rolloffFactor);
+  node->setConeInnerAngle(options.coneInnerAngle);
+  node->setConeOuterAngle(options.coneOuterAngle);
+  node->setConeOuterGain(options.coneOuterGain);
+
+  return node;
+}
+
+PanningModelType PannerNode::getPanningModel() const { return panningModel_; }
+
+void PannerNode::setPanningModel(PanningModelType panningModel) {
+  panningModel_ = panningModel;
+
+  // Lets rendering start with the filter and its convolver in place.
+  if (panningModel == PanningModelType::eHRTF &&
+      getContext()->getHrtfDatabase()) {
+    float azimuth, elevation;
+    computeDirection(azimuth, elevation);
+    hrtfLoader_->preload(azimuth, elevation);
+  }
+}
+
+std::shared_ptr<AudioParam> PannerNode::getPositionX() const {
+  return positionX_;
+}
+
+std::shared_ptr<AudioParam> PannerNode::getPositionY() const {
+  return positionY_;
+}
+
+std::shared_ptr<AudioParam> PannerNode::getPositionZ() const {
+  return positionZ_;
+}
+
+std::shared_ptr<AudioParam> PannerNode::getOrientationX() const {
+  return orientationX_;
+}
+
+std::shared_ptr<AudioParam> PannerNode::getOrientationY() const {
+  return orientationY_;
+}
+
+std::shared_ptr<AudioParam> PannerNode::getOrientationZ() const {
+  return orientationZ_;
+}
+
+DistanceModelType PannerNode::getDistanceModel() const {
+  return distanceModel_;
+}
+
+void PannerNode::setDistanceModel(DistanceModelType distanceModel) {
+  distanceModel_ = distanceModel;
+}
+
+double PannerNode::getRefDistance() const { return refDistance_; }
+
+void PannerNode::setRefDistance(double refDistance) {
+  // SPEC: A RangeError exception MUST be thrown if this is set to a negative
+  // value.
+  if (refDistance < 0) {
+    throw DOMException("PannerNode: refDistance must not be negative",
+                       "RangeError");
+  }
+
+  refDistance_ = refDistance;
+}
+
+double PannerNode::getMaxDistance() const { return maxDistance_; }
+
+void PannerNode::setMaxDistance(double maxDistance) {
+  // SPEC: A RangeError exception MUST be thrown if this is set to a
+  // non-positive value.
+  if (!(maxDistance > 0)) {
+    throw DOMException("PannerNode: maxDistance must be positive",
+                       "RangeError");
+  }
+
+  maxDistance_ = maxDistance;
+}
+
+double PannerNode::getRolloffFactor() const { return rolloffFactor_; }
+
+void PannerNode::setRolloffFactor(double rolloffFactor) {
+  // SPEC: A RangeError exception MUST be thrown if this is set to a negative
+  // value.
+  if (rolloffFactor < 0) {
+    throw DOMException("PannerNode: rolloffFactor must not be negative",
+                       "RangeError");
+  }
+
+  rolloffFactor_ = rolloffFactor;
+}
+
+double PannerNode::getConeInnerAngle() const { return coneInnerAngle_; }
+
+void PannerNode::setConeInnerAngle(double coneInnerAngle) {
+  coneInnerAngle_ = coneInnerAngle;
+}
+
+double PannerNode::getConeOuterAngle() const { return coneOuterAngle_; }
+
+void PannerNode::setConeOuterAngle(double coneOuterAngle) {
+  coneOuterAngle_ = coneOuterAngle;
+}
+
+double PannerNode::getConeOuterGain() const { return coneOuterGain_; }
+
+void PannerNode::setConeOuterGain(double coneOuterGain) {
+  // SPEC: It is an InvalidStateError if set outside [0, 1].
+  if (!(coneOuterGain >= 0 && coneOuterGain <= 1)) {
+    throw DOMException("PannerNode: coneOuterGain must be in [0, 1]",
+                       "InvalidStateError");
+  }
+
+  coneOuterGain_ = coneOuterGain;
+}
+
+void PannerNode::setPosition(float x, float y, float z) {
+  positionX_->setValue(x);
+  positionY_->setValue(y);
+  positionZ_->setValue(z);
+}
+
+void PannerNode::setOrientation(float x, float y, float z) {
+  orientationX_->setValue(x);
+  orientationY_->setValue(y);
+  orientationZ_->setValue(z);
+}
+
+void PannerNode::setChannelCount(std::uint32_t channelCount) {
+  // SPEC: NotSupportedError exception MUST be thrown for any attempt to
+  // change it to a value greater than two.
+  if (channelCount > 2) {
+    throw DOMException("PannerNode: channelCount cannot be greater than 2",
+                       "NotSupportedError");
+  }
+
+  AudioNode::setChannelCount(channelCount);
+}
+
+void PannerNode::setChannelCountMode(ChannelCountMode channelCountMode) {
+  // SPEC: NotSupportedError exception MUST be thrown for any attempt to
+  // change it to "max".
+  if (channelCountMode == ChannelCountMode::eMax) {
+    throw DOMException("PannerNode: channelCountMode cannot be \"max\"",
+                       "NotSupportedError");
+  }
+
+  AudioNode::setChannelCountMode(channelCountMode);
+}
+
+std::vector<std::shared_ptr<AudioParam>> PannerNode::getParams() const {
+  return {positionX_,    positionY_,    positionZ_,
+          orientationX_, orientationY_, orientationZ_};
+}
+
+void PannerNode::process(const std::vector<detail::RenderQuantum> &inputs,
+                         std::vector<detail::RenderQuantum> &outputs,
+                         const detail::ParamCollection &params) {
+  auto &input = inputs[0];
+  auto &output = outputs[0];
+  auto frames = output.getLength();
+
+  output.reset(2);
+
+  if (input.getNumberOfChannels() == 0) {
+    return;
+  }
+
+  auto *left = output[0].data();
+  auto *right = output[1].data();
+  auto mono = input.getNumberOfChannels() == 1;
+  const auto &bases = listener_->bases_;
+  const auto &sourceParams = getRenderParams();
+  auto constant =
+      bases.size() == 1 &&
+      std::all_of(sourceParams.begin(), sourceParams.end(),
+                  [&](const auto &param) { return params.isConstant(param); });
+
+  fillBatch(params, constant ? 1 : frames);
+
+  if (bases.size() == 1) {
+    batch_.process(bases[0]);
+  } else {
+    batch_.process(bases.data());
+  }
+
+  const detail::HrtfFilter *filter = nullptr;
+
+  if (panningModel_ == PanningModelType::eHRTF) {
+    // The filter follows the direction at the start of the quantum; changes
+    // are crossfaded over one quantum by the convolver.
+    filter = hrtfLoader_->find(batch_.getAzimuths()[0],
+                               batch_.getElevations()[0],
+                               renderingContext_->getHrtfDatabaseGeneration());
+  }
+
+  if (filter) {
+    processHrtf(*filter, input, left, right);
+  } else if (constant) {
+    auto pan = azimuthToPan(batch_.getAzimuths()[0]);
+
+    if (mono) {
+      detail::EqualPowerPanner::processMono(input[0].data(), pan, left, right,
+                                            frames);
+    } else {
+      detail::EqualPowerPanner::processStereo(
+          input[0].data(), input[1].data(), pan, left, right, frames);
+    }
+  } else {
+    const auto *azimuths = batch_.getAzimuths();
+
+    for (std::uint32_t i = 0; i < frames; ++i) {
+      pan_[i] = azimuthToPan(azimuths[i]);
+    }
+
+    if (mono) {
+      detail::EqualPowerPanner::processMono(input[0].data(), pan_.data(),
+                                            left, right, frames);
+    } else {
+      detail::EqualPowerPanner::processStereo(input[0].data(),
+                                              input[1].data(), pan_.data(),
+                                              left, right, frames);
+    }
+  }
+
+  if (constant) {
+    applyGain(left, batch_.getGains()[0], frames);
+    applyGain(right, batch_.getGains()[0], frames);
+  } else {
+    applyGain(left, batch_.getGains(), frames);
+    applyGain(right, batch_.getGains(), frames);
+  }
+}
+
+void PannerNode::processHrtf(const detail::HrtfFilter &filter,
+                             const detail::RenderQuantum &input, float *left,
+                             float *right) {
+  auto stereo = input.getNumberOfChannels() > 1;
+  hrtfLoader_->getConvolver().process(input[0].data(),
+                                      stereo ? input[1].data() : nullptr,
+                                      filter, left, right);
+}
+
+void PannerNode::computeDirection(float &azimuth, float &elevation) const {
+  auto value = [](const std::shared_ptr<AudioParam> &param) {
+    return param->getValue();
+  };
+
+  auto listener = detail::ListenerBasis::create(
+      detail::Vec3(value(listener_->positionX), value(listener_->positionY),
+                   value(listener_->positionZ)),
+      detail::Vec3(value(listener_->forwardX), value(listener_->forwardY),
+                   value(listener_->forwardZ)),
+      detail::Vec3(value(listener_->upX), value(listener_->upY),
+                   value(listener_->upZ)));
+
+  detail::SpatialBatch batch(1);
+  batch.setPosition(0, value(positionX_), value(positionY_),
+                    value(positionZ_));
+  batch.setOrientation(0, value(orientationX_), value(orientationY_),
+                       value(orientationZ_));
+  batch.process(listener);
+  azimuth = batch.getAzimuths()[0];
+  elevation = batch.getElevations()[0];
+}
+
+float PannerNode::azimuthToPan(float azimuth) {
+  // SPEC: Clamp azimuth to allowed range of [-180, 180].
+  azimuth = std::clamp(azimuth, -180.0f, 180.0f);
+
+  // SPEC: Then wrap to range [-90, 90].
+  if (azimuth < -90) {
+    azimuth = -180 - azimuth;
+  } else if (azimuth > 90) {
+    azimuth = 180 - azimuth;
+  }
+
+  // Both the mono and the stereo formulas of the specification reduce to
+  // StereoPannerNode's with a pan of azimuth / 90.
+  return azimuth / 90;
+}
+
+// Loads the first `size` frames of the source params, with the distance and
+// cone attributes, into the batch.
+void PannerNode::fillBatch(const detail::ParamCollection &params,
+                           std::size_t size) {
+  batch_.resize(size);
+
+  // In the order of getParams(), which would build a vector.
+  const std::shared_ptr<AudioParam> *sourceParams[] = {
+      &positionX_,    &positionY_,    &positionZ_,
+      &orientationX_, &orientationY_, &orientationZ_};
+  std::span<const float> values[6];
+
+  for (std::size_t p = 0; p < 6; ++p) {
+    values[p] = params.getValues(*sourceParams[p]);
+  }
+
+  auto value = [&](std::size_t p, std::size_t frame) {
+    const auto &span = values[p];
+    return span.empty() ? 0.0f : span[std::min(frame, span.size() - 1)];
+  };
+
+  for (std::size_t i = 0; i < size; ++i) {
+    batch_.setPosition(i, value(0, i), value(1, i), value(2, i));
+    batch_.setOrientation(i, value(3, i), value(4, i), value(5, i));
+    batch_.setDistance(i, distanceModel_, static_cast<float>(refDistance_),
+                       static_cast<float>(maxDistance_),
+                       static_cast<float>(rolloffFactor_));
+    batch_.setCone(i, static_cast<float>(coneInnerAngle_),
+                   static_cast<float>(coneOuterAngle_),
+                   static_cast<float>(coneOuterGain_));
+  }
+}
+} // namespace web_audio
\ No newline at end of file
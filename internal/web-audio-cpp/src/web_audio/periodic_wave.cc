@@ -1,7 +1,14 @@
 #include "web_audio/periodic_wave.hh"
 
+#include "web_audio/detail/fft.hh"
+
+#include <algorithm>
 #include <cmath>
+#include <complex>
+#include <map>
+#include <mutex>
 #include <numbers>
+#include <utility>
 
 namespace web_audio {
 std::shared_ptr<PeriodicWave>
@@ -49,33 +56,192 @@ PeriodicWave::create(std::shared_ptr<BaseAudioContext> context,
   wave->imag_[0] = 0;
   wave->normalize_ = !options.disableNormalization;
 
-  wave->waveTable_.resize(wave->kTableSize);
+  wave->sampleRate_ = context->getSampleRate();
+  wave->tableSize_ = computeTableSize(wave->sampleRate_);
+  wave->buildTables();
+
+  return wave;
+}
+
+std::shared_ptr<PeriodicWave> PeriodicWave::getBuiltIn(float sampleRate,
+                                                     OscillatorType type) {
+  static std::mutex mutex;
+  static std::map<std::pair<float, OscillatorType>,
+                  std::shared_ptr<PeriodicWave>>
+      cache;
+
+  auto key = std::make_pair(sampleRate, type);
 
-  for (std::uint32_t t = 0; t < wave->kTableSize; ++t) {
-    float phase = static_cast<float>(t) / wave->kTableSize;
+  {
+    std::lock_guard<std::mutex> lock(mutex);
 
-    for (std::size_t i = 0; i < wave->real_.size(); ++i) {
-      float theta = 2.0f * static_cast<float>(std::numbers::pi) * phase * i;
-      wave->waveTable_[t] +=
-          wave->real_[i] * std::cos(theta) + wave->imag_[i] * std::sin(theta);
+    if (auto it = cache.find(key); it != cache.end()) {
+      return it->second;
     }
   }
 
-  if (wave->normalize_) {
+  // Build outside the lock; a concurrent build of the same key only wastes
+  // work, and the first one stored is shared from then on.
+  auto wave = createBuiltIn(sampleRate, type);
+
+  std::lock_guard<std::mutex> lock(mutex);
+  return cache.try_emplace(key, wave).first->second;
+}
+
+std::shared_ptr<PeriodicWave>
+PeriodicWave::createBuiltIn(float sampleRate, OscillatorType type) {
+  auto wave = std::shared_ptr<PeriodicWave>(new PeriodicWave());
+  wave->sampleRate_ = sampleRate;
+  wave->tableSize_ = computeTableSize(wave->sampleRate_);
+  wave->normalize_ = type != OscillatorType::eSine;
+
+  // Fourier series of the built-in waveforms as given by the spec.
+  auto size = type == OscillatorType::eSine ? 2 : wave->tableSize_ / 2;
+  wave->real_.assign(size, 0);
+  wave->imag_.assign(size, 0);
+
+  for (std::size_t n = 1; n < size; ++n) {
+    auto pi = std::numbers::pi;
+    auto odd = n % 2 == 1;
+
+    switch (type) {
+    case OscillatorType::eSine:
+      wave->imag_[n] = n == 1 ? 1 : 0;
+      break;
+    case OscillatorType::eSquare:
+      wave->imag_[n] = odd ? 4 / (n * pi) : 0;
+      break;
+    case OscillatorType::eSawtooth:
+      wave->imag_[n] = (odd ? 2 : -2) / (n * pi);
+      break;
+    case OscillatorType::eTriangle:
+      wave->imag_[n] = 8 * std::sin(n * pi / 2) / ((n * pi) * (n * pi));
+      break;
+    default:
+      throw std::invalid_argument("PeriodicWave: not a built-in type");
+    }
+  }
+
+  wave->buildTables();
+  return wave;
+}
+
+std::size_t PeriodicWave::computeTableSize(float sampleRate) {
+  // Larger tables hold more partials, so low notes at high sample rates keep
+  // their upper harmonics.
+  if (sampleRate <= 24000) {
+    return 2048;
+  } else if (sampleRate <= 88200) {
+    return 4096;
+  } else {
+    return 16384;
+  }
+}
+
+void PeriodicWave::buildTables() {
+  // Partials at or above half the table size cannot be represented.
+  auto maxPartials = std::min(real_.size() - 1, tableSize_ / 2 - 1);
+  levelPartials_.clear();
+
+  for (std::size_t level = 0;; ++level) {
+    auto partials = static_cast<std::size_t>(
+        maxPartials *
+        std::exp2(-static_cast<double>(level) / kRangesPerOctave));
+
+    levelPartials_.push_back(partials);
+
+    if (partials <= 1) {
+      break;
+    }
+  }
+
+  auto stride = tableSize_ + 1;
+  tables_.assign(stride * levelPartials_.size(), 0);
+
+  // Build from the narrowest level up, each level adding the partials that
+  // the next narrower one dropped to a shared spectrum and synthesizing the
+  // table with one inverse FFT.
+  detail::RealFFT<double> fft(tableSize_);
+  std::vector<std::complex<double>> spectrum(fft.getSpectrumSize());
+  std::vector<double> table(tableSize_);
+  std::size_t partial = 1;
+
+  for (auto level = levelPartials_.size(); level-- > 0;) {
+    for (; partial <= levelPartials_[level]; ++partial) {
+      // a cos(2 pi k t / N) + b sin(2 pi k t / N) is bin k of an N-point
+      // inverse transform with value N / 2 * (a - bi).
+      auto scale = static_cast<double>(tableSize_) / 2;
+      spectrum[partial] = std::complex<double>(scale * real_[partial],
+                                               -scale * imag_[partial]);
+    }
+
+    fft.inverse(spectrum.data(), table.data());
+
+    auto *destination = &tables_[level * stride];
+
+    for (std::size_t t = 0; t < tableSize_; ++t) {
+      destination[t] = static_cast<float>(table[t]);
+    }
+  }
+
+  if (normalize_) {
+    // Scale every level by the peak of the full-band table so that partial
+    // amplitudes stay the same across levels.
     float maxAmplitude = 0.0f;
 
-    for (const auto &sample : wave->waveTable_) {
-      maxAmplitude = std::max(maxAmplitude, std::abs(sample));
+    for (std::size_t t = 0; t < tableSize_; ++t) {
+      maxAmplitude = std::max(maxAmplitude, std::abs(tables_[t]));
     }
 
     if (maxAmplitude > 0.0f) {
-      for (auto &sample : wave->waveTable_) {
+      for (auto &sample : tables_) {
         sample /= maxAmplitude;
       }
     }
   }
 
-  return wave;
+  for (std::size_t level = 0; level < levelPartials_.size(); ++level) {
+    tables_[level * stride + tableSize_] = tables_[level * stride];
+  }
+}
+
+const float *PeriodicWave::getTable(std::size_t level) const {
+  return &tables_[level * (tableSize_ + 1)];
+}
+
+std::size_t PeriodicWave::getTableSize() const { return tableSize_; }
+
+std::size_t PeriodicWave::getNumberOfLevels() const {
+  return levelPartials_.size();
+}
+
+PeriodicWave::TableSelection
+PeriodicWave::selectTables(float frequency) const {
+  auto last = levelPartials_.size() - 1;
+  auto frequencyRatio =
+      std::abs(frequency) * levelPartials_[0] / (sampleRate_ / 2);
+
+  if (!(frequencyRatio > 0)) {
+    return {getTable(0), getTable(0), 0};
+  }
+
+  // Level k holds roughly levelPartials_[0] * 2^(-k / kRangesPerOctave)
+  // partials. Shifting by one level keeps both crossfaded tables below
+  // Nyquist.
+  auto position = kRangesPerOctave * std::log2(frequencyRatio) + 1;
+
+  if (position <= 0) {
+    return {getTable(0), getTable(0), 0};
+  }
+
+  auto level = static_cast<std::size_t>(position);
+
+  if (level >= last) {
+    return {getTable(last), getTable(last), 0};
+  }
+
+  return {getTable(level), getTable(level + 1),
+          static_cast<float>(position - level)};
 }
 
 float PeriodicWave::getSample(float phase) const {
@@ -84,10 +250,10 @@ float PeriodicWave::getSample(float phase) const {
   }
 
   // linear interpolation
-  float index = phase * kTableSize;
-  std::size_t index0 = static_cast<std::size_t>(std::floor(index)) % kTableSize;
-  std::size_t index1 = (index0 + 1) % kTableSize;
-  float frac = index - std::floor(index);
-  return (1.0f - frac) * waveTable_[index0] + frac * waveTable_[index1];
+  auto *table = getTable(0);
+  float index = phase * tableSize_;
+  auto index0 = std::min(static_cast<std::size_t>(index), tableSize_ - 1);
+  float frac = index - index0;
+  return table[index0] + frac * (table[index0 + 1] - table[index0]);
 }
 } // namespace web_audio
\ No newline at end of file
@@ -1,10 +1,7 @@
 #include "web_audio/stereo_panner_node.hh"
 
-#include <algorithm>
-#include <cmath>
-#include <numbers>
-
 #include "web_audio/audio_param.hh"
+#include "web_audio/detail/equal_power_panner.hh"
 
 namespace web_audio {
 std::shared_ptr<StereoPannerNode>
@@ -38,38 +35,40 @@ void StereoPannerNode::process(const std::vector<detail::RenderQuantum> &inputs,
                                const detail::ParamCollection &params) {
   auto &input = inputs[0];
   auto &output = outputs[0];
+  auto frames = output.getLength();
 
-  for (std::uint32_t i = 0; i < input.getLength(); i++) {
-    auto pan = params.getValue(pan_, i);
-    pan = std::max(-1.0f, pan);
-    pan = std::min(1.0f, pan);
-    float x;
+  // The output is stereo whatever the number of input channels.
+  output.reset(2);
 
-    if (input.getNumberOfChannels() == 1) {
-      x = (pan + 1) / 2;
-    } else {
-      if (pan <= 0) {
-        x = pan + 1;
-      } else {
-        x = pan;
-      }
-    }
+  if (input.getNumberOfChannels() == 0) {
+    return;
+  }
 
-    auto gainL = std::cos(x * std::numbers::pi / 2);
-    auto gainR = std::sin(x * std::numbers::pi / 2);
+  auto *left = output[0].data();
+  auto *right = output[1].data();
+
+  if (params.isConstant(pan_)) {
+    auto pan = params.getValue(pan_, 0);
 
     if (input.getNumberOfChannels() == 1) {
-      output[0][i] = input[0][i] * gainL;
-      output[1][i] = input[0][i] * gainR;
+      detail::EqualPowerPanner::processMono(input[0].data(), pan, left, right,
+                                            frames);
     } else {
-      if (pan <= 0) {
-        output[0][i] = input[0][i] + input[1][i] * gainL;
-        output[1][i] = input[1][i] * gainR;
-      } else {
-        output[0][i] = input[0][i] * gainL;
-        output[1][i] = input[1][i] + input[0][i] * gainR;
-      }
+      detail::EqualPowerPanner::processStereo(
+          input[0].data(), input[1].data(), pan, left, right, frames);
     }
+
+    return;
+  }
+
+  const auto *pan = params.getValues(pan_).data();
+
+  if (input.getNumberOfChannels() == 1) {
+    detail::EqualPowerPanner::processMono(input[0].data(), pan, left, right,
+                                          frames);
+  } else {
+    detail::EqualPowerPanner::processStereo(input[0].data(), input[1].data(),
+                                            pan, left, right, frames);
   }
 }
-} // namespace web_audio
+} // namespace web_audio
\ No newline at end of file
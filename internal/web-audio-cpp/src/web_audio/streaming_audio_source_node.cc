@@ -0,0 +1,169 @@
+#include "web_audio/streaming_audio_source_node.hh"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+#include "web_audio/base_audio_context.hh"
+#include "web_audio/dom_exception.hh"
+
+namespace web_audio {
+std::shared_ptr<StreamingAudioSourceNode>
+StreamingAudioSourceNode::create(std::shared_ptr<BaseAudioContext> context,
+                                 const StreamingAudioSourceOptions &options) {
+  auto node =
+      std::shared_ptr<StreamingAudioSourceNode>(new StreamingAudioSourceNode());
+  node->initialize(context);
+
+  node->numberOfInputs_ = 0;
+  node->numberOfOutputs_ = 1;
+  node->setChannelCount(options.channelCount.value_or(2));
+  node->setChannelCountMode(
+      options.channelCountMode.value_or(ChannelCountMode::eMax));
+  node->setChannelInterpretation(
+      options.channelInterpretation.value_or(ChannelInterpretation::eSpeakers));
+
+  auto sampleRate = context->getSampleRate();
+  auto blocks = static_cast<std::uint32_t>(
+      std::ceil(std::max(options.bufferDuration, 0.0) * sampleRate /
+                detail::AudioFileStream::kBlockFrames));
+
+  try {
+    node->stream_ =
+        std::make_unique<detail::AudioFileStream>(options.path, blocks);
+  } catch (const std::invalid_argument &e) {
+    throw DOMException(std::string("StreamingAudioSourceNode: ") + e.what(),
+                       "NotSupportedError");
+  } catch (const std::runtime_error &e) {
+    throw DOMException(std::string("StreamingAudioSourceNode: ") + e.what(),
+                       "NotReadableError");
+  }
+
+  if (static_cast<float>(node->stream_->getFormat().sampleRate) !=
+      sampleRate) {
+    throw DOMException("StreamingAudioSourceNode: file sample rate must match "
+                       "context sample rate",
+                       "NotSupportedError");
+  }
+
+  node->destinations_.resize(node->getNumberOfChannels());
+  node->loop_ = options.loop;
+  node->loopStart_ = options.loopStart;
+  node->loopEnd_ = options.loopEnd;
+  node->updateLoop();
+  node->dt_ = 1.0 / sampleRate;
+
+  return node;
+}
+
+double StreamingAudioSourceNode::getDuration() const {
+  const auto &format = stream_->getFormat();
+  return static_cast<double>(format.length) / format.sampleRate;
+}
+
+std::uint32_t StreamingAudioSourceNode::getNumberOfChannels() const {
+  return stream_->getFormat().numberOfChannels;
+}
+
+bool StreamingAudioSourceNode::getLoop() const { return loop_; }
+
+void StreamingAudioSourceNode::setLoop(bool loop) {
+  loop_ = loop;
+  updateLoop();
+}
+
+double StreamingAudioSourceNode::getLoopStart() const { return loopStart_; }
+
+void StreamingAudioSourceNode::setLoopStart(double loopStart) {
+  loopStart_ = loopStart;
+  updateLoop();
+}
+
+double StreamingAudioSourceNode::getLoopEnd() const { return loopEnd_; }
+
+void StreamingAudioSourceNode::setLoopEnd(double loopEnd) {
+  loopEnd_ = loopEnd;
+  updateLoop();
+}
+
+void StreamingAudioSourceNode::start(double when, double offset) {
+  if (offset < 0) {
+    throw DOMException(
+        "StreamingAudioSourceNode: offset must be a positive value",
+        "RangeError");
+  }
+
+  if (offset > 0) {
+    seek(offset);
+  }
+
+  AudioScheduledSourceNode::start(when);
+}
+
+void StreamingAudioSourceNode::seek(double time) {
+  stream_->seek(toFrame(time));
+}
+
+void StreamingAudioSourceNode::prime() { stream_->prime(); }
+
+std::uint64_t StreamingAudioSourceNode::getUnderrunCount() const {
+  return stream_->getUnderrunCount();
+}
+
+void StreamingAudioSourceNode::process(
+    const std::vector<detail::RenderQuantum> &inputs,
+    std::vector<detail::RenderQuantum> &outputs,
+    const detail::ParamCollection &params) {
+  auto &output = outputs[0];
+  auto frames = output.getLength();
+  output.reset(getNumberOfChannels());
+
+  auto currentTime = renderingContext_->getCurrentTime();
+  std::uint32_t begin = frames;
+  std::uint32_t end = frames;
+
+  // The frames of this quantum between the scheduled start and stop times.
+  for (std::uint32_t i = 0; i < frames; ++i) {
+    auto time = currentTime + i * dt_;
+
+    if (begin == frames && time >= startTime_ && time < stopTime_) {
+      begin = i;
+    }
+
+    if (begin != frames && time >= stopTime_) {
+      end = i;
+      break;
+    }
+  }
+
+  if (begin == frames) {
+    return;
+  }
+
+  for (std::uint32_t ch = 0; ch < destinations_.size(); ++ch) {
+    destinations_[ch] = output[ch].data() + begin;
+  }
+
+  stream_->read(destinations_.data(), end - begin);
+}
+
+std::uint32_t StreamingAudioSourceNode::toFrame(double time) const {
+  const auto &format = stream_->getFormat();
+  auto frame = std::llround(std::max(time, 0.0) * format.sampleRate);
+  return static_cast<std::uint32_t>(
+      std::min<long long>(frame, format.length));
+}
+
+void StreamingAudioSourceNode::updateLoop() {
+  auto loopStart = toFrame(loopStart_);
+  auto loopEnd = toFrame(loopEnd_);
+
+  // Like AudioBufferSourceNode, an invalid region loops the whole file.
+  if (loopEnd_ <= 0 || loopStart >= loopEnd) {
+    loopStart = 0;
+    loopEnd = stream_->getFormat().length;
+  }
+
+  stream_->setLoop(loop_, loopStart, loopEnd);
+}
+} // namespace web_audio
\ No newline at end of file
@@ -0,0 +1,139 @@
+#include "web_audio/voice.hh"
+
+#include <algorithm>
+
+#include "web_audio/audio_param.hh"
+#include "web_audio/detail/audio_graph.hh"
+
+namespace web_audio {
+namespace {
+/**
+ * The node `output` leads to: its destination node, or the owner of its
+ * destination param. Null if that has expired.
+ */
+std::shared_ptr<AudioNode>
+getDestinationNode(const detail::AudioNodeOutput &output) {
+  if (auto node = std::get_if<std::weak_ptr<AudioNode>>(&output.destination)) {
+    return node->lock();
+  }
+
+  auto &param = std::get<std::weak_ptr<AudioParam>>(output.destination);
+
+  if (auto locked = param.lock()) {
+    return locked->owner_.lock();
+  }
+
+  return nullptr;
+}
+} // namespace
+
+const std::vector<std::shared_ptr<AudioNode>> &Voice::getNodes() const {
+  return nodes_;
+}
+
+Voice::Voice(std::vector<std::shared_ptr<AudioNode>> nodes)
+    : nodes_(std::move(nodes)) {
+  for (const auto &node : nodes_) {
+    for (const auto &param : node->getParams()) {
+      params_.push_back({param, param->currentValue_, param->automationRate_});
+    }
+  }
+
+  for (const auto &source : getSources()) {
+    for (const auto &output : source->outputs_) {
+      if (crosses(*source, output)) {
+        connections_.push_back({source, output});
+      }
+    }
+  }
+}
+
+bool Voice::contains(const AudioNode *node) const {
+  // Voices hold a handful of nodes.
+  return std::any_of(nodes_.begin(), nodes_.end(),
+                     [&](const auto &n) { return n.get() == node; });
+}
+
+bool Voice::crosses(const AudioNode &source,
+                    const detail::AudioNodeOutput &output) const {
+  auto destination = getDestinationNode(output);
+  return destination && contains(&source) != contains(destination.get());
+}
+
+std::vector<std::shared_ptr<AudioNode>> Voice::getSources() const {
+  auto sources = nodes_;
+
+  auto addSource = [&](const detail::AudioNodeInput &input) {
+    auto source = input.source.lock();
+
+    if (source && std::find(sources.begin(), sources.end(), source) ==
+                      sources.end()) {
+      sources.push_back(std::move(source));
+    }
+  };
+
+  for (const auto &node : nodes_) {
+    std::for_each(node->inputs_.begin(), node->inputs_.end(), addSource);
+
+    for (const auto &param : node->getParams()) {
+      std::for_each(param->inputs_.begin(), param->inputs_.end(), addSource);
+    }
+  }
+
+  return sources;
+}
+
+void Voice::attach(detail::AudioGraph &graph) {
+  for (const auto &node : nodes_) {
+    graph.addNode(node);
+  }
+
+  for (const auto &connection : connections_) {
+    auto source = connection.source.lock();
+    const auto &output = connection.output;
+
+    if (!source) {
+      continue;
+    }
+
+    if (auto node =
+            std::get_if<std::weak_ptr<AudioNode>>(&output.destination)) {
+      if (auto locked = node->lock()) {
+        source->connect(locked, output.sourceIndex, output.destinationIndex);
+      }
+    } else {
+      auto &param = std::get<std::weak_ptr<AudioParam>>(output.destination);
+
+      if (auto locked = param.lock()) {
+        source->connect(locked, output.sourceIndex);
+      }
+    }
+  }
+}
+
+void Voice::detach(detail::AudioGraph &graph) {
+  for (const auto &source : getSources()) {
+    for (std::size_t i = source->outputs_.size(); i-- > 0;) {
+      if (crosses(*source, source->outputs_[i])) {
+        source->disconnectInternal(i);
+      }
+    }
+  }
+
+  for (const auto &node : nodes_) {
+    graph.removeNode(node);
+  }
+}
+
+void Voice::resetParams() {
+  for (const auto &state : params_) {
+    state.param->reset(state.value, state.automationRate);
+  }
+}
+
+void Voice::resetState() {
+  for (const auto &node : nodes_) {
+    node->resetState();
+  }
+}
+} // namespace web_audio
\ No newline at end of file
@@ -0,0 +1,129 @@
+#include "web_audio/voice_pool.hh"
+
+#include <thread>
+
+#include "web_audio/base_audio_context.hh"
+#include "web_audio/dom_exception.hh"
+
+namespace web_audio {
+VoicePool::VoicePool(std::shared_ptr<BaseAudioContext> context,
+                     VoiceBuilder builder, std::uint32_t maxVoices)
+    : context_(context), builder_(std::move(builder)), maxVoices_(maxVoices),
+      freeVoices_(maxVoices) {}
+
+VoicePool::~VoicePool() {
+  // The rendering thread handles every message before it terminates.
+  while (pendingRecycles_.load(std::memory_order_acquire) > 0) {
+    std::this_thread::yield();
+  }
+}
+
+std::shared_ptr<VoicePool>
+VoicePool::create(std::shared_ptr<BaseAudioContext> context,
+                  VoiceBuilder builder, const VoicePoolOptions &options) {
+  if (options.maxVoices == 0 || options.maxVoices < options.initialVoices) {
+    throw DOMException(
+        "VoicePool: maxVoices must be at least 1 and at least initialVoices",
+        "NotSupportedError");
+  }
+
+  if (!builder) {
+    throw DOMException("VoicePool: builder must not be empty",
+                       "NotSupportedError");
+  }
+
+  auto pool = std::shared_ptr<VoicePool>(
+      new VoicePool(context, std::move(builder), options.maxVoices));
+
+  // Fresh voices have no rendering state to reset.
+  for (std::uint32_t i = 0; i < options.initialVoices; ++i) {
+    auto voice = pool->build(context);
+    voice->detach(context->audioGraph_);
+    pool->freeVoices_.tryPush(voice);
+    ++pool->freeVoiceCount_;
+  }
+
+  context->updateRenderOrder();
+
+  return pool;
+}
+
+std::shared_ptr<Voice> VoicePool::acquire() {
+  auto context = context_.lock();
+
+  if (!context) {
+    throw std::runtime_error("VoicePool: context has expired");
+  }
+
+  Voice *voice;
+
+  if (auto recycled = freeVoices_.tryPop()) {
+    --freeVoiceCount_;
+    voice = *recycled;
+    voice->attach(context->audioGraph_);
+  } else if (voices_.size() < maxVoices_) {
+    // A new voice is built in the graph.
+    voice = build(context);
+  } else {
+    return nullptr;
+  }
+
+  context->updateRenderOrder();
+
+  // The pool outlives every voice it hands out.
+  return std::shared_ptr<Voice>(
+      voice, [pool = shared_from_this()](Voice *voice) {
+        pool->release(voice);
+      });
+}
+
+std::size_t VoicePool::getVoiceCount() const { return voices_.size(); }
+
+std::size_t VoicePool::getFreeVoiceCount() const {
+  return freeVoiceCount_.load();
+}
+
+Voice *VoicePool::build(std::shared_ptr<BaseAudioContext> context) {
+  auto nodes = builder_(context);
+
+  if (nodes.empty()) {
+    throw DOMException("VoicePool: a voice must have at least one node",
+                       "NotSupportedError");
+  }
+
+  for (const auto &node : nodes) {
+    if (!node || node->getContext() != context) {
+      throw DOMException(
+          "VoicePool: the nodes of a voice must belong to its context",
+          "InvalidAccessError");
+    }
+  }
+
+  voices_.push_back(std::unique_ptr<Voice>(new Voice(std::move(nodes))));
+  return voices_.back().get();
+}
+
+void VoicePool::release(Voice *voice) {
+  auto context = context_.lock();
+
+  if (!context) {
+    // Nothing renders the nodes any more.
+    freeVoices_.tryPush(voice);
+    ++freeVoiceCount_;
+    return;
+  }
+
+  voice->detach(context->audioGraph_);
+  voice->resetParams();
+  pendingRecycles_.fetch_add(1, std::memory_order_relaxed);
+  context->queueMessage(detail::MessageVoicePoolRecycle{this, voice});
+}
+
+void VoicePool::recycle(Voice *voice) {
+  voice->resetState();
+  freeVoices_.tryPush(voice);
+  ++freeVoiceCount_;
+  // The pool may be destroyed from here on.
+  pendingRecycles_.fetch_sub(1, std::memory_order_release);
+}
+} // namespace web_audio
\ No newline at end of file
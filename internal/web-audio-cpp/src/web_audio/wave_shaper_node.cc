@@ -18,44 +18,53 @@ WaveShaperNode::create(std::shared_ptr<BaseAudioContext> context,
   node->channelInterpretation_ =
       options.channelInterpretation.value_or(ChannelInterpretation::eSpeakers);
 
-  node->curve_ = options.curve;
+  node->curve_ = createCurve(options.curve);
   node->oversample_ = options.oversample;
+  node->state_ = std::make_shared<detail::WaveShaperState>();
+  node->state_->curve = node->curve_;
+  node->state_->oversampler = node->createOversampler();
   return node;
 }
 
 std::optional<std::vector<float>> WaveShaperNode::getCurve() const {
-  return curve_;
+  if (!curve_) {
+    return std::nullopt;
+  }
+
+  return curve_->values;
 }
 
 void WaveShaperNode::setCurve(const std::optional<std::vector<float>> &curve) {
-  // SPEC: A InvalidStateError MUST be thrown if this attribute is set with a
-  // Float32Array that has a length less than 2.
-  if (curve.has_value() && curve->size() < 2) {
-    throw DOMException("WaveShaperNode: curve length must be at least 2",
-                       "InvalidStateError");
-  }
+  curve_ = createCurve(curve);
+  updateCurve();
+}
 
-  curve_ = curve;
+void WaveShaperNode::shareCurve(const WaveShaperNode &source) {
+  curve_ = source.curve_;
+  updateCurve();
 }
 
 OverSampleType WaveShaperNode::getOversample() const { return oversample_; }
 
 void WaveShaperNode::setOversample(OverSampleType oversample) {
   oversample_ = oversample;
+  updateOversampler();
+}
 
-  if (oversample_ == OverSampleType::eNone) {
-    upsampler_.reset();
-    downsampler_.reset();
-  } else if (oversample_ == OverSampleType::e2x) {
-    upsampler_ = std::make_unique<detail::Upsampler2x>(
-        getContext()->getRenderQuantumSize());
-    downsampler_ = std::make_unique<detail::Downsampler2x>(
-        getContext()->getRenderQuantumSize());
-  } else if (oversample_ == OverSampleType::e4x) {
-    upsampler_ = std::make_unique<detail::Upsampler4x>(
-        getContext()->getRenderQuantumSize());
-    downsampler_ = std::make_unique<detail::Downsampler4x>(
-        getContext()->getRenderQuantumSize());
+detail::ResamplerType WaveShaperNode::getResamplerType() const {
+  return resamplerType_;
+}
+
+void WaveShaperNode::setResamplerType(detail::ResamplerType resamplerType) {
+  resamplerType_ = resamplerType;
+  updateOversampler();
+}
+
+void WaveShaperNode::setChannelCount(std::uint32_t channelCount) {
+  AudioNode::setChannelCount(channelCount);
+
+  if (oversample_ != OverSampleType::eNone) {
+    updateOversampler();
   }
 }
 
@@ -65,51 +74,99 @@ void WaveShaperNode::process(const std::vector<detail::RenderQuantum> &inputs,
   auto &input = inputs[0];
   auto &output = outputs[0];
 
-  std::vector<std::vector<float>> resampled;
+  auto *curve = state_->curve.get();
+  auto *oversampler = state_->oversampler.get();
 
-  if (upsampler_) {
-    for (std::uint32_t ch = 0; ch < input.getNumberOfChannels(); ++ch) {
-      std::vector<float> upsampledChannel;
-      upsampler_->process(input[ch], upsampledChannel);
-      resampled.push_back(std::move(upsampledChannel));
-    }
-  } else {
-    for (std::uint32_t ch = 0; ch < input.getNumberOfChannels(); ++ch) {
-      resampled.push_back(input[ch]);
-    }
+  if (oversampler &&
+      oversampler->getNumberOfChannels() < output.getNumberOfChannels()) {
+    oversampler->setNumberOfChannels(output.getNumberOfChannels());
   }
 
-  if (curve_) {
-    auto curve = *curve_;
-
-    for (std::uint32_t i = 0; i < resampled[0].size(); ++i) {
-      auto N = curve.size();
-      auto v = (N - 1) / 2.0 * (resampled[0][i] + 1.0f);
-      auto k = static_cast<std::uint32_t>(v);
-      auto f = v - k;
-
-      for (std::uint32_t ch = 0; ch < resampled.size(); ++ch) {
-        if (v < 0) {
-          resampled[ch][i] = curve[0];
-        } else if (v >= N - 1) {
-          resampled[ch][i] = curve[N - 1];
-        } else {
-          resampled[ch][i] = (1 - f) * curve[k] + f * curve[k + 1];
-        }
+  for (std::uint32_t ch = 0; ch < output.getNumberOfChannels(); ++ch) {
+    if (!oversampler) {
+      std::copy(input[ch].begin(), input[ch].end(), output[ch].begin());
+
+      if (curve) {
+        applyCurve(curve->values, curve->slopes, output[ch].data(),
+                   output[ch].size());
       }
-    }
-  }
 
-  if (downsampler_) {
-    for (std::uint32_t ch = 0; ch < output.getNumberOfChannels(); ++ch) {
-      std::vector<float> downsampledChannel;
-      downsampler_->process(resampled[ch], downsampledChannel);
-      output[ch] = std::move(downsampledChannel);
+      continue;
     }
-  } else {
-    for (std::uint32_t ch = 0; ch < output.getNumberOfChannels(); ++ch) {
-      output[ch] = resampled[ch];
+
+    auto &channel = oversampler->getChannel(ch);
+    channel.upsampler->process(input[ch], channel.oversampled);
+
+    if (curve) {
+      applyCurve(curve->values, curve->slopes, channel.oversampled.data(),
+                 channel.oversampled.size());
     }
+
+    channel.downsampler->process(channel.oversampled, output[ch]);
+  }
+}
+
+void WaveShaperNode::applyCurve(const std::vector<float> &curve,
+                                const std::vector<float> &slopes, float *data,
+                                std::size_t size) {
+  const auto lastIndex = static_cast<std::uint32_t>(curve.size() - 1);
+  const auto scale = lastIndex * 0.5f;
+  const auto maxPosition = static_cast<float>(lastIndex);
+
+  // Branch-free so that the index and fraction math vectorizes; the table
+  // lookups remain scalar gathers.
+  for (std::size_t i = 0; i < size; ++i) {
+    auto v = (data[i] + 1.0f) * scale;
+    // Written so that NaN maps to the first curve value.
+    v = v > 0.0f ? v : 0.0f;
+    v = v < maxPosition ? v : maxPosition;
+    auto k = std::min(static_cast<std::uint32_t>(v), lastIndex - 1);
+    data[i] = curve[k] + slopes[k] * (v - static_cast<float>(k));
   }
 }
-} // namespace web_audio
+
+std::shared_ptr<detail::WaveShaperOversampler>
+WaveShaperNode::createOversampler() const {
+  if (oversample_ == OverSampleType::eNone) {
+    return nullptr;
+  }
+
+  auto factor = oversample_ == OverSampleType::e2x ? 2 : 4;
+  return std::make_shared<detail::WaveShaperOversampler>(
+      resamplerType_, factor, renderQuantumSize_, channelCount_);
+}
+
+std::shared_ptr<const detail::WaveShaperCurve>
+WaveShaperNode::createCurve(const std::optional<std::vector<float>> &curve) {
+  // SPEC: A InvalidStateError MUST be thrown if this attribute is set with a
+  // Float32Array that has a length less than 2.
+  if (curve.has_value() && curve->size() < 2) {
+    throw DOMException("WaveShaperNode: curve length must be at least 2",
+                       "InvalidStateError");
+  }
+
+  if (!curve) {
+    return nullptr;
+  }
+
+  auto shared = std::make_shared<detail::WaveShaperCurve>();
+  shared->values = *curve;
+  shared->slopes.resize(curve->size() - 1);
+
+  for (std::size_t k = 0; k + 1 < curve->size(); ++k) {
+    shared->slopes[k] = (*curve)[k + 1] - (*curve)[k];
+  }
+
+  return shared;
+}
+
+void WaveShaperNode::updateCurve() {
+  getContext()->queueMessage(
+      detail::MessageWaveShaperNodeCurve{state_, curve_});
+}
+
+void WaveShaperNode::updateOversampler() {
+  getContext()->queueMessage(
+      detail::MessageWaveShaperNodeOversampler{state_, createOversampler()});
+}
+} // namespace web_audio
\ No newline at end of file
@@ -0,0 +1,158 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <numbers>
+#include <thread>
+
+#include "test_helper.hh"
+#include "web_audio/detail/snapshot_ring.hh"
+
+using namespace web_audio;
+
+namespace {
+void writeSine(detail::SnapshotRing &ring, double frequency,
+               std::size_t frames) {
+  std::vector<float> samples(frames);
+
+  for (std::size_t i = 0; i < frames; ++i) {
+    samples[i] = static_cast<float>(std::sin(frequency * i));
+  }
+
+  ring.write(samples.data(), frames);
+}
+} // namespace
+
+TEST(TestAnalyserNode, Attributes) {
+  auto context = TestHelper::createOfflineContext();
+  auto analyser = AnalyserNode::create(context);
+
+  EXPECT_EQ(analyser->getFftSize(), 2048);
+  EXPECT_EQ(analyser->getFrequencyBinCount(), 1024);
+  EXPECT_THROW(analyser->setFftSize(1000), DOMException);
+  EXPECT_THROW(analyser->setFftSize(16), DOMException);
+  EXPECT_THROW(analyser->setMinDecibels(-30), DOMException);
+  EXPECT_THROW(analyser->setMaxDecibels(-100), DOMException);
+  EXPECT_THROW(analyser->setSmoothingTimeConstant(1.5), DOMException);
+
+  AnalyzerOptions options;
+  options.minDecibels = -10;
+  EXPECT_THROW(AnalyserNode::create(context, options), DOMException);
+}
+
+TEST(TestAnalyserNode, TimeDomainData) {
+  auto context = TestHelper::createOfflineContext();
+  auto source = ConstantSourceNode::create(context);
+  source->getOffset()->setValue(0.5f);
+  AnalyzerOptions options;
+  options.fftSize = 32;
+  auto analyser = AnalyserNode::create(context, options);
+
+  source->connect(analyser);
+  analyser->connect(context->getDestination());
+
+  auto rendered = TestHelper::renderOffline(context);
+
+  // The signal is passed through.
+  EXPECT_NEAR(rendered->getChannelData(0)[0], 0.5f, 1e-6);
+
+  std::vector<float> samples(32);
+  analyser->getFloatTimeDomainData(samples);
+
+  for (auto sample : samples) {
+    EXPECT_FLOAT_EQ(sample, 0.5f);
+  }
+
+  std::vector<std::uint8_t> bytes(32);
+  analyser->getByteTimeDomainData(bytes);
+
+  for (auto byte : bytes) {
+    EXPECT_EQ(byte, 192);
+  }
+}
+
+TEST(TestAnalyserNode, FrequencyData) {
+  constexpr std::uint32_t kFFTSize = 256;
+  constexpr std::size_t kBin = 8;
+  auto context = TestHelper::createOfflineContext();
+  AnalyzerOptions options;
+  options.fftSize = kFFTSize;
+  options.smoothingTimeConstant = 0;
+  auto analyser = AnalyserNode::create(context, options);
+
+  writeSine(analyser->ring_, 2 * std::numbers::pi * kBin / kFFTSize,
+            kFFTSize);
+
+  std::vector<float> decibels(kFFTSize / 2);
+  analyser->getFloatFrequencyData(decibels);
+
+  auto peak = std::max_element(decibels.begin(), decibels.end());
+  EXPECT_EQ(peak - decibels.begin(), kBin);
+  // A unit sine peaks at a0 / 2 of the Blackman window.
+  EXPECT_NEAR(*peak, 20 * std::log10(0.42 / 2), 0.1);
+
+  std::vector<std::uint8_t> bytes(kFFTSize / 2);
+  analyser->getByteFrequencyData(bytes);
+  EXPECT_EQ(bytes[kBin], 255);
+  EXPECT_EQ(bytes[kFFTSize / 2 - 1], 0);
+}
+
+TEST(TestAnalyserNode, SmoothingOncePerQuantum) {
+  constexpr std::uint32_t kFFTSize = 128;
+  auto context = TestHelper::createOfflineContext();
+  AnalyzerOptions options;
+  options.fftSize = kFFTSize;
+  options.smoothingTimeConstant = 0.5;
+  auto analyser = AnalyserNode::create(context, options);
+
+  writeSine(analyser->ring_, 2 * std::numbers::pi * 4 / kFFTSize, kFFTSize);
+
+  std::vector<float> first(kFFTSize / 2), second(kFFTSize / 2);
+  analyser->getFloatFrequencyData(first);
+  analyser->getFloatFrequencyData(second);
+  EXPECT_EQ(first, second);
+
+  // The same block once more: halfway from the smoothed value to it.
+  writeSine(analyser->ring_, 2 * std::numbers::pi * 4 / kFFTSize, kFFTSize);
+  analyser->getFloatFrequencyData(second);
+  EXPECT_NEAR(second[4], first[4] + 20 * std::log10(1.5), 1e-3);
+}
+
+TEST(TestAnalyserNode, ConcurrentSnapshots) {
+  constexpr std::size_t kFrames = 1024;
+  constexpr float kTotal = 1 << 21;
+  detail::SnapshotRing ring(4096);
+  std::atomic<bool> done{false};
+
+  std::thread writer([&] {
+    float block[128];
+    float next = 1;
+
+    while (next < kTotal) {
+      for (auto &sample : block) {
+        sample = next++;
+      }
+
+      ring.write(block, 128);
+    }
+
+    done = true;
+  });
+
+  std::vector<float> snapshot(kFrames);
+  std::size_t torn = 0;
+
+  while (!done) {
+    ring.read(snapshot.data(), kFrames);
+
+    for (std::size_t i = 1; i < kFrames; ++i) {
+      if (snapshot[i - 1] != 0 && snapshot[i] != snapshot[i - 1] + 1) {
+        ++torn;
+      }
+    }
+  }
+
+  writer.join();
+  EXPECT_EQ(torn, 0);
+}
\ No newline at end of file
@@ -1,9 +1,29 @@
 #include <gtest/gtest.h>
 
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <string>
+
 #include "web_audio/audio_buffer.hh"
 
 using namespace web_audio;
 
+namespace {
+template <typename T>
+std::string writeTemporaryFile(const std::string &name,
+                               const std::vector<T> &samples,
+                               std::size_t headerSize = 0) {
+  auto path = (std::filesystem::temp_directory_path() / name).string();
+  std::ofstream file(path, std::ios::binary);
+  std::string header(headerSize, 'h');
+  file.write(header.data(), header.size());
+  file.write(reinterpret_cast<const char *>(samples.data()),
+             samples.size() * sizeof(T));
+  return path;
+}
+} // namespace
+
 TEST(TestAudioBuffer, Create) {
   AudioBufferOptions options;
   options.numberOfChannels = 2;
@@ -43,8 +63,8 @@ TEST(TestAudioBuffer, CopyFromToChannel) {
   options.sampleRate = 44100.0f;
 
   auto buffer = AudioBuffer::create(options);
-  auto &ch0 = buffer->getChannelData(0);
-  auto &ch1 = buffer->getChannelData(1);
+  auto &ch0 = buffer->getWritableChannelData(0);
+  auto &ch1 = buffer->getWritableChannelData(1);
 
   for (std::uint32_t i = 0; i < buffer->getLength(); ++i) {
     ch0[i] = static_cast<float>(i) / static_cast<float>(buffer->getLength());
@@ -123,4 +143,146 @@ TEST(TestAudioBuffer, GetChannelDataOutOfRange) {
 
   auto buffer = AudioBuffer::create(options);
   EXPECT_THROW(buffer->getChannelData(2), DOMException);
+}
+
+TEST(TestAudioBuffer, CopySharesUntilWritten) {
+  AudioBufferOptions options;
+  options.numberOfChannels = 2;
+  options.length = 16;
+  options.sampleRate = 44100.0f;
+  auto buffer = AudioBuffer::create(options);
+  buffer->getWritableChannelData(0)[3] = 1.0f;
+
+  auto copy = buffer->copy();
+  EXPECT_TRUE(copy->sharesChannelData(*buffer, 0));
+  EXPECT_TRUE(copy->sharesChannelData(*buffer, 1));
+
+  // Reading keeps the storage shared.
+  std::shared_ptr<const AudioBuffer> snapshot = copy;
+  EXPECT_EQ(snapshot->getChannelData(0)[3], 1.0f);
+  EXPECT_EQ(buffer->getChannelData(0)[3], 1.0f);
+  EXPECT_TRUE(copy->sharesChannelData(*buffer, 0));
+
+  buffer->getWritableChannelData(0)[3] = 2.0f;
+  EXPECT_FALSE(copy->sharesChannelData(*buffer, 0));
+  EXPECT_TRUE(copy->sharesChannelData(*buffer, 1));
+  EXPECT_EQ(snapshot->getChannelData(0)[3], 1.0f);
+  EXPECT_EQ(buffer->getChannelData(0)[3], 2.0f);
+
+  buffer->copyToChannel(std::vector<float>{5.0f}, 1);
+  EXPECT_FALSE(copy->sharesChannelData(*buffer, 1));
+  EXPECT_EQ(snapshot->getChannelData(1)[0], 0.0f);
+  EXPECT_EQ(buffer->getChannelData(1)[0], 5.0f);
+}
+
+TEST(TestAudioBuffer, UnsharedWriteDoesNotCopy) {
+  AudioBufferOptions options;
+  options.numberOfChannels = 1;
+  options.length = 16;
+  options.sampleRate = 44100.0f;
+  auto buffer = AudioBuffer::create(options);
+  auto *data = buffer->getWritableChannelData(0).data();
+
+  {
+    auto copy = buffer->copy();
+  }
+
+  EXPECT_EQ(buffer->getWritableChannelData(0).data(), data);
+}
+
+TEST(TestAudioBuffer, MappedPlanar) {
+  // Two channels of 3 frames after an 8-byte header.
+  auto path = writeTemporaryFile<float>(
+      "web_audio_mapped_planar.raw", {1, 2, 3, -1, -2, -3}, 8);
+  MappedAudioBufferOptions options;
+  options.numberOfChannels = 2;
+  options.sampleRate = 44100.0f;
+  options.byteOffset = 8;
+  auto buffer = AudioBuffer::createMapped(path, options);
+
+  EXPECT_EQ(buffer->getLength(), 3u);
+  auto right = buffer->acquireChannel(1, 0, 3);
+  EXPECT_EQ(std::vector<float>(right.begin(), right.end()),
+            (std::vector<float>{-1, -2, -3}));
+
+  std::vector<float> destination(2);
+  buffer->copyFromChannel(destination, 0, 1);
+  EXPECT_EQ(destination, (std::vector<float>{2, 3}));
+
+  // Writing copies the channel to the heap and leaves the file alone.
+  auto copy = buffer->copy();
+  EXPECT_TRUE(copy->sharesChannelData(*buffer, 0));
+  buffer->getWritableChannelData(0)[0] = 5;
+  EXPECT_FALSE(copy->sharesChannelData(*buffer, 0));
+  EXPECT_EQ(copy->acquireChannel(0, 0, 3)[0], 1.0f);
+  EXPECT_EQ(buffer->acquireChannel(0, 0, 3)[0], 5.0f);
+
+  buffer->prefetch(0, 3);
+  copy.reset();
+  buffer.reset();
+  std::filesystem::remove(path);
+}
+
+TEST(TestAudioBuffer, MappedInterleaved) {
+  std::vector<std::int16_t> samples;
+  constexpr std::uint32_t kFrames =
+      detail::MappedAudioData::kBlockFrames * 2 + 5;
+
+  for (std::uint32_t i = 0; i < kFrames; ++i) {
+    samples.push_back(static_cast<std::int16_t>(i % 1000));
+    samples.push_back(static_cast<std::int16_t>(-16384));
+  }
+
+  auto path = writeTemporaryFile("web_audio_mapped_int16.raw", samples);
+  MappedAudioBufferOptions options;
+  options.numberOfChannels = 2;
+  options.sampleRate = 44100.0f;
+  options.format = MappedSampleFormat::eInt16Interleaved;
+  auto buffer = AudioBuffer::createMapped(path, options);
+  ASSERT_EQ(buffer->getLength(), kFrames);
+
+  // Rendering never converts in place; it counts an underrun instead.
+  auto startFrame = detail::MappedAudioData::kBlockFrames + 10;
+  buffer->mapped_->conversionScheduled_.store(true);
+  EXPECT_TRUE(buffer->acquireChannel(0, startFrame, 100).empty());
+  EXPECT_EQ(buffer->getUnderrunCount(), 1u);
+  buffer->mapped_->conversionScheduled_.store(false);
+
+  // Only the block holding the prefetched frames is converted right away.
+  buffer->prefetch(startFrame, 100);
+  EXPECT_EQ(buffer->mapped_->blockStates_[0].load(),
+            detail::MappedAudioData::kEmpty);
+  EXPECT_EQ(buffer->mapped_->blockStates_[1].load(),
+            detail::MappedAudioData::kReady);
+  auto left = buffer->acquireChannel(0, startFrame, 100);
+  ASSERT_FALSE(left.empty());
+
+  for (auto i = startFrame; i < startFrame + 100; ++i) {
+    EXPECT_FLOAT_EQ(left[i], (i % 1000) / 32768.0f);
+  }
+
+  auto &&right = buffer->getChannelData(1);
+  ASSERT_EQ(right.size(), kFrames);
+  EXPECT_FLOAT_EQ(right[0], -0.5f);
+  EXPECT_FLOAT_EQ(right[kFrames - 1], -0.5f);
+
+  buffer.reset();
+  std::filesystem::remove(path);
+}
+
+TEST(TestAudioBuffer, MappedInvalid) {
+  MappedAudioBufferOptions options;
+  options.sampleRate = 44100.0f;
+
+  try {
+    AudioBuffer::createMapped("/nonexistent/web_audio.raw", options);
+    FAIL() << "Expected DOMException";
+  } catch (const DOMException &e) {
+    EXPECT_STREQ(e.getName(), "NotReadableError");
+  }
+
+  auto path = writeTemporaryFile<float>("web_audio_mapped_short.raw", {1, 2});
+  options.length = 3;
+  EXPECT_THROW(AudioBuffer::createMapped(path, options), DOMException);
+  std::filesystem::remove(path);
 }
\ No newline at end of file
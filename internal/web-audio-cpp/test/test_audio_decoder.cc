@@ -0,0 +1,278 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstring>
+#include <numbers>
+
+#include "test_helper.hh"
+#include "web_audio/detail/audio_decoder.hh"
+#include "web_audio/detail/rational_resampler.hh"
+#include "web_audio/detail/sample_conversion.hh"
+#include "web_audio/detail/wav_decoder.hh"
+
+using namespace web_audio;
+
+namespace {
+void appendUint16(std::vector<std::uint8_t> &out, std::uint32_t value) {
+  out.push_back(static_cast<std::uint8_t>(value));
+  out.push_back(static_cast<std::uint8_t>(value >> 8));
+}
+
+void appendUint32(std::vector<std::uint8_t> &out, std::uint32_t value) {
+  appendUint16(out, value & 0xFFFF);
+  appendUint16(out, value >> 16);
+}
+
+void appendTag(std::vector<std::uint8_t> &out, const char *tag) {
+  // Byte by byte; GCC 12 reports a bogus overflow for insert() here.
+  for (auto i = 0; i < 4; ++i) {
+    out.push_back(static_cast<std::uint8_t>(tag[i]));
+  }
+}
+
+/**
+ * Builds a WAVE file around already encoded little-endian samples.
+ */
+std::vector<std::uint8_t> makeWav(std::uint16_t formatTag,
+                                  std::uint16_t channels,
+                                  std::uint32_t sampleRate,
+                                  std::uint16_t bytesPerSample,
+                                  const std::vector<std::uint8_t> &samples,
+                                  bool extensible = false) {
+  std::vector<std::uint8_t> out;
+  appendTag(out, "RIFF");
+  appendUint32(out, 0);
+  appendTag(out, "WAVE");
+
+  // An unknown chunk with odd size, which must be skipped with its padding.
+  appendTag(out, "junk");
+  appendUint32(out, 3);
+  out.insert(out.end(), {1, 2, 3, 0});
+
+  appendTag(out, "fmt ");
+  appendUint32(out, extensible ? 40 : 16);
+  appendUint16(out, extensible ? 0xFFFE : formatTag);
+  appendUint16(out, channels);
+  appendUint32(out, sampleRate);
+  appendUint32(out, sampleRate * channels * bytesPerSample);
+  appendUint16(out, channels * bytesPerSample);
+  appendUint16(out, bytesPerSample * 8);
+
+  if (extensible) {
+    appendUint16(out, 22);
+    appendUint16(out, bytesPerSample * 8);
+    appendUint32(out, 0);
+    appendUint16(out, formatTag);
+    out.insert(out.end(), 14, 0);
+  }
+
+  appendTag(out, "data");
+  appendUint32(out, static_cast<std::uint32_t>(samples.size()));
+  out.insert(out.end(), samples.begin(), samples.end());
+  return out;
+}
+
+template <typename T> std::vector<std::uint8_t> toBytes(std::vector<T> values) {
+  std::vector<std::uint8_t> bytes(values.size() * sizeof(T));
+  std::memcpy(bytes.data(), values.data(), bytes.size());
+  return bytes;
+}
+} // namespace
+
+TEST(TestAudioDecoder, SampleConversion) {
+  std::vector<std::int16_t> int16;
+  std::vector<std::int32_t> int32;
+  std::vector<double> float64;
+
+  for (int i = 0; i < 19; ++i) {
+    int16.push_back(static_cast<std::int16_t>(i * 3000 - 32768));
+    int32.push_back(static_cast<std::int32_t>(i * 200000000LL - 2000000000));
+    float64.push_back(i * 0.1 - 0.9);
+  }
+
+  std::vector<float> output(19);
+  auto int16Bytes = toBytes(int16);
+  detail::SampleConversion::fromInt16(int16Bytes.data(), output.data(), 19);
+
+  for (int i = 0; i < 19; ++i) {
+    EXPECT_EQ(output[i], int16[i] / 32768.0f);
+  }
+
+  auto int32Bytes = toBytes(int32);
+  detail::SampleConversion::fromInt32(int32Bytes.data(), output.data(), 19);
+
+  for (int i = 0; i < 19; ++i) {
+    EXPECT_FLOAT_EQ(output[i], int32[i] / 2147483648.0f);
+  }
+
+  auto float64Bytes = toBytes(float64);
+  detail::SampleConversion::fromFloat64(float64Bytes.data(), output.data(),
+                                        19);
+
+  for (int i = 0; i < 19; ++i) {
+    EXPECT_EQ(output[i], static_cast<float>(float64[i]));
+  }
+
+  std::vector<std::uint8_t> int24{0x00, 0x00, 0x80, 0xFF, 0xFF, 0x7F,
+                                  0xFF, 0xFF, 0xFF};
+  detail::SampleConversion::fromInt24(int24.data(), output.data(), 3);
+  EXPECT_EQ(output[0], -1.0f);
+  EXPECT_FLOAT_EQ(output[1], 8388607.0f / 8388608.0f);
+  EXPECT_EQ(output[2], -1.0f / 8388608.0f);
+
+  std::vector<float> interleaved(22);
+
+  for (std::size_t i = 0; i < interleaved.size(); ++i) {
+    interleaved[i] = static_cast<float>(i);
+  }
+
+  std::vector<float> left(11);
+  std::vector<float> right(11);
+  float *destinations[] = {left.data(), right.data()};
+  detail::SampleConversion::deinterleave(interleaved.data(), 2, 11,
+                                         destinations);
+
+  for (int i = 0; i < 11; ++i) {
+    EXPECT_EQ(left[i], 2.0f * i);
+    EXPECT_EQ(right[i], 2.0f * i + 1);
+  }
+}
+
+TEST(TestAudioDecoder, ParsesFormats) {
+  detail::WorkerPool pool(2);
+
+  // 8-bit unsigned, mono.
+  auto wav = makeWav(1, 1, 44100, 1, {0, 128, 192, 255});
+  auto buffer = detail::AudioDecoder::decode(wav, 44100.0f, pool);
+  ASSERT_EQ(buffer->getLength(), 4u);
+  EXPECT_EQ(buffer->getChannelData(0),
+            (std::vector<float>{-1.0f, 0.0f, 0.5f, 127.0f / 128.0f}));
+
+  // 24-bit in WAVE_FORMAT_EXTENSIBLE, three channels.
+  wav = makeWav(1, 3, 44100, 3,
+                {0x00, 0x00, 0x40, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00}, true);
+  buffer = detail::AudioDecoder::decode(wav, 44100.0f, pool);
+  ASSERT_EQ(buffer->getNumberOfChannels(), 3u);
+  EXPECT_EQ(buffer->getChannelData(0)[0], 0.5f);
+  EXPECT_EQ(buffer->getChannelData(1)[0], -0.5f);
+  EXPECT_EQ(buffer->getChannelData(2)[0], 0.0f);
+
+  // 32-bit float, stereo.
+  wav = makeWav(3, 2, 44100, 4, toBytes(std::vector<float>{0.25f, -0.75f}));
+  buffer = detail::AudioDecoder::decode(wav, 44100.0f, pool);
+  EXPECT_EQ(buffer->getChannelData(0)[0], 0.25f);
+  EXPECT_EQ(buffer->getChannelData(1)[0], -0.75f);
+
+  EXPECT_THROW(detail::AudioDecoder::decode(
+                   std::vector<std::uint8_t>{'R', 'I', 'F', 'F'}, 44100.0f,
+                   pool),
+               std::invalid_argument);
+  EXPECT_THROW(detail::AudioDecoder::decode(makeWav(1, 1, 44100, 5, {}),
+                                            44100.0f, pool),
+               std::invalid_argument);
+}
+
+TEST(TestAudioDecoder, ChunksMatchSingleThreaded) {
+  constexpr std::uint32_t kFrames = detail::AudioDecoder::kChunkFrames * 2 + 7;
+  std::vector<std::int16_t> samples(kFrames * 2);
+
+  for (std::size_t i = 0; i < samples.size(); ++i) {
+    samples[i] = static_cast<std::int16_t>((i * 7919) % 65536 - 32768);
+  }
+
+  auto wav = makeWav(1, 2, 44100, 2, toBytes(samples));
+  detail::WorkerPool pool(3);
+  auto buffer = detail::AudioDecoder::decode(wav, 44100.0f, pool);
+  ASSERT_EQ(buffer->getLength(), kFrames);
+
+  for (std::uint32_t i = 0; i < kFrames; ++i) {
+    ASSERT_EQ(buffer->getChannelData(0)[i], samples[i * 2] / 32768.0f);
+    ASSERT_EQ(buffer->getChannelData(1)[i], samples[i * 2 + 1] / 32768.0f);
+  }
+}
+
+TEST(TestAudioDecoder, Resamples) {
+  detail::RationalResampler resampler(48000, 44100);
+  EXPECT_EQ(resampler.getUpFactor(), 147u);
+  EXPECT_EQ(resampler.getDownFactor(), 160u);
+  EXPECT_EQ(resampler.getOutputLength(48000), 44100u);
+
+  // A 1 kHz sine must come out as a 1 kHz sine at the new rate, away from
+  // the edges where the filter sees the implied silence.
+  constexpr std::uint32_t kFrames = 150000;
+  std::vector<float> sine(kFrames);
+
+  for (std::uint32_t i = 0; i < kFrames; ++i) {
+    sine[i] = static_cast<float>(
+        std::sin(2 * std::numbers::pi * 1000.0 * i / 48000.0));
+  }
+
+  auto wav = makeWav(3, 1, 48000, 4, toBytes(sine));
+  detail::WorkerPool pool(3);
+  auto buffer = detail::AudioDecoder::decode(wav, 44100.0f, pool);
+  ASSERT_EQ(buffer->getLength(), resampler.getOutputLength(kFrames));
+
+  const auto &output = buffer->getChannelData(0);
+  float maxError = 0;
+
+  for (std::uint32_t i = 100; i + 100 < output.size(); ++i) {
+    auto expected = std::sin(2 * std::numbers::pi * 1000.0 * i / 44100.0);
+    maxError = std::max(maxError, static_cast<float>(std::abs(
+                                      output[i] - expected)));
+  }
+
+  EXPECT_LT(maxError, 1e-3f);
+
+  // Content above the target Nyquist frequency is removed.
+  for (std::uint32_t i = 0; i < kFrames; ++i) {
+    sine[i] = static_cast<float>(
+        std::sin(2 * std::numbers::pi * 23000.0 * i / 48000.0));
+  }
+
+  wav = makeWav(3, 1, 48000, 4, toBytes(sine));
+  buffer = detail::AudioDecoder::decode(wav, 44100.0f, pool);
+  float peak = 0;
+
+  for (std::uint32_t i = 100; i + 100 < buffer->getLength(); ++i) {
+    peak = std::max(peak, std::abs(buffer->getChannelData(0)[i]));
+  }
+
+  EXPECT_LT(peak, 1e-3f);
+}
+
+TEST(TestAudioDecoder, DecodeAudioData) {
+  auto context = TestHelper::createOfflineContext();
+  auto wav = makeWav(1, 1, 22050, 2, toBytes(std::vector<std::int16_t>(
+                                         1000, static_cast<std::int16_t>(
+                                                   16384))));
+
+  std::shared_ptr<AudioBuffer> callbackBuffer;
+  std::shared_ptr<AudioBuffer> promiseBuffer;
+  auto promise = context->decodeAudioData(
+      std::move(wav),
+      [&](std::shared_ptr<AudioBuffer> buffer) { callbackBuffer = buffer; });
+  promise.then(
+      [&](std::shared_ptr<AudioBuffer> buffer) { promiseBuffer = buffer; });
+
+  while (!promiseBuffer) {
+    context->processEvents();
+  }
+
+  EXPECT_EQ(callbackBuffer, promiseBuffer);
+  EXPECT_EQ(promiseBuffer->getSampleRate(), 44100.0f);
+  EXPECT_EQ(promiseBuffer->getLength(), 2000u);
+  EXPECT_NEAR(promiseBuffer->getChannelData(0)[1000], 0.5f, 1e-4f);
+
+  std::string errorName;
+  bool rejected = false;
+  auto failed = context->decodeAudioData(
+      {1, 2, 3}, nullptr,
+      [&](const DOMException &error) { errorName = error.getName(); });
+  failed.catch_([&](std::exception_ptr) { rejected = true; });
+
+  while (!rejected) {
+    context->processEvents();
+  }
+
+  EXPECT_EQ(errorName, "EncodingError");
+}
\ No newline at end of file
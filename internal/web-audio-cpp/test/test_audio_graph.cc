@@ -153,4 +153,88 @@ TEST(NodeGraph, GetStronglyConnectedComponents) {
   EXPECT_NE(index0, sccs.end());
   EXPECT_NE(index1, sccs.end());
   EXPECT_LT(index0, index1);
+}
+
+TEST(NodeGraph, AddAndRemoveNode) {
+  auto context = createOfflineContext();
+  auto node1 = DummyNode::create(context);
+  auto node2 = DummyNode::create(context);
+  auto node3 = DummyNode::create(context);
+
+  auto graph = context->getAudioGraph();
+  graph->addNode(node1);
+  graph->addNode(node1);
+  EXPECT_EQ(std::count(graph->nodes_.begin(), graph->nodes_.end(), node1), 1);
+
+  graph->removeNode(node1);
+  EXPECT_FALSE(graph->hasNode(node1));
+  EXPECT_TRUE(graph->hasNode(node2));
+  EXPECT_TRUE(graph->hasNode(node3));
+  EXPECT_TRUE(graph->hasNode(graph->getDestinationNode()));
+
+  graph->removeNode(node1);
+  graph->addNode(node1);
+  EXPECT_TRUE(graph->hasNode(node1));
+  // The three nodes, the destination and the listener.
+  EXPECT_EQ(graph->nodes_.size(), 5);
+}
+
+TEST(NodeGraph, VersionFollowsChanges) {
+  auto context = createOfflineContext();
+  auto node1 = DummyNode::create(context);
+  auto node2 = DummyNode::create(context);
+  auto graph = context->getAudioGraph();
+
+  auto version = graph->getVersion();
+  node1->connect(node2);
+  EXPECT_GT(graph->getVersion(), version);
+
+  version = graph->getVersion();
+  graph->addNode(node1);
+  EXPECT_EQ(graph->getVersion(), version);
+
+  node1->disconnect(node2);
+  EXPECT_GT(graph->getVersion(), version);
+
+  version = graph->getVersion();
+  graph->removeNode(node2);
+  EXPECT_GT(graph->getVersion(), version);
+}
+
+TEST(NodeGraph, RenderOrderResolvesConnections) {
+  auto context = createOfflineContext();
+  auto node1 = DummyNode::create(context);
+  auto node2 = DummyNode::create(context);
+  auto gain = web_audio::GainNode::create(context);
+  auto graph = context->getAudioGraph();
+  node1->connect(node2, 1, 0);
+  node1->connect(gain->getGain(), 1);
+
+  auto order = graph->createRenderOrder();
+  EXPECT_EQ(order->version, graph->getVersion());
+  EXPECT_EQ(order->nodes[order->destination].node,
+            graph->getDestinationNode());
+
+  auto position = [&](std::shared_ptr<web_audio::AudioNode> node) {
+    return std::find_if(order->nodes.begin(), order->nodes.end(),
+                        [&](const auto &entry) { return entry.node == node; }) -
+           order->nodes.begin();
+  };
+
+  auto &source = order->nodes[position(node1)];
+  auto &destination = order->nodes[position(node2)];
+  EXPECT_LT(position(node1), position(node2));
+  EXPECT_EQ(source.reads, (std::vector<std::uint32_t>{0, 2}));
+  ASSERT_EQ(destination.connections.size(), 1);
+  EXPECT_EQ(destination.connections[0].source, position(node1));
+  EXPECT_EQ(destination.connections[0].sourceIndex, 1);
+  auto &param = order->nodes[position(gain)].params[0];
+  ASSERT_EQ(param.connections.size(), 1);
+  EXPECT_EQ(param.connections[0].source, position(node1));
+
+  // The order keeps the nodes alive after they leave the graph.
+  std::weak_ptr<web_audio::AudioNode> removed = node2;
+  graph->removeNode(node2);
+  node2.reset();
+  EXPECT_FALSE(removed.expired());
 }
\ No newline at end of file
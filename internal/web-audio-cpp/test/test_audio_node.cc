@@ -2,6 +2,7 @@
 
 #include "dummy_node.hh"
 #include "web_audio/audio_node.hh"
+#include "web_audio/gain_node.hh"
 #include "web_audio/offline_audio_context.hh"
 
 namespace {
@@ -137,4 +138,20 @@ TEST(TestAudioNode, DisconnectParamOutput) {
   EXPECT_NO_THROW(node1->connect(param, 0));
   EXPECT_NO_THROW(node1->disconnect(param, 0));
   EXPECT_THROW(node1->disconnect(param, 0), web_audio::DOMException);
+}
+
+TEST(TestAudioNode, RenderParams) {
+  auto context = createOfflineContext();
+  auto node = web_audio::GainNode::create(context);
+  const auto &params = node->getRenderParams();
+  EXPECT_EQ(params, node->getParams());
+  EXPECT_EQ(&node->getRenderParams(), &params);
+}
+
+TEST(TestAudioNode, ParamSampleRate) {
+  auto context = web_audio::OfflineAudioContext::create(2, 128, 48000.0f);
+  auto node = DummyNode::create(context);
+  EXPECT_EQ(node->param_->sampleRate_, 48000.0f);
+  // Created with the context itself.
+  EXPECT_EQ(context->getListener()->positionX->sampleRate_, 48000.0f);
 }
\ No newline at end of file
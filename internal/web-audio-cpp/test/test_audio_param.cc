@@ -241,4 +241,22 @@ TEST(TestAudioParam, CurrentValue) {
   auto context = createOfflineContext();
   auto param = createAudioParam1(context);
   EXPECT_EQ(param->getValue(), 1.0f);
+}
+
+TEST(TestAudioParam, ComputeConstantIntrinsicValue) {
+  auto context = createOfflineContext();
+  auto param = createAudioParam(context);
+  auto quantum = 128.0 / context->getSampleRate();
+
+  EXPECT_EQ(param->computeConstantIntrinsicValue(0.0, 128), 0.0f);
+
+  param->setValueAtTime(1.0f, 0.0);
+  param->setValueAtTime(2.0f, quantum);
+  param->linearRampToValueAtTime(3.0f, 4 * quantum);
+  EXPECT_EQ(param->computeConstantIntrinsicValue(0.0, 128), 1.0f);
+  // The event at the start of the next quantum is not reached.
+  EXPECT_EQ(param->computeConstantIntrinsicValue(0.0, 129), std::nullopt);
+  // Ramping.
+  EXPECT_EQ(param->computeConstantIntrinsicValue(quantum, 128), std::nullopt);
+  EXPECT_EQ(param->computeConstantIntrinsicValue(4 * quantum, 128), 3.0f);
 }
\ No newline at end of file
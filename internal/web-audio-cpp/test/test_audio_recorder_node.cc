@@ -0,0 +1,202 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <vector>
+
+#include "test_helper.hh"
+#include "web_audio/detail/wav_decoder.hh"
+#include "web_audio/detail/wav_writer.hh"
+
+using namespace web_audio;
+
+namespace {
+std::string getTestPath(const char *name) {
+  return (std::filesystem::temp_directory_path() / name).string();
+}
+
+/**
+ * Decodes the WAVE file at `path` to one vector per channel.
+ */
+std::vector<std::vector<float>> readTestFile(const std::string &path) {
+  std::ifstream file(path, std::ios::binary);
+  std::vector<std::uint8_t> data((std::istreambuf_iterator<char>(file)),
+                                 std::istreambuf_iterator<char>());
+  auto format = detail::WavDecoder::parse(data);
+
+  std::vector<std::vector<float>> channels(
+      format.numberOfChannels, std::vector<float>(format.length));
+  std::vector<float *> destinations;
+
+  for (auto &channel : channels) {
+    destinations.push_back(channel.data());
+  }
+
+  std::vector<float> scratch(channels.size() * format.length);
+  detail::WavDecoder::decode(format, data, 0, format.length,
+                             destinations.data(), scratch.data());
+  return channels;
+}
+
+void waitFor(Promise<void> &promise,
+             std::shared_ptr<OfflineAudioContext> context) {
+  bool called = false;
+  promise.then([&] { called = true; });
+  promise.catch_([&](std::exception_ptr) { called = true; });
+
+  while (!called) {
+    context->processEvents();
+  }
+}
+} // namespace
+
+TEST(TestAudioRecorderNode, Callback) {
+  auto context = OfflineAudioContext::create(2, 128 * 40, 44100.0f);
+  auto source = ConstantSourceNode::create(context);
+  source->getOffset()->setValue(0.5f);
+
+  std::vector<float> left, right;
+  AudioRecorderOptions options;
+  options.recording.callback =
+      [&](std::span<const std::span<const float>> channels) {
+        left.insert(left.end(), channels[0].begin(), channels[0].end());
+        right.insert(right.end(), channels[1].begin(), channels[1].end());
+      };
+  auto recorder = AudioRecorderNode::create(context, options);
+
+  source->connect(recorder);
+  recorder->connect(context->getDestination());
+
+  auto rendered = TestHelper::renderOffline(context);
+  recorder->stop();
+
+  EXPECT_FALSE(recorder->isRecording());
+  EXPECT_EQ(recorder->getOverflowCount(), 0);
+  ASSERT_EQ(left.size(), 128 * 40);
+  ASSERT_EQ(right.size(), 128 * 40);
+  EXPECT_EQ(left.back(), 0.5f);
+  EXPECT_EQ(right.front(), 0.5f);
+  // The input is passed through.
+  EXPECT_EQ(rendered->getChannelData(0)[0], 0.5f);
+
+  EXPECT_THROW(recorder->setChannelCount(1), DOMException);
+}
+
+TEST(TestAudioRecorderNode, Overflow) {
+  auto context = OfflineAudioContext::create(1, 128 * 64, 44100.0f);
+  auto source = ConstantSourceNode::create(context);
+
+  // The I/O thread stalls on the first block, so that only the two blocks
+  // of the smallest ring are filled.
+  std::atomic<bool> released{false};
+  std::size_t recorded = 0;
+  AudioRecorderOptions options;
+  options.channelCount = 1;
+  options.recording.bufferDuration = 0;
+  options.recording.callback =
+      [&](std::span<const std::span<const float>> channels) {
+        released.wait(false);
+        recorded += channels[0].size();
+      };
+  auto recorder = AudioRecorderNode::create(context, options);
+  source->connect(recorder);
+
+  TestHelper::renderOffline(context);
+  released.store(true);
+  released.notify_all();
+  recorder->stop();
+
+  auto blockFrames = detail::RecordingStream::kBlockFrames;
+  EXPECT_EQ(recorded, 2 * blockFrames);
+  EXPECT_EQ(recorder->getDroppedFrames(), 128 * 64 - 2 * blockFrames);
+  EXPECT_EQ(recorder->getOverflowCount(),
+            (128 * 64 - 2 * blockFrames) / 128);
+}
+
+TEST(TestAudioRecorderNode, WavFile) {
+  auto path = getTestPath("web_audio_recorder.wav");
+
+  {
+    auto context = OfflineAudioContext::create(1, 1000, 44100.0f);
+    auto source = ConstantSourceNode::create(context);
+    source->getOffset()->setValue(0.25f);
+    AudioRecorderOptions options;
+    options.channelCount = 1;
+    options.recording.path = path;
+    options.recording.sampleFormat = RecordingSampleFormat::eInt24;
+    auto recorder = AudioRecorderNode::create(context, options);
+    source->connect(recorder);
+
+    TestHelper::renderOffline(context);
+    recorder->stop();
+  }
+
+  auto channels = readTestFile(path);
+  ASSERT_EQ(channels.size(), 1);
+  // Whole quanta are recorded.
+  ASSERT_EQ(channels[0].size(), 1024);
+  EXPECT_EQ(channels[0][0], 0.25f);
+  EXPECT_EQ(channels[0][1023], 0.25f);
+
+  std::filesystem::remove(path);
+}
+
+TEST(TestAudioRecorderNode, InvalidOptions) {
+  auto context = TestHelper::createOfflineContext();
+  AudioRecorderOptions options;
+  EXPECT_THROW(AudioRecorderNode::create(context, options), DOMException);
+
+  options.recording.path = "/nonexistent/web_audio.wav";
+  EXPECT_THROW(AudioRecorderNode::create(context, options), DOMException);
+
+  options.channelCountMode = ChannelCountMode::eMax;
+  EXPECT_THROW(AudioRecorderNode::create(context, options), DOMException);
+}
+
+TEST(TestAudioRecorderNode, WavWriter) {
+  auto path = getTestPath("web_audio_writer.wav");
+  std::vector<float> a = {0.5f, -1.5f, 0}, b = {0.25f, 1, 0},
+                     c = {-0.5f, 0, 1};
+  const float *sources[] = {a.data(), b.data(), c.data()};
+
+  {
+    detail::WavWriter writer(path, detail::WavSampleFormat::eInt16, 3, 48000);
+    writer.write(sources, 3);
+    writer.close();
+    EXPECT_EQ(writer.getLength(), 3);
+  }
+
+  auto channels = readTestFile(path);
+  ASSERT_EQ(channels.size(), 3);
+  EXPECT_EQ(channels[0], (std::vector<float>{0.5f, -1, 0}));
+  EXPECT_EQ(channels[1], (std::vector<float>{0.25f, 32767 / 32768.0f, 0}));
+  EXPECT_EQ(channels[2], (std::vector<float>{-0.5f, 0, 32767 / 32768.0f}));
+
+  std::filesystem::remove(path);
+}
+
+TEST(TestAudioRecorderNode, OfflineRendering) {
+  auto path = getTestPath("web_audio_offline.wav");
+  auto context = OfflineAudioContext::create(2, 5000, 44100.0f);
+  auto source = ConstantSourceNode::create(context);
+  source->getOffset()->setValue(0.25f);
+  source->connect(context->getDestination());
+
+  AudioRecordingOptions options;
+  options.path = path;
+  // Smaller than the rendering, so that rendering waits for the writer.
+  options.bufferDuration = 0;
+  auto promise = context->startRendering(options);
+  waitFor(promise, context);
+
+  auto channels = readTestFile(path);
+  ASSERT_EQ(channels.size(), 2);
+  // The length of the context, not whole quanta.
+  ASSERT_EQ(channels[1].size(), 5000);
+  EXPECT_EQ(channels[0][0], 0.25f);
+  EXPECT_EQ(channels[1][4999], 0.25f);
+
+  std::filesystem::remove(path);
+}
\ No newline at end of file
@@ -0,0 +1,241 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <stdexcept>
+
+#include "test_helper.hh"
+
+using namespace web_audio;
+
+namespace {
+/**
+ * Scales its input by the "gain" parameter and echoes messages back with
+ * their first value doubled.
+ */
+class GainProcessor : public AudioWorkletProcessor {
+public:
+  explicit GainProcessor(bool inPlace) : inPlace_(inPlace) {}
+
+  bool process(AudioWorkletInputs inputs, AudioWorkletOutputs outputs,
+               AudioWorkletParameters parameters) override {
+    while (auto message = getPort().receiveMessage()) {
+      message->values[0] *= 2;
+      getPort().postMessage(*message);
+    }
+
+    auto gain = parameters[0];
+    gainLength = gain.size();
+
+    for (std::size_t c = 0; c < inputs[0].size(); ++c) {
+      auto input = inputs[0][c];
+      auto output = outputs[0][c];
+      aliased = input.data() == output.data();
+
+      for (std::size_t i = 0; i < output.size(); ++i) {
+        output[i] = input[i] * gain[gain.size() > 1 ? i : 0];
+      }
+    }
+
+    return false;
+  }
+
+  bool canProcessInPlace() const override { return inPlace_; }
+
+  bool inPlace_;
+  std::size_t gainLength = 0;
+  bool aliased = false;
+};
+
+/**
+ * Counts its calls; optionally keeps a tail or throws.
+ */
+class CountingProcessor : public AudioWorkletProcessor {
+public:
+  CountingProcessor(int *calls, double tailTime, bool throws)
+      : calls_(calls), tailTime_(tailTime), throws_(throws) {}
+
+  bool process(AudioWorkletInputs inputs, AudioWorkletOutputs outputs,
+               AudioWorkletParameters parameters) override {
+    ++*calls_;
+
+    for (auto channel : outputs[0]) {
+      std::fill(channel.begin(), channel.end(), 1.0f);
+    }
+
+    if (throws_) {
+      throw std::runtime_error("failed");
+    }
+
+    return false;
+  }
+
+  double getTailTime() const override { return tailTime_; }
+
+  int *calls_;
+  double tailTime_;
+  bool throws_;
+};
+
+void registerGain(std::shared_ptr<BaseAudioContext> context, bool inPlace,
+                  GainProcessor **processor) {
+  context->getAudioWorklet()->registerProcessor(
+      "gain",
+      [=](const AudioWorkletNodeOptions &) {
+        auto created = std::make_unique<GainProcessor>(inPlace);
+        *processor = created.get();
+        return created;
+      },
+      {{.name = "gain", .defaultValue = 0.5f}});
+}
+} // namespace
+
+TEST(TestAudioWorkletNode, RegisterProcessor) {
+  auto context = TestHelper::createOfflineContext();
+  auto *worklet = context->getAudioWorklet();
+  auto factory = [](const AudioWorkletNodeOptions &) {
+    return std::make_unique<CountingProcessor>(nullptr, 0, false);
+  };
+
+  EXPECT_THROW(worklet->registerProcessor("", factory), DOMException);
+  EXPECT_THROW(
+      worklet->registerProcessor("a", factory, {{.name = "x"}, {.name = "x"}}),
+      DOMException);
+  EXPECT_THROW(
+      worklet->registerProcessor(
+          "a", factory, {{.name = "x", .defaultValue = 2, .maxValue = 1}}),
+      DOMException);
+
+  worklet->registerProcessor("a", factory);
+  EXPECT_THROW(worklet->registerProcessor("a", factory), DOMException);
+
+  EXPECT_THROW(AudioWorkletNode::create(context, "b"), DOMException);
+
+  AudioWorkletNodeOptions options;
+  options.numberOfInputs = 0;
+  options.numberOfOutputs = 0;
+  EXPECT_THROW(AudioWorkletNode::create(context, "a", options), DOMException);
+
+  options.numberOfOutputs = 2;
+  options.outputChannelCount = {1};
+  EXPECT_THROW(AudioWorkletNode::create(context, "a", options), DOMException);
+
+  options.outputChannelCount = {1, 0};
+  EXPECT_THROW(AudioWorkletNode::create(context, "a", options), DOMException);
+
+  options.outputChannelCount = {1, 2};
+  EXPECT_NO_THROW(AudioWorkletNode::create(context, "a", options));
+}
+
+TEST(TestAudioWorkletNode, Process) {
+  auto context = TestHelper::createOfflineContext();
+  GainProcessor *processor = nullptr;
+  registerGain(context, false, &processor);
+
+  auto source = ConstantSourceNode::create(context);
+  AudioWorkletNodeOptions options;
+  options.parameterData["gain"] = 0.25;
+  auto node = AudioWorkletNode::create(context, "gain", options);
+
+  EXPECT_EQ(node->getParameters().at("gain")->getValue(), 0.25f);
+
+  source->connect(node);
+  node->connect(context->getDestination());
+
+  auto rendered = TestHelper::renderOffline(context);
+
+  EXPECT_EQ(processor->gainLength, 1);
+  EXPECT_FALSE(processor->aliased);
+
+  for (std::uint32_t c = 0; c < 2; ++c) {
+    EXPECT_EQ(rendered->getChannelData(c)[0], 0.25f);
+    EXPECT_EQ(rendered->getChannelData(c)[127], 0.25f);
+  }
+}
+
+TEST(TestAudioWorkletNode, ProcessInPlace) {
+  auto context = TestHelper::createOfflineContext();
+  GainProcessor *processor = nullptr;
+  registerGain(context, true, &processor);
+  auto node = AudioWorkletNode::create(context, "gain");
+
+  detail::RenderQuantum quantum(1, 128);
+  auto *samples = quantum[0].data();
+  samples[0] = 0.5f;
+  detail::ParamCollection params;
+  params.setValue(node->getParameters().at("gain"), 0.5f, 128);
+
+  // Without connections, the input has no channels.
+  EXPECT_FALSE(node->processInPlace(quantum, params));
+
+  auto source = ConstantSourceNode::create(context);
+  source->connect(node);
+
+  EXPECT_TRUE(node->processInPlace(quantum, params));
+  EXPECT_TRUE(processor->aliased);
+  EXPECT_EQ(quantum[0].data(), samples);
+  EXPECT_EQ(samples[0], 0.25f);
+}
+
+TEST(TestAudioWorkletNode, MessagePort) {
+  auto context = TestHelper::createOfflineContext();
+  GainProcessor *processor = nullptr;
+  registerGain(context, false, &processor);
+  auto node = AudioWorkletNode::create(context, "gain");
+  node->connect(context->getDestination());
+
+  AudioWorkletMessage message;
+  message.type = 7;
+  message.values[0] = 1.5;
+  EXPECT_TRUE(node->getPort().postMessage(message));
+  EXPECT_FALSE(node->getPort().receiveMessage());
+
+  TestHelper::renderOffline(context);
+
+  auto reply = node->getPort().receiveMessage();
+  ASSERT_TRUE(reply);
+  EXPECT_EQ(reply->type, 7);
+  EXPECT_EQ(reply->values[0], 3);
+  EXPECT_FALSE(node->getPort().receiveMessage());
+}
+
+TEST(TestAudioWorkletNode, TailTime) {
+  auto context = OfflineAudioContext::create(1, 128 * 8, 44100.0f);
+  int calls = 0;
+  context->getAudioWorklet()->registerProcessor(
+      "tail", [&](const AudioWorkletNodeOptions &) {
+        // 441 frames: the quanta starting at 0, 128, 256 and 384 frames
+        // after the last connected input.
+        return std::make_unique<CountingProcessor>(&calls, 0.01, false);
+      });
+
+  AudioWorkletNodeOptions options;
+  options.numberOfInputs = 0;
+  auto node = AudioWorkletNode::create(context, "tail", options);
+  node->connect(context->getDestination());
+
+  auto rendered = TestHelper::renderOffline(context);
+
+  EXPECT_EQ(calls, 4);
+  EXPECT_EQ(rendered->getChannelData(0)[128 * 4 - 1], 1.0f);
+  EXPECT_EQ(rendered->getChannelData(0)[128 * 4], 0.0f);
+}
+
+TEST(TestAudioWorkletNode, ProcessorError) {
+  auto context = OfflineAudioContext::create(1, 128 * 4, 44100.0f);
+  int calls = 0;
+  context->getAudioWorklet()->registerProcessor(
+      "error", [&](const AudioWorkletNodeOptions &) {
+        return std::make_unique<CountingProcessor>(&calls, 1, true);
+      });
+
+  auto node = AudioWorkletNode::create(context, "error");
+  node->connect(context->getDestination());
+
+  auto rendered = TestHelper::renderOffline(context);
+
+  EXPECT_EQ(calls, 1);
+
+  for (std::size_t i = 0; i < rendered->getLength(); ++i) {
+    EXPECT_EQ(rendered->getChannelData(0)[i], 0.0f);
+  }
+}
\ No newline at end of file
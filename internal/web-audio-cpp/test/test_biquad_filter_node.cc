@@ -3,6 +3,8 @@
 
 #include <cmath>
 
+#include "test_helper.hh"
+
 TEST(TestBiquadFilterNode, Create) {
   auto context = web_audio::AudioContext::create();
   auto node = web_audio::BiquadFilterNode::create(context);
@@ -294,4 +296,79 @@ TEST(TestBiquadFilterNode, GetFrequencyResponse_OverSampleRate) {
   EXPECT_TRUE(std::isfinite(magResponse[1]));
   EXPECT_TRUE(std::isfinite(magResponse[2]));
   EXPECT_TRUE(std::isnan(magResponse[3]));
+}
+
+TEST(TestBiquadFilterNode, KernelMatchesDirectForm) {
+  constexpr std::size_t kChannels = 5;
+  constexpr std::size_t kFrames = 256;
+  web_audio::detail::BiquadCoefficients coefficients{0.2f, 0.4f, 0.2f, -0.6f,
+                                                     0.2f};
+
+  std::vector<std::vector<float>> input(kChannels, std::vector<float>(kFrames));
+  std::vector<std::vector<float>> output(kChannels,
+                                         std::vector<float>(kFrames));
+
+  for (std::size_t ch = 0; ch < kChannels; ++ch) {
+    for (std::size_t i = 0; i < kFrames; ++i) {
+      input[ch][i] = std::sin(0.05f * (ch + 1) * i);
+    }
+  }
+
+  std::vector<const float *> inputChannels;
+  std::vector<float *> outputChannels;
+
+  for (std::size_t ch = 0; ch < kChannels; ++ch) {
+    inputChannels.push_back(input[ch].data());
+    outputChannels.push_back(output[ch].data());
+  }
+
+  web_audio::detail::BiquadKernel kernel;
+  kernel.setNumberOfChannels(kChannels);
+  // Two calls to check that the state carries over.
+  kernel.process(coefficients, inputChannels.data(), outputChannels.data(),
+                 kFrames / 2);
+
+  for (auto &pointer : inputChannels) {
+    pointer += kFrames / 2;
+  }
+
+  for (auto &pointer : outputChannels) {
+    pointer += kFrames / 2;
+  }
+
+  kernel.process(coefficients, inputChannels.data(), outputChannels.data(),
+                 kFrames / 2);
+
+  for (std::size_t ch = 0; ch < kChannels; ++ch) {
+    float x1 = 0, x2 = 0, y1 = 0, y2 = 0;
+
+    for (std::size_t i = 0; i < kFrames; ++i) {
+      auto x = input[ch][i];
+      auto y = coefficients.b0 * x + coefficients.b1 * x1 +
+               coefficients.b2 * x2 - coefficients.a1 * y1 -
+               coefficients.a2 * y2;
+      x2 = x1;
+      x1 = x;
+      y2 = y1;
+      y1 = y;
+      EXPECT_NEAR(output[ch][i], y, 1e-5f) << "channel " << ch << ", " << i;
+    }
+  }
+}
+
+TEST(TestBiquadFilterNode, Offline_AutomatedLowpassPassesDC) {
+  auto context = web_audio::OfflineAudioContext::create(1, 1024, 44100.0f);
+  auto source = web_audio::ConstantSourceNode::create(context);
+  auto filter = web_audio::BiquadFilterNode::create(context);
+  source->connect(filter);
+  filter->connect(context->getDestination());
+  filter->getFrequency()->setValueAtTime(2000.0f, 0.0);
+  filter->getFrequency()->linearRampToValueAtTime(8000.0f, 1024 / 44100.0);
+
+  auto result = TestHelper::renderOffline(context);
+  auto &&data = result->getChannelData(0);
+
+  for (std::uint32_t i = 512; i < result->getLength(); ++i) {
+    EXPECT_NEAR(data[i], 1.0f, 0.01f) << "index " << i;
+  }
 }
\ No newline at end of file
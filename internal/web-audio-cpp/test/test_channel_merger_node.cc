@@ -0,0 +1,58 @@
+#include <gtest/gtest.h>
+
+#include "test_helper.hh"
+
+using namespace web_audio;
+
+TEST(TestChannelMergerNode, Attributes) {
+  auto context = TestHelper::createOfflineContext();
+  auto merger = ChannelMergerNode::create(context);
+
+  EXPECT_EQ(merger->getNumberOfInputs(), 6);
+  EXPECT_EQ(merger->getChannelCount(), 1);
+  EXPECT_THROW(merger->setChannelCount(2), DOMException);
+  EXPECT_THROW(merger->setChannelCountMode(ChannelCountMode::eMax),
+               DOMException);
+
+  ChannelMergerOptions options;
+  options.numberOfInputs = 0;
+  EXPECT_THROW(ChannelMergerNode::create(context, options), DOMException);
+}
+
+TEST(TestChannelMergerNode, SwapChannels) {
+  auto context = TestHelper::createOfflineContext();
+  constexpr std::uint32_t kFrames = 128;
+  auto buffer = AudioBuffer::create({
+      .numberOfChannels = 2,
+      .length = kFrames,
+      .sampleRate = 44100.0f,
+  });
+
+  for (std::uint32_t i = 0; i < kFrames; ++i) {
+    buffer->getWritableChannelData(0)[i] = 0.25f;
+    buffer->getWritableChannelData(1)[i] = 0.5f;
+  }
+
+  AudioBufferSourceOptions sourceOptions;
+  sourceOptions.buffer = buffer;
+  auto source = AudioBufferSourceNode::create(context, sourceOptions);
+  ChannelSplitterOptions splitterOptions;
+  splitterOptions.numberOfOutputs = 2;
+  auto splitter = ChannelSplitterNode::create(context, splitterOptions);
+  ChannelMergerOptions mergerOptions;
+  mergerOptions.numberOfInputs = 2;
+  auto merger = ChannelMergerNode::create(context, mergerOptions);
+
+  source->connect(splitter);
+  splitter->connect(merger, 0, 1);
+  splitter->connect(merger, 1, 0);
+  merger->connect(context->getDestination());
+  source->start();
+
+  auto rendered = TestHelper::renderOffline(context);
+
+  for (std::uint32_t i = 0; i < kFrames; ++i) {
+    EXPECT_EQ(rendered->getChannelData(0)[i], 0.5f);
+    EXPECT_EQ(rendered->getChannelData(1)[i], 0.25f);
+  }
+}
\ No newline at end of file
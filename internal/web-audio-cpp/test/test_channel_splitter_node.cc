@@ -0,0 +1,48 @@
+#include <gtest/gtest.h>
+
+#include <utility>
+
+#include "test_helper.hh"
+
+using namespace web_audio;
+
+TEST(TestChannelSplitterNode, Attributes) {
+  auto context = TestHelper::createOfflineContext();
+  auto splitter = ChannelSplitterNode::create(context);
+
+  EXPECT_EQ(splitter->getNumberOfOutputs(), 6);
+  EXPECT_EQ(splitter->getChannelCount(), 6);
+  EXPECT_EQ(splitter->getChannelCountMode(), ChannelCountMode::eExplicit);
+  EXPECT_EQ(splitter->getChannelInterpretation(),
+            ChannelInterpretation::eDiscrete);
+  EXPECT_THROW(splitter->setChannelCount(2), DOMException);
+  EXPECT_THROW(splitter->setChannelCountMode(ChannelCountMode::eMax),
+               DOMException);
+  EXPECT_THROW(
+      splitter->setChannelInterpretation(ChannelInterpretation::eSpeakers),
+      DOMException);
+
+  ChannelSplitterOptions options;
+  options.numberOfOutputs = 33;
+  EXPECT_THROW(ChannelSplitterNode::create(context, options), DOMException);
+}
+
+TEST(TestChannelSplitterNode, OutputsAliasInput) {
+  auto context = TestHelper::createOfflineContext();
+  ChannelSplitterOptions options;
+  options.numberOfOutputs = 3;
+  auto splitter = ChannelSplitterNode::create(context, options);
+
+  std::vector<detail::RenderQuantum> inputs(1, detail::RenderQuantum(3, 128));
+  inputs[0][0][0] = 1.0f;
+  inputs[0][1][0] = 2.0f;
+  std::vector<detail::RenderQuantum> outputs(3);
+  splitter->process(inputs, outputs, {});
+
+  const auto &input = inputs[0];
+
+  for (std::uint32_t i = 0; i < 3; ++i) {
+    EXPECT_EQ(outputs[i].getNumberOfChannels(), 1);
+    EXPECT_EQ(std::as_const(outputs[i])[0].data(), input[i].data());
+  }
+}
\ No newline at end of file
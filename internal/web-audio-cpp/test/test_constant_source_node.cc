@@ -45,4 +45,25 @@ TEST(TestConstantSourceNode, Offline) {
   while (!called) {
     context->processEvents();
   }
+}
+
+TEST(TestConstantSourceNode, ModulateParam) {
+  auto context = TestHelper::createOfflineContext();
+  auto source = web_audio::ConstantSourceNode::create(context);
+  source->getOffset()->setValue(0.5f);
+  auto modulator = web_audio::ConstantSourceNode::create(context);
+  modulator->getOffset()->setValue(0.25f);
+  auto gain = web_audio::GainNode::create(context);
+  gain->getGain()->setValue(0.5f);
+
+  source->connect(gain);
+  // The gain is its intrinsic value plus the modulator.
+  modulator->connect(gain->getGain());
+  gain->connect(context->getDestination());
+
+  auto rendered = TestHelper::renderOffline(context);
+
+  for (std::uint32_t i = 0; i < rendered->getLength(); ++i) {
+    EXPECT_FLOAT_EQ(rendered->getChannelData(0)[i], 0.5f * 0.75f);
+  }
 }
\ No newline at end of file
@@ -26,10 +26,12 @@ std::vector<float> naiveConvolve(const std::vector<float> &input,
   return output;
 }
 
-std::vector<float> convolve(const std::vector<float> &input,
-                            const std::vector<float> &impulseResponse,
-                            std::size_t blockSize = 8) {
-  web_audio::detail::Convolver<float> convolver(impulseResponse, blockSize);
+std::vector<float> convolve(
+    const std::vector<float> &input, const std::vector<float> &impulseResponse,
+    std::size_t blockSize = 8,
+    std::shared_ptr<web_audio::detail::WorkerPool> workerPool = nullptr) {
+  web_audio::detail::Convolver<float> convolver(impulseResponse, blockSize,
+                                                workerPool);
   std::size_t outputSize = input.size() + impulseResponse.size() - 1;
   std::vector<float> output(outputSize, 0.0f);
 
@@ -108,4 +110,50 @@ TEST(TestConvolver, Random) {
   auto expectedOutput = naiveConvolve(input, impulseResponse);
   auto output = convolve(input, impulseResponse, 32);
   compareVectors(expectedOutput, output, 1e-3f);
+}
+
+std::vector<float> decayingNoise(std::size_t size, std::uint32_t seed) {
+  std::mt19937 rng(seed);
+  std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+  std::vector<float> result(size);
+
+  for (std::size_t i = 0; i < size; ++i) {
+    result[i] = dist(rng) * std::exp(-static_cast<float>(i) / 1500.0f);
+  }
+
+  return result;
+}
+
+TEST(TestConvolver, LongImpulse) {
+  auto impulseResponse = decayingNoise(6000, 1);
+  auto input = decayingNoise(4096, 2);
+
+  auto expectedOutput = naiveConvolve(input, impulseResponse);
+  auto output = convolve(input, impulseResponse, 32);
+  compareVectors(expectedOutput, output, 2e-3f);
+}
+
+TEST(TestConvolver, LongImpulseWithWorkerPool) {
+  auto workerPool = std::make_shared<web_audio::detail::WorkerPool>(2);
+  auto impulseResponse = decayingNoise(6000, 3);
+  auto input = decayingNoise(4096, 4);
+
+  auto expectedOutput = naiveConvolve(input, impulseResponse);
+  auto output = convolve(input, impulseResponse, 32, workerPool);
+  compareVectors(expectedOutput, output, 2e-3f);
+}
+
+TEST(TestConvolver, TailPartitionsStartAtTwiceTheirSize) {
+  web_audio::detail::Convolver<float> convolver(std::vector<float>(100000),
+                                                128);
+
+  ASSERT_FALSE(convolver.tails_.empty());
+  EXPECT_EQ(convolver.head_->getPartitionSize(), 128);
+
+  std::size_t partitionSize = 512;
+
+  for (auto &tail : convolver.tails_) {
+    EXPECT_EQ(tail->convolution_.getPartitionSize(), partitionSize);
+    partitionSize *= 4;
+  }
 }
\ No newline at end of file
@@ -29,4 +29,64 @@ TEST(TestConvolverNode, Offline_Identity) {
       EXPECT_NEAR(result->getChannelData(ch)[i], 1.0f, 0.01f);
     }
   }
+}
+
+TEST(TestConvolverNode, SharesKernelForSameBuffer) {
+  auto context = TestHelper::createOfflineContext();
+  auto buffer = web_audio::AudioBuffer::create({
+      .numberOfChannels = 2,
+      .length = 1024,
+      .sampleRate = 44100.0f,
+  });
+
+  for (std::uint32_t i = 0; i < buffer->getLength(); ++i) {
+    buffer->getWritableChannelData(0)[i] =
+        std::exp(-static_cast<float>(i) / 100.0f);
+    buffer->getWritableChannelData(1)[i] =
+        std::exp(-static_cast<float>(i) / 200.0f);
+  }
+
+  web_audio::ConvolverOptions options;
+  options.buffer = buffer;
+  auto first = web_audio::ConvolverNode::create(context, options);
+  auto second = web_audio::ConvolverNode::create(context, options);
+
+  EXPECT_EQ(first->convolvers_[0]->getKernel(),
+            second->convolvers_[0]->getKernel());
+  EXPECT_EQ(first->convolvers_[1]->getKernel(),
+            second->convolvers_[1]->getKernel());
+  EXPECT_NE(first->convolvers_[0]->getKernel(),
+            first->convolvers_[1]->getKernel());
+  EXPECT_EQ(context->getImpulseResponseCache().getSize(), 2u);
+
+  options.disableNormalization = true;
+  auto unnormalized = web_audio::ConvolverNode::create(context, options);
+
+  EXPECT_NE(first->convolvers_[0]->getKernel(),
+            unnormalized->convolvers_[0]->getKernel());
+
+  first->setBuffer(nullptr);
+  second->setBuffer(nullptr);
+  unnormalized->setBuffer(nullptr);
+
+  EXPECT_EQ(context->getImpulseResponseCache().getSize(), 0u);
+}
+
+TEST(TestConvolverNode, CacheComparesSamples) {
+  web_audio::detail::ImpulseResponseCache cache;
+  std::vector<float> impulseResponse{1.0f, 0.5f};
+  std::vector<float> other{0.5f, 1.0f};
+
+  // Pretend `other` collides with `impulseResponse`.
+  auto colliding = cache.acquire(other, 128);
+  auto key = cache.entries_.begin()->first;
+  key.hash = web_audio::detail::ImpulseResponseCache::hash(impulseResponse);
+  auto entry = cache.entries_.extract(cache.entries_.begin());
+  entry.key() = key;
+  cache.entries_.insert(std::move(entry));
+
+  auto kernel = cache.acquire(impulseResponse, 128);
+  EXPECT_NE(kernel, colliding);
+  EXPECT_EQ(cache.getSize(), 2u);
+  EXPECT_EQ(cache.acquire(impulseResponse, 128), kernel);
 }
\ No newline at end of file
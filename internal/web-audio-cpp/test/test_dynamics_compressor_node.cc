@@ -0,0 +1,109 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include "test_helper.hh"
+#include "web_audio/detail/compressor_kernel.hh"
+
+using namespace web_audio;
+
+TEST(TestDynamicsCompressorNode, Attributes) {
+  auto context = TestHelper::createOfflineContext();
+  auto compressor = DynamicsCompressorNode::create(context);
+
+  EXPECT_FLOAT_EQ(compressor->getThreshold()->getValue(), -24);
+  EXPECT_FLOAT_EQ(compressor->getKnee()->getValue(), 30);
+  EXPECT_FLOAT_EQ(compressor->getRatio()->getValue(), 12);
+  EXPECT_FLOAT_EQ(compressor->getAttack()->getValue(), 0.003f);
+  EXPECT_FLOAT_EQ(compressor->getRelease()->getValue(), 0.25f);
+  EXPECT_EQ(compressor->getReduction(), 0);
+
+  EXPECT_THROW(
+      compressor->getRatio()->setAutomationRate(AutomationRate::eARate),
+      DOMException);
+  EXPECT_THROW(compressor->setChannelCount(3), DOMException);
+  EXPECT_THROW(compressor->setChannelCountMode(ChannelCountMode::eMax),
+               DOMException);
+}
+
+TEST(TestDynamicsCompressorNode, Curve) {
+  detail::CompressorParameters parameters;
+  parameters.threshold = -20;
+  parameters.knee = 10;
+  parameters.ratio = 4;
+
+  EXPECT_FLOAT_EQ(detail::CompressorKernel::computeCurve(-30, parameters), -30);
+  // Halfway into the knee, the slope is 1 - (1 - 1 / ratio) / 2.
+  EXPECT_FLOAT_EQ(detail::CompressorKernel::computeCurve(-15, parameters),
+                  -15 - 0.75f * 25 / 20);
+  // Past the knee, continuous with it and with a slope of 1 / ratio.
+  auto kneeEnd = -20 + 10 * (1 + 0.25f) / 2;
+  EXPECT_FLOAT_EQ(detail::CompressorKernel::computeCurve(-10, parameters),
+                  kneeEnd);
+  EXPECT_FLOAT_EQ(detail::CompressorKernel::computeCurve(0, parameters),
+                  kneeEnd + 2.5f);
+}
+
+TEST(TestDynamicsCompressorNode, DetectPeak) {
+  std::vector<float> left(37, 0.25f), right(37, -0.5f);
+  right[3] = -0.75f;
+  left[36] = 0.9f;
+  const float *channels[] = {left.data(), right.data()};
+
+  EXPECT_FLOAT_EQ(detail::CompressorKernel::detectPeak(channels, 2, 0, 36),
+                  0.75f);
+  EXPECT_FLOAT_EQ(detail::CompressorKernel::detectPeak(channels, 2, 4, 33),
+                  0.9f);
+  EXPECT_FLOAT_EQ(detail::CompressorKernel::detectPeak(channels, 1, 0, 36),
+                  0.25f);
+}
+
+TEST(TestDynamicsCompressorNode, Lookahead) {
+  detail::CompressorKernel kernel(44100);
+  kernel.setNumberOfChannels(1);
+  auto lookahead = kernel.getLookaheadFrames();
+  EXPECT_EQ(lookahead, 265);
+
+  // Below the threshold the signal is only delayed and made up.
+  detail::CompressorParameters parameters;
+  parameters.knee = 0;
+  auto makeup = std::pow(10.0f, -0.6f * (-24 + 24.0f / 12) / 20);
+
+  std::vector<float> input(4096), output(4096);
+  input[100] = 0.01f;
+  const float *in[] = {input.data()};
+  float *out[] = {output.data()};
+
+  for (std::size_t offset = 0; offset < input.size(); offset += 128) {
+    in[0] = input.data() + offset;
+    out[0] = output.data() + offset;
+    kernel.process(in, out, 128, parameters);
+  }
+
+  for (std::size_t i = 0; i < output.size(); ++i) {
+    if (i == 100 + lookahead) {
+      EXPECT_NEAR(output[i], 0.01f * makeup, 1e-6);
+    } else {
+      EXPECT_EQ(output[i], 0);
+    }
+  }
+}
+
+TEST(TestDynamicsCompressorNode, SteadyStateReduction) {
+  auto context = OfflineAudioContext::create(1, 44100, 44100.0f);
+  auto source = ConstantSourceNode::create(context);
+  DynamicsCompressorOptions options;
+  options.knee = 0;
+  options.attack = 0;
+  auto compressor = DynamicsCompressorNode::create(context, options);
+
+  source->connect(compressor);
+  compressor->connect(context->getDestination());
+
+  auto rendered = TestHelper::renderOffline(context);
+
+  // 0 dB is reduced to -22 dB and made up by 0.6 * 22 dB.
+  EXPECT_NEAR(compressor->getReduction(), -22, 1e-3);
+  EXPECT_NEAR(20 * std::log10(rendered->getChannelData(0)[44099]), -8.8,
+              1e-3);
+}
\ No newline at end of file
@@ -0,0 +1,83 @@
+#include <gtest/gtest.h>
+
+#include <complex>
+#include <numbers>
+#include <random>
+
+#include <web_audio.hh>
+
+TEST(TestFFT, MatchesDiscreteFourierTransform) {
+  constexpr std::size_t kSize = 64;
+  std::mt19937 rng(42);
+  std::uniform_real_distribution<double> dist(-1.0, 1.0);
+
+  std::vector<std::complex<double>> input(kSize);
+
+  for (auto &v : input) {
+    v = {dist(rng), dist(rng)};
+  }
+
+  auto data = input;
+  web_audio::detail::FFT<double> fft(kSize);
+  fft.forward(data.data());
+
+  for (std::size_t k = 0; k < kSize; ++k) {
+    std::complex<double> expected;
+
+    for (std::size_t n = 0; n < kSize; ++n) {
+      expected += input[n] * std::polar(1.0, -2.0 * std::numbers::pi *
+                                                 static_cast<double>(k * n) /
+                                                 kSize);
+    }
+
+    EXPECT_NEAR(data[k].real(), expected.real(), 1e-9);
+    EXPECT_NEAR(data[k].imag(), expected.imag(), 1e-9);
+  }
+
+  fft.inverse(data.data());
+
+  for (std::size_t n = 0; n < kSize; ++n) {
+    EXPECT_NEAR(data[n].real(), input[n].real(), 1e-12);
+    EXPECT_NEAR(data[n].imag(), input[n].imag(), 1e-12);
+  }
+}
+
+TEST(TestFFT, RealMatchesComplex) {
+  constexpr std::size_t kSize = 128;
+  std::mt19937 rng(7);
+  std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+
+  std::vector<float> input(kSize);
+  std::vector<std::complex<float>> complexInput(kSize);
+
+  for (std::size_t i = 0; i < kSize; ++i) {
+    input[i] = dist(rng);
+    complexInput[i] = input[i];
+  }
+
+  web_audio::detail::FFT<float> fft(kSize);
+  fft.forward(complexInput.data());
+
+  web_audio::detail::RealFFT<float> realFFT(kSize);
+  ASSERT_EQ(realFFT.getSpectrumSize(), kSize / 2 + 1);
+
+  std::vector<std::complex<float>> spectrum(realFFT.getSpectrumSize());
+  realFFT.forward(input.data(), spectrum.data());
+
+  for (std::size_t k = 0; k < spectrum.size(); ++k) {
+    EXPECT_NEAR(spectrum[k].real(), complexInput[k].real(), 1e-4f);
+    EXPECT_NEAR(spectrum[k].imag(), complexInput[k].imag(), 1e-4f);
+  }
+
+  std::vector<float> reconstructed(kSize);
+  realFFT.inverse(spectrum.data(), reconstructed.data());
+
+  for (std::size_t i = 0; i < kSize; ++i) {
+    EXPECT_NEAR(reconstructed[i], input[i], 1e-5f);
+  }
+}
+
+TEST(TestFFT, RejectsNonPowerOfTwo) {
+  EXPECT_THROW(web_audio::detail::FFT<float>(48), std::invalid_argument);
+  EXPECT_THROW(web_audio::detail::RealFFT<float>(1), std::invalid_argument);
+}
\ No newline at end of file
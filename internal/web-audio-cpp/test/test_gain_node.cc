@@ -0,0 +1,63 @@
+#include <gtest/gtest.h>
+
+#include <utility>
+
+#include "test_helper.hh"
+
+using namespace web_audio;
+
+TEST(TestGainNode, UnityGainPassesThrough) {
+  auto context = TestHelper::createOfflineContext();
+  auto gain = GainNode::create(context);
+
+  detail::RenderQuantum upstream(2, 128);
+  upstream[0][0] = 0.5f;
+  auto quantum = upstream;
+  detail::ParamCollection params;
+  params.setValue(gain->getGain(), 1.0f);
+
+  EXPECT_TRUE(gain->processInPlace(quantum, params));
+  // Nothing was written, so the channels are still shared.
+  EXPECT_TRUE(quantum.isShared(0));
+  EXPECT_EQ(std::as_const(quantum)[0][0], 0.5f);
+}
+
+TEST(TestGainNode, InPlace) {
+  auto context = TestHelper::createOfflineContext();
+  auto gain = GainNode::create(context);
+
+  detail::RenderQuantum quantum(1, 128);
+  auto *samples = quantum[0].data();
+  samples[0] = 0.5f;
+  detail::ParamCollection params;
+  params.setValue(gain->getGain(), 0.5f);
+
+  EXPECT_TRUE(gain->processInPlace(quantum, params));
+  EXPECT_EQ(quantum[0].data(), samples);
+  EXPECT_EQ(samples[0], 0.25f);
+}
+
+TEST(TestGainNode, Chain) {
+  auto context = TestHelper::createOfflineContext();
+  auto source = ConstantSourceNode::create(context);
+  source->getOffset()->setValue(0.5f);
+  std::shared_ptr<AudioNode> previous = source;
+
+  for (int i = 0; i < 4; ++i) {
+    auto gain = GainNode::create(context);
+    gain->getGain()->setValue(i % 2 == 0 ? 2.0f : 1.0f);
+    previous->connect(gain);
+    previous = gain;
+  }
+
+  previous->connect(context->getDestination());
+  // The source has a second reader, so the first gain must not scale its
+  // output in place.
+  source->connect(context->getDestination());
+
+  auto rendered = TestHelper::renderOffline(context);
+
+  for (std::uint32_t i = 0; i < rendered->getLength(); ++i) {
+    EXPECT_FLOAT_EQ(rendered->getChannelData(0)[i], 0.5f * 4 + 0.5f);
+  }
+}
\ No newline at end of file
@@ -1,7 +1,13 @@
 #pragma once
 
+#include <gtest/gtest.h>
+
+#include <mutex>
+#include <vector>
 #include <web_audio.hh>
 
+#include "web_audio/detail/realtime_checker.hh"
+
 namespace {
 class TestHelper {
 public:
@@ -37,5 +43,47 @@ public:
 
     return result;
   }
+
+  /**
+   * Renders every quantum of `context` like renderOffline(), and fails the
+   * test for each heap allocation, deallocation or lock made while
+   * rendering, by a node or by the render loop around it, after the first
+   * `warmUpQuanta`, in which nodes and the context's sample buffer pool may
+   * still size their state.
+   */
+  static std::shared_ptr<web_audio::AudioBuffer> renderOfflineRealtimeSafe(
+      std::shared_ptr<web_audio::OfflineAudioContext> context,
+      std::uint32_t warmUpQuanta = 1) {
+    using web_audio::detail::RealtimeChecker;
+    using web_audio::detail::RealtimeViolation;
+
+    std::mutex mutex;
+    std::vector<RealtimeViolation> violations;
+    std::uint64_t warmUpFrames = static_cast<std::uint64_t>(warmUpQuanta) *
+                                 context->getRenderQuantumSize();
+
+    RealtimeChecker::setHandler([&](const RealtimeViolation &violation) {
+      if (violation.frame < warmUpFrames) {
+        return;
+      }
+
+      std::lock_guard<std::mutex> lock(mutex);
+      violations.push_back(violation);
+    });
+    RealtimeChecker::setEnabled(true);
+
+    auto result = renderOffline(context);
+
+    RealtimeChecker::setEnabled(false);
+    RealtimeChecker::setHandler(nullptr);
+
+    for (const auto &violation : violations) {
+      ADD_FAILURE() << violation.kind << " while processing "
+                    << violation.node << "\n"
+                    << violation.stack;
+    }
+
+    return result;
+  }
 };
 } // namespace
\ No newline at end of file
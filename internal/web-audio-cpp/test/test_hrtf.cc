@@ -0,0 +1,247 @@
+#include <gtest/gtest.h>
+
+#include <bit>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+#include "test_helper.hh"
+#include "web_audio/detail/hrtf_convolver.hh"
+#include "web_audio/detail/hrtf_database.hh"
+#include "web_audio/detail/hrtf_filter_loader.hh"
+
+using namespace web_audio;
+
+namespace {
+void appendUint32(std::vector<std::uint8_t> &bytes, std::uint32_t value) {
+  for (int i = 0; i < 4; ++i) {
+    bytes.push_back(static_cast<std::uint8_t>(value >> (i * 8)));
+  }
+}
+
+void appendFloat32(std::vector<std::uint8_t> &bytes, float value) {
+  appendUint32(bytes, std::bit_cast<std::uint32_t>(value));
+}
+
+std::vector<std::uint8_t>
+encode(const std::vector<detail::HrtfDatabase::Measurement> &measurements,
+       float sampleRate) {
+  std::vector<std::uint8_t> bytes{'H', 'R', 'I', 'R'};
+  appendUint32(bytes, 1);
+  appendFloat32(bytes, sampleRate);
+  appendUint32(bytes, static_cast<std::uint32_t>(measurements[0].left.size()));
+  appendUint32(bytes, static_cast<std::uint32_t>(measurements.size()));
+
+  for (const auto &measurement : measurements) {
+    appendFloat32(bytes, measurement.azimuth);
+    appendFloat32(bytes, measurement.elevation);
+
+    for (auto sample : measurement.left) {
+      appendFloat32(bytes, sample);
+    }
+
+    for (auto sample : measurement.right) {
+      appendFloat32(bytes, sample);
+    }
+  }
+
+  return bytes;
+}
+
+// Impulses whose left and right gains depend on the azimuth.
+std::vector<detail::HrtfDatabase::Measurement> createMeasurements() {
+  std::vector<detail::HrtfDatabase::Measurement> measurements;
+
+  for (float azimuth : {0.0f, 90.0f, 180.0f, -90.0f}) {
+    std::vector<float> left(4, 0.0f), right(4, 0.0f);
+    left[0] = azimuth == 90 ? 0.2f : 1.0f;
+    right[0] = azimuth == -90 ? 0.2f : 1.0f;
+    measurements.push_back({azimuth, 0, left, right});
+  }
+
+  return measurements;
+}
+} // namespace
+
+TEST(TestHrtf, Parse) {
+  auto bytes = encode(createMeasurements(), 44100);
+  auto database = detail::HrtfDatabase::parse(bytes, 44100);
+
+  EXPECT_EQ(database->getMeasurementCount(), 4);
+  EXPECT_EQ(database->getLength(), 4);
+
+  bytes.resize(bytes.size() - 1);
+  EXPECT_THROW(detail::HrtfDatabase::parse(bytes, 44100),
+               std::invalid_argument);
+  EXPECT_THROW(detail::HrtfDatabase::load("/nonexistent.hrir", 44100),
+               std::runtime_error);
+}
+
+TEST(TestHrtf, Interpolate) {
+  detail::HrtfDatabase database(createMeasurements());
+  std::vector<float> left(4), right(4);
+
+  database.interpolate(90, 0, left.data(), right.data());
+  EXPECT_NEAR(left[0], 0.2f, 1e-6);
+  EXPECT_NEAR(right[0], 1.0f, 1e-6);
+
+  // The measurements at 0, 90 and -90 degrees are 30, 60 and 120 degrees
+  // away, so they weigh 4 : 2 : 1.
+  database.interpolate(30, 0, left.data(), right.data());
+  EXPECT_NEAR(left[0], (4 + 2 * 0.2 + 1) / 7, 1e-5);
+  EXPECT_NEAR(right[0], (4 + 2 + 1 * 0.2) / 7, 1e-5);
+}
+
+TEST(TestHrtf, FilterCache) {
+  detail::HrtfDatabase database(createMeasurements());
+
+  auto a = database.getFilter(30.2f, 0, 128);
+  auto b = database.getFilter(29.9f, 0.4f, 128);
+  EXPECT_EQ(a, b);
+  EXPECT_NE(a, database.getFilter(30.2f, 0, 64));
+
+  for (int i = 0; i < 200; ++i) {
+    database.getFilter(static_cast<float>(2 * i - 200), 10, 128);
+  }
+
+  EXPECT_EQ(database.getCacheSize(), detail::HrtfDatabase::kCacheCapacity);
+  EXPECT_NE(a, database.getFilter(30.2f, 0, 128));
+}
+
+TEST(TestHrtf, Convolution) {
+  constexpr std::size_t kPartitionSize = 128;
+  constexpr std::size_t kLength = 300;
+  constexpr std::size_t kBlocks = 8;
+
+  std::vector<float> left(kLength), right(kLength);
+
+  for (std::size_t i = 0; i < kLength; ++i) {
+    left[i] = std::sin(0.1f * static_cast<float>(i)) / (1 + i);
+    right[i] = std::cos(0.3f * static_cast<float>(i)) / (1 + i);
+  }
+
+  auto filter = std::make_shared<const detail::HrtfFilter>(detail::HrtfFilter{
+      detail::PartitionedImpulseResponse<float>(left, 0, kLength,
+                                                kPartitionSize),
+      detail::PartitionedImpulseResponse<float>(right, 0, kLength,
+                                                kPartitionSize)});
+
+  std::vector<float> input(kPartitionSize * kBlocks);
+
+  for (std::size_t i = 0; i < input.size(); ++i) {
+    input[i] = std::sin(0.05f * static_cast<float>(i * i % 1000));
+  }
+
+  detail::HrtfConvolver convolver(kPartitionSize,
+                                  filter->left.getPartitionCount());
+  std::vector<float> outputLeft(input.size()), outputRight(input.size());
+
+  for (std::size_t b = 0; b < kBlocks; ++b) {
+    auto offset = b * kPartitionSize;
+    convolver.process(input.data() + offset, nullptr, *filter,
+                      outputLeft.data() + offset, outputRight.data() + offset);
+  }
+
+  for (std::size_t n = 0; n < input.size(); ++n) {
+    double expectedLeft = 0, expectedRight = 0;
+
+    for (std::size_t k = 0; k < kLength && k <= n; ++k) {
+      expectedLeft += left[k] * input[n - k];
+      expectedRight += right[k] * input[n - k];
+    }
+
+    EXPECT_NEAR(outputLeft[n], expectedLeft, 1e-4);
+    EXPECT_NEAR(outputRight[n], expectedRight, 1e-4);
+  }
+}
+
+TEST(TestHrtf, Crossfade) {
+  constexpr std::size_t kPartitionSize = 64;
+  auto createFilter = [&](float gain) {
+    std::vector<float> impulse{gain};
+    return std::make_shared<const detail::HrtfFilter>(detail::HrtfFilter{
+        detail::PartitionedImpulseResponse<float>(impulse, 0, 1,
+                                                  kPartitionSize),
+        detail::PartitionedImpulseResponse<float>(impulse, 0, 1,
+                                                  kPartitionSize)});
+  };
+
+  auto unity = createFilter(1);
+  auto silent = createFilter(0);
+  detail::HrtfConvolver convolver(kPartitionSize, 1);
+  std::vector<float> input(kPartitionSize, 1.0f);
+  std::vector<float> left(kPartitionSize), right(kPartitionSize);
+
+  convolver.process(input.data(), input.data(), *unity, left.data(),
+                    right.data());
+  convolver.process(input.data(), input.data(), *silent, left.data(),
+                    right.data());
+
+  for (std::size_t i = 0; i < kPartitionSize; ++i) {
+    auto expected = 1 - static_cast<double>(i + 1) / kPartitionSize;
+    EXPECT_NEAR(left[i], expected, 1e-5);
+    EXPECT_NEAR(right[i], expected, 1e-5);
+  }
+}
+
+TEST(TestHrtf, FilterLoader) {
+  auto path = std::filesystem::temp_directory_path() / "test_hrtf_loader.hrir";
+  auto bytes = encode(createMeasurements(), 44100);
+  std::ofstream(path, std::ios::binary)
+      .write(reinterpret_cast<const char *>(bytes.data()),
+             static_cast<std::streamsize>(bytes.size()));
+
+  auto context = TestHelper::createOfflineContext();
+  detail::HrtfFilterLoader loader(context, 128);
+  // Without a dataset there is no filter to switch to.
+  loader.preload(90, 0);
+  EXPECT_EQ(loader.find(90, 0, context->getHrtfDatabaseGeneration()),
+            nullptr);
+
+  context->loadHrtfDatabase(path.string());
+  std::filesystem::remove(path);
+  auto generation = context->getHrtfDatabaseGeneration();
+  loader.preload(90, 0);
+  const auto *filter = loader.find(90, 0, generation);
+  ASSERT_NE(filter, nullptr);
+
+  // Hold back the worker, so that the new direction stays pending.
+  loader.state_->scheduled.store(true);
+  EXPECT_EQ(loader.find(-90, 0, generation), filter);
+  loader.state_->load(loader.state_->requested.load());
+  loader.state_->scheduled.store(false);
+
+  const auto *next = loader.find(-90, 0, generation);
+  ASSERT_NE(next, nullptr);
+  EXPECT_NE(next, filter);
+  EXPECT_EQ(next->left.getPartitionCount(),
+            loader.getConvolver().getPartitionCount());
+}
+
+TEST(TestHrtf, PannerNode) {
+  auto path = std::filesystem::temp_directory_path() / "test_hrtf.hrir";
+  auto bytes = encode(createMeasurements(), 44100);
+  std::ofstream(path, std::ios::binary)
+      .write(reinterpret_cast<const char *>(bytes.data()),
+             static_cast<std::streamsize>(bytes.size()));
+
+  auto context = TestHelper::createOfflineContext();
+  context->loadHrtfDatabase(path.string());
+  std::filesystem::remove(path);
+
+  auto source = ConstantSourceNode::create(context);
+  PannerOptions options;
+  options.panningModel = PanningModelType::eHRTF;
+  options.positionX = 1;
+  auto panner = PannerNode::create(context, options);
+
+  source->connect(panner);
+  panner->connect(context->getDestination());
+
+  auto rendered = TestHelper::renderOffline(context);
+
+  for (std::uint32_t i = 0; i < rendered->getLength(); ++i) {
+    EXPECT_NEAR(rendered->getChannelData(0)[i], 0.2f, 1e-5);
+    EXPECT_NEAR(rendered->getChannelData(1)[i], 1.0f, 1e-5);
+  }
+}
\ No newline at end of file
@@ -0,0 +1,210 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+
+#include <web_audio.hh>
+
+#include "test_helper.hh"
+
+namespace {
+std::vector<double> multiply(const std::vector<double> &a,
+                             const std::vector<double> &b) {
+  std::vector<double> result(a.size() + b.size() - 1, 0.0);
+
+  for (std::size_t i = 0; i < a.size(); ++i) {
+    for (std::size_t j = 0; j < b.size(); ++j) {
+      result[i + j] += a[i] * b[j];
+    }
+  }
+
+  return result;
+}
+
+std::vector<double> directForm(const std::vector<double> &b,
+                               const std::vector<double> &a,
+                               const std::vector<float> &input) {
+  std::vector<double> output(input.size());
+
+  for (std::size_t n = 0; n < input.size(); ++n) {
+    double y = 0;
+
+    for (std::size_t k = 0; k < b.size() && k <= n; ++k) {
+      y += b[k] * input[n - k];
+    }
+
+    for (std::size_t k = 1; k < a.size() && k <= n; ++k) {
+      y -= a[k] * output[n - k];
+    }
+
+    output[n] = y / a[0];
+  }
+
+  return output;
+}
+
+void expectMatchesDirectForm(web_audio::detail::IIRKernel &kernel,
+                             const std::vector<double> &b,
+                             const std::vector<double> &a) {
+  constexpr std::size_t kFrames = 512;
+  std::vector<std::vector<float>> input(3, std::vector<float>(kFrames));
+
+  for (std::size_t ch = 0; ch < input.size(); ++ch) {
+    for (std::size_t i = 0; i < kFrames; ++i) {
+      input[ch][i] = std::sin(0.03f * (ch + 1) * i) + (i == 0 ? 1.0f : 0.0f);
+    }
+  }
+
+  auto output = input;
+  std::vector<const float *> inputChannels;
+  std::vector<float *> outputChannels;
+
+  for (std::size_t ch = 0; ch < input.size(); ++ch) {
+    inputChannels.push_back(input[ch].data());
+    outputChannels.push_back(output[ch].data());
+  }
+
+  kernel.setNumberOfChannels(input.size());
+  kernel.process(inputChannels.data(), outputChannels.data(), kFrames);
+
+  for (std::size_t ch = 0; ch < input.size(); ++ch) {
+    auto expected = directForm(b, a, input[ch]);
+    auto peak = 1.0;
+
+    for (auto value : expected) {
+      peak = std::max(peak, std::abs(value));
+    }
+
+    // Single-precision sections: allow error relative to the signal level.
+    for (std::size_t i = 0; i < kFrames; ++i) {
+      EXPECT_NEAR(output[ch][i], expected[i], 2e-4 * peak)
+          << "channel " << ch << ", index " << i;
+    }
+  }
+}
+} // namespace
+
+TEST(TestIIRFilterNode, CreateValidation) {
+  auto context = TestHelper::createOfflineContext();
+
+  web_audio::IIRFilterOptions options;
+  options.feedforward = {1.0};
+  options.feedback = {0.0, 1.0};
+  EXPECT_THROW(web_audio::IIRFilterNode::create(context, options),
+               web_audio::DOMException);
+
+  options.feedback = {1.0, -0.5};
+  EXPECT_NO_THROW(web_audio::IIRFilterNode::create(context, options));
+}
+
+TEST(TestIIRFilterNode, FindRoots) {
+  // (x - 0.5)(x + 0.25)(x^2 + 1)
+  auto polynomial = multiply(multiply({1.0, -0.5}, {1.0, 0.25}), {1, 0, 1});
+  auto roots = web_audio::detail::IIRKernel::findRoots(polynomial);
+
+  ASSERT_EQ(roots.size(), 4u);
+
+  for (std::complex<double> expected : {std::complex<double>(0.5, 0),
+                                        std::complex<double>(-0.25, 0),
+                                        std::complex<double>(0, 1),
+                                        std::complex<double>(0, -1)}) {
+    auto found = std::any_of(roots.begin(), roots.end(), [&](auto root) {
+      return std::abs(root - expected) < 1e-9;
+    });
+    EXPECT_TRUE(found) << expected;
+  }
+}
+
+TEST(TestIIRFilterNode, HighOrderUsesCascade) {
+  // Three resonant sections multiplied into a sixth-order filter.
+  std::vector<double> b = {1.0};
+  std::vector<double> a = {1.0};
+
+  for (double r : {0.95, 0.9, 0.8}) {
+    b = multiply(b, {0.1, 0.2, 0.1});
+    a = multiply(a, {1.0, -2 * r * std::cos(0.2), r * r});
+  }
+
+  web_audio::detail::IIRKernel kernel(b, a);
+  EXPECT_TRUE(kernel.isCascade());
+  expectMatchesDirectForm(kernel, b, a);
+}
+
+TEST(TestIIRFilterNode, LeadingZeroUsesDirectForm) {
+  std::vector<double> b = {0.0, 0.5, 0.25, 0.125};
+  std::vector<double> a = {1.0, -0.5, 0.1, 0.05};
+
+  web_audio::detail::IIRKernel kernel(b, a);
+  EXPECT_FALSE(kernel.isCascade());
+  expectMatchesDirectForm(kernel, b, a);
+}
+
+TEST(TestIIRFilterNode, Offline_OnePole) {
+  auto context = TestHelper::createOfflineContext();
+  auto source = web_audio::ConstantSourceNode::create(context);
+  web_audio::IIRFilterOptions options;
+  options.feedforward = {0.5};
+  options.feedback = {1.0, -0.5};
+  auto filter = web_audio::IIRFilterNode::create(context, options);
+  source->connect(filter);
+  filter->connect(context->getDestination());
+
+  auto result = TestHelper::renderOffline(context);
+
+  for (std::uint32_t ch = 0; ch < result->getNumberOfChannels(); ++ch) {
+    auto &&data = result->getChannelData(ch);
+    auto expected = 0.0;
+
+    for (std::uint32_t i = 0; i < result->getLength(); ++i) {
+      expected = 0.5 + 0.5 * expected;
+      EXPECT_NEAR(data[i], expected, 1e-6) << "index " << i;
+    }
+  }
+}
+TEST(TestIIRFilterNode, ChannelCountChangeDoesNotAllocate) {
+  using web_audio::detail::RealtimeChecker;
+  using web_audio::detail::RenderQuantum;
+
+  auto context = TestHelper::createOfflineContext();
+  web_audio::detail::SampleBufferPool pool;
+  web_audio::detail::SampleBufferPool::Scope poolScope(pool);
+  web_audio::detail::ParamCollection params;
+
+  // Sections and the direct form fallback.
+  for (auto feedforward : {std::vector<double>{0.5},
+                           std::vector<double>{0.0, 0.5, 0.25, 0.125}}) {
+    web_audio::IIRFilterOptions options;
+    options.feedforward = feedforward;
+    options.feedback = {1.0, -0.5, 0.1, 0.05};
+    auto filter = web_audio::IIRFilterNode::create(context, options);
+
+    std::vector<RenderQuantum> inputs(1, RenderQuantum(1, 128));
+    std::vector<RenderQuantum> outputs(1, RenderQuantum(1, 128));
+    inputs[0].reserve(RenderQuantum::kMaxChannelCount);
+    outputs[0].reserve(RenderQuantum::kMaxChannelCount);
+    inputs[0].setConstant(0, 1.0f);
+
+    // Puts samples for the input and output channels in the pool.
+    RenderQuantum warmUp(4, 128);
+
+    for (std::uint32_t ch = 0; ch < 4; ++ch) {
+      warmUp[ch];
+    }
+
+    warmUp.reset(0);
+
+    RealtimeChecker::setEnabled(true);
+    auto before = RealtimeChecker::getViolationCount();
+
+    {
+      RealtimeChecker::NodeScope scope(*filter, 0);
+      filter->process(inputs, outputs, params);
+      inputs[0].mix(2, web_audio::ChannelInterpretation::eSpeakers);
+      outputs[0].reset(2);
+      filter->process(inputs, outputs, params);
+    }
+
+    RealtimeChecker::setEnabled(false);
+    EXPECT_EQ(RealtimeChecker::getViolationCount(), before);
+  }
+}
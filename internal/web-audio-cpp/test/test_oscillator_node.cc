@@ -5,10 +5,41 @@
 
 constexpr double kPi = std::numbers::pi;
 
+#include <complex>
+
 #include <web_audio.hh>
 
+#include "test_helper.hh"
+
 using namespace web_audio;
 
+namespace {
+std::shared_ptr<AudioBuffer> renderOscillator(OscillatorType type,
+                                              float frequency,
+                                              std::uint32_t length) {
+  auto context = OfflineAudioContext::create(1, length, 44100.0f);
+  OscillatorOptions options;
+  options.type = type;
+  options.frequency = frequency;
+  auto oscillator = OscillatorNode::create(context, options);
+  oscillator->connect(context->getDestination());
+  oscillator->start(0.0);
+  return TestHelper::renderOffline(context);
+}
+
+double magnitudeAt(const std::vector<float> &data, double frequency,
+                   double sampleRate) {
+  std::complex<double> sum;
+
+  for (std::size_t i = 0; i < data.size(); ++i) {
+    sum += static_cast<double>(data[i]) *
+           std::polar(1.0, -2 * kPi * frequency * i / sampleRate);
+  }
+
+  return std::abs(sum) / data.size();
+}
+} // namespace
+
 // TEST(TestOscillatorNode, OutputOffline) {
 //   OfflineAudioContextOptions options;
 //   options.numberOfChannels = 2;
@@ -46,4 +77,99 @@ using namespace web_audio;
 //   while (!called) {
 //     context->processEvents();
 //   }
-// }
\ No newline at end of file
+// }
+
+TEST(TestOscillatorNode, Offline_Sine) {
+  auto buffer = renderOscillator(OscillatorType::eSine, 1000, 1024);
+  auto &&data = buffer->getChannelData(0);
+
+  for (std::uint32_t i = 0; i < buffer->getLength(); ++i) {
+    auto expected = std::sin(2 * kPi * 1000 * i / 44100.0);
+    EXPECT_NEAR(data[i], expected, 1e-3) << "index " << i;
+  }
+}
+
+TEST(TestOscillatorNode, Offline_SawtoothIsBandLimited) {
+  // 0.1 s puts every multiple of 10 Hz on an exact DFT bin.
+  auto buffer = renderOscillator(OscillatorType::eSawtooth, 5000, 4410);
+  auto &&data = buffer->getChannelData(0);
+
+  auto fundamental = magnitudeAt(data, 5000, 44100);
+  EXPECT_GT(fundamental, 0.1);
+
+  // Harmonics 4 (20 kHz) and below are kept; 5 and up would fold back to
+  // 19.1 kHz, 14.1 kHz and 9.1 kHz if they were generated.
+  for (double alias : {19100.0, 14100.0, 9100.0}) {
+    EXPECT_LT(magnitudeAt(data, alias, 44100), 1e-3 * fundamental)
+        << alias << " Hz";
+  }
+}
+
+TEST(TestOscillatorNode, SetTypeSwitchesTables) {
+  auto context = TestHelper::createOfflineContext();
+  auto oscillator = OscillatorNode::create(context);
+  auto sine = oscillator->wave_;
+
+  oscillator->setType(OscillatorType::eSquare);
+  EXPECT_EQ(oscillator->getType(), OscillatorType::eSquare);
+  EXPECT_NE(oscillator->wave_, sine);
+  EXPECT_GT(oscillator->wave_->getNumberOfLevels(), 1u);
+
+  EXPECT_THROW(oscillator->setType(OscillatorType::eCustom), DOMException);
+}
+
+TEST(TestOscillatorNode, SineKernelErrorBound) {
+  std::vector<std::uint32_t> phases;
+
+  for (std::uint64_t phase = 0; phase < (1ull << 32); phase += 4099) {
+    phases.push_back(static_cast<std::uint32_t>(phase));
+  }
+
+  phases.push_back(0xffffffffu);
+  std::vector<float> output(phases.size());
+  detail::OscillatorKernel::sine(phases.data(), output.data(), phases.size());
+
+  for (std::size_t i = 0; i < phases.size(); ++i) {
+    auto expected = std::sin(2 * kPi * phases[i] / 4294967296.0);
+    ASSERT_NEAR(output[i], expected, 1e-6) << "phase " << phases[i];
+  }
+}
+
+TEST(TestOscillatorNode, KernelPhaseDoesNotDrift) {
+  // Ten minutes of 440 Hz at 48 kHz, rendered in quanta.
+  constexpr std::uint64_t kFrames = 48000ull * 600;
+  auto increment = detail::OscillatorKernel::toPhaseIncrement(440.0 / 48000);
+  detail::OscillatorKernel kernel;
+  std::vector<float> output(128);
+
+  for (std::uint64_t frame = 0; frame < kFrames; frame += 128) {
+    kernel.processSine(increment, output.data(), 128);
+  }
+
+  EXPECT_EQ(kernel.getPhase(),
+            static_cast<std::uint32_t>(increment * kFrames));
+
+  // The only error is the rounding of the increment, which offsets the
+  // frequency by at most half a step.
+  auto step = 48000 / 4294967296.0;
+  EXPECT_LE(std::abs(increment * step - 440.0), step / 2);
+}
+
+TEST(TestOscillatorNode, Offline_FrequencyAutomation) {
+  auto context = OfflineAudioContext::create(1, 1024, 44100.0f);
+  auto oscillator = OscillatorNode::create(context);
+  oscillator->getFrequency()->setValueAtTime(100, 0);
+  oscillator->getFrequency()->linearRampToValueAtTime(2000, 1024 / 44100.0);
+  oscillator->connect(context->getDestination());
+  oscillator->start(0.0);
+
+  auto buffer = TestHelper::renderOffline(context);
+  auto &&data = buffer->getChannelData(0);
+  double phase = 0;
+
+  for (std::uint32_t i = 0; i < buffer->getLength(); ++i) {
+    auto frequency = 100 + 1900.0 * i / 1024;
+    EXPECT_NEAR(data[i], std::sin(2 * kPi * phase), 2e-3) << "index " << i;
+    phase += frequency / 44100;
+  }
+}
\ No newline at end of file
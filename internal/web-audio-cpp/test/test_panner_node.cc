@@ -0,0 +1,166 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <numbers>
+
+#include "test_helper.hh"
+#include "web_audio/detail/spatial_batch.hh"
+
+using namespace web_audio;
+
+namespace {
+// Left and right gains of a mono source at (x, 0, -1) with the default
+// listener and the inverse distance model.
+std::pair<double, double> expectedGains(double x) {
+  auto azimuth = std::atan2(x, 1.0);
+  auto pan = azimuth / (std::numbers::pi / 2);
+  auto theta = (pan + 1) / 2 * std::numbers::pi / 2;
+  auto gain = 1 / std::sqrt(x * x + 1);
+  return {std::cos(theta) * gain, std::sin(theta) * gain};
+}
+} // namespace
+
+TEST(TestPannerNode, Attributes) {
+  auto context = TestHelper::createOfflineContext();
+  auto panner = PannerNode::create(context);
+
+  EXPECT_EQ(panner->getDistanceModel(), DistanceModelType::eInverse);
+  EXPECT_EQ(panner->getOrientationX()->getDefaultValue(), 1.0f);
+  EXPECT_THROW(panner->setRefDistance(-1), DOMException);
+  EXPECT_THROW(panner->setMaxDistance(0), DOMException);
+  EXPECT_THROW(panner->setRolloffFactor(-1), DOMException);
+  EXPECT_THROW(panner->setConeOuterGain(1.5), DOMException);
+  EXPECT_THROW(panner->setChannelCount(3), DOMException);
+  EXPECT_THROW(panner->setChannelCountMode(ChannelCountMode::eMax),
+               DOMException);
+  EXPECT_EQ(panner->getRefDistance(), 1);
+}
+
+TEST(TestPannerNode, SourceOnTheRight) {
+  auto context = TestHelper::createOfflineContext();
+  auto source = ConstantSourceNode::create(context);
+  PannerOptions options;
+  options.positionX = 2;
+  auto panner = PannerNode::create(context, options);
+
+  source->connect(panner);
+  panner->connect(context->getDestination());
+
+  auto rendered = TestHelper::renderOffline(context);
+
+  for (std::uint32_t i = 0; i < rendered->getLength(); ++i) {
+    EXPECT_NEAR(rendered->getChannelData(0)[i], 0.0, 1e-6);
+    EXPECT_NEAR(rendered->getChannelData(1)[i], 0.5, 1e-6);
+  }
+}
+
+TEST(TestPannerNode, AutomatedSource) {
+  auto context = TestHelper::createOfflineContext();
+  auto source = ConstantSourceNode::create(context);
+  PannerOptions options;
+  options.positionZ = -1;
+  auto panner = PannerNode::create(context, options);
+  panner->getPositionX()->setValueAtTime(-10.0f, 0.0);
+  panner->getPositionX()->linearRampToValueAtTime(10.0f, 128 / 44100.0);
+
+  source->connect(panner);
+  panner->connect(context->getDestination());
+
+  auto rendered = TestHelper::renderOffline(context);
+
+  for (std::uint32_t i = 0; i < rendered->getLength(); ++i) {
+    auto [left, right] = expectedGains(-10.0 + 20.0 * i / 128);
+    EXPECT_NEAR(rendered->getChannelData(0)[i], left, 1e-5);
+    EXPECT_NEAR(rendered->getChannelData(1)[i], right, 1e-5);
+  }
+}
+
+TEST(TestPannerNode, AutomatedListener) {
+  auto context = TestHelper::createOfflineContext();
+  auto source = ConstantSourceNode::create(context);
+  PannerOptions options;
+  options.positionZ = -1;
+  auto panner = PannerNode::create(context, options);
+  auto listener = context->getListener();
+  listener->getPositionX()->setValueAtTime(10.0f, 0.0);
+  listener->getPositionX()->linearRampToValueAtTime(-10.0f, 128 / 44100.0);
+
+  source->connect(panner);
+  panner->connect(context->getDestination());
+
+  auto rendered = TestHelper::renderOffline(context);
+
+  for (std::uint32_t i = 0; i < rendered->getLength(); ++i) {
+    auto [left, right] = expectedGains(-10.0 + 20.0 * i / 128);
+    EXPECT_NEAR(rendered->getChannelData(0)[i], left, 1e-5);
+    EXPECT_NEAR(rendered->getChannelData(1)[i], right, 1e-5);
+  }
+}
+
+TEST(TestPannerNode, DistanceModels) {
+  detail::SpatialBatch batch(4);
+  batch.setDistance(0, DistanceModelType::eLinear, 1, 10, 1);
+  batch.setDistance(1, DistanceModelType::eInverse, 1, 10, 1);
+  batch.setDistance(2, DistanceModelType::eExponential, 1, 10, 2);
+  batch.setDistance(3, DistanceModelType::eLinear, 1, 10, 1);
+
+  for (std::size_t i = 0; i < 3; ++i) {
+    batch.setPosition(i, 0, 0, -4);
+  }
+
+  // Beyond maxDistance, the linear model stays at 1 - rolloffFactor.
+  batch.setPosition(3, 0, 0, -20);
+  batch.process(detail::ListenerBasis{});
+
+  EXPECT_NEAR(batch.getGains()[0], 1 - 3.0 / 9, 1e-6);
+  EXPECT_NEAR(batch.getGains()[1], 0.25, 1e-6);
+  EXPECT_NEAR(batch.getGains()[2], 1.0 / 16, 1e-6);
+  EXPECT_NEAR(batch.getGains()[3], 0, 1e-6);
+}
+
+TEST(TestPannerNode, ConeGain) {
+  detail::SpatialBatch batch(3);
+
+  for (std::size_t i = 0; i < 3; ++i) {
+    batch.setPosition(i, 0, 0, -2);
+    batch.setDistance(i, DistanceModelType::eLinear, 1, 10, 0);
+    batch.setCone(i, 60, 240, 0.5f);
+  }
+
+  batch.setOrientation(0, 0, 0, 1);
+  batch.setOrientation(1, 1, 0, 0);
+  batch.setOrientation(2, 0, 0, -1);
+  batch.process(detail::ListenerBasis{});
+
+  EXPECT_NEAR(batch.getGains()[0], 1, 1e-6);
+  EXPECT_NEAR(batch.getGains()[1], 1.0 / 3 + 0.5 * 2 / 3, 1e-5);
+  EXPECT_NEAR(batch.getGains()[2], 0.5, 1e-6);
+}
+
+TEST(TestPannerNode, BatchAngles) {
+  constexpr std::size_t kSources = 256;
+  detail::SpatialBatch batch(kSources + 1);
+  std::vector<double> expected(kSources);
+
+  for (std::size_t i = 0; i < kSources; ++i) {
+    expected[i] = -89.0 + 178.0 * i / kSources;
+    auto theta = expected[i] * std::numbers::pi / 180;
+    batch.setPosition(i, static_cast<float>(5 * std::sin(theta)), 0,
+                      static_cast<float>(-5 * std::cos(theta)));
+  }
+
+  batch.setPosition(kSources, 0, 3, 0);
+
+  auto listener = detail::ListenerBasis::create(
+      detail::Vec3(0, 0, 0), detail::Vec3(0, 0, -1), detail::Vec3(0, 1, 0));
+  batch.process(listener);
+
+  for (std::size_t i = 0; i < kSources; ++i) {
+    EXPECT_NEAR(batch.getAzimuths()[i], expected[i], 1e-2);
+    EXPECT_NEAR(batch.getElevations()[i], 0, 1e-2);
+    EXPECT_NEAR(batch.getGains()[i], 0.2, 1e-6);
+  }
+
+  EXPECT_NEAR(batch.getAzimuths()[kSources], 0, 1e-2);
+  EXPECT_NEAR(batch.getElevations()[kSources], 90, 1e-2);
+}
\ No newline at end of file
@@ -1,6 +1,10 @@
 #include <gtest/gtest.h>
 
+#include <cmath>
+#include <numbers>
+
 #include "web_audio/offline_audio_context.hh"
+#include "web_audio/oscillator_node.hh"
 #include "web_audio/periodic_wave.hh"
 #include "web_audio/periodic_wave_options.hh"
 
@@ -65,4 +69,107 @@ TEST(TestPeriodicWave, InvalidLengthMismatch) {
   opts.real = std::vector<float>{0, 2};
   opts.imag = std::vector<float>{0, 4, 5};
   EXPECT_THROW(PeriodicWave::create(ctx, opts), DOMException);
+}
+
+TEST(TestPeriodicWave, SelectTablesIsBandLimited) {
+  auto ctx = createOfflineContext();
+  PeriodicWaveOptions opts;
+  opts.imag = std::vector<float>(1000, 1.0f);
+  auto wave = PeriodicWave::create(ctx, opts);
+
+  ASSERT_GT(wave->getNumberOfLevels(), 1u);
+  EXPECT_EQ(wave->levelPartials_[0], 999u);
+
+  auto stride = wave->getTableSize() + 1;
+  auto *first = wave->getTable(0);
+
+  for (float frequency : {20.0f, 30.0f, 100.0f, 440.0f, 1234.5f, 5000.0f,
+                          15000.0f, -440.0f}) {
+    auto selection = wave->selectTables(frequency);
+    auto level0 = static_cast<std::size_t>(selection.table0 - first) / stride;
+    auto level1 = static_cast<std::size_t>(selection.table1 - first) / stride;
+
+    EXPECT_GE(selection.weight, 0.0f);
+    EXPECT_LT(selection.weight, 1.0f);
+    EXPECT_LE(wave->levelPartials_[level0] * std::abs(frequency), 22050.0f)
+        << frequency << " Hz";
+    EXPECT_LE(wave->levelPartials_[level1] * std::abs(frequency), 22050.0f)
+        << frequency << " Hz";
+  }
+
+  // Low notes get every partial.
+  EXPECT_EQ(wave->selectTables(10.0f).table0, first);
+}
+
+TEST(TestPeriodicWave, TablesMatchFourierSeries) {
+  auto ctx = createOfflineContext();
+  PeriodicWaveOptions opts;
+  opts.real = std::vector<float>{0, 0.5f, 0, 0.25f};
+  opts.imag = std::vector<float>{0, 0, 1, 0};
+  opts.disableNormalization = true;
+  auto wave = PeriodicWave::create(ctx, opts);
+
+  for (float phase = 0; phase < 1; phase += 0.01f) {
+    auto theta = 2 * std::numbers::pi * phase;
+    auto expected = 0.5 * std::cos(theta) + std::sin(2 * theta) +
+                    0.25 * std::cos(3 * theta);
+    EXPECT_NEAR(wave->getSample(phase), expected, 1e-4) << phase;
+  }
+}
+
+TEST(TestPeriodicWave, BuiltInWavesAreShared) {
+  auto ctx = createOfflineContext();
+  auto other = OfflineAudioContext::create(1, 128, 44100.0f);
+  auto lowRate = OfflineAudioContext::create(1, 128, 22050.0f);
+
+  auto square = PeriodicWave::getBuiltIn(44100.0f, OscillatorType::eSquare);
+  EXPECT_EQ(PeriodicWave::getBuiltIn(44100.0f, OscillatorType::eSquare),
+            square);
+  EXPECT_NE(PeriodicWave::getBuiltIn(44100.0f, OscillatorType::eSawtooth),
+            square);
+  EXPECT_NE(PeriodicWave::getBuiltIn(22050.0f, OscillatorType::eSquare),
+            square);
+
+  OscillatorOptions options;
+  options.type = OscillatorType::eSquare;
+  auto first = OscillatorNode::create(ctx, options);
+  auto second = OscillatorNode::create(other, options);
+  auto third = OscillatorNode::create(lowRate, options);
+  EXPECT_EQ(first->wave_, square);
+  EXPECT_EQ(second->wave_, square);
+  EXPECT_NE(third->wave_, square);
+}
+
+TEST(TestPeriodicWave, InverseFFTMatchesDirectSum) {
+  auto ctx = createOfflineContext();
+  PeriodicWaveOptions opts;
+  opts.real = std::vector<float>(300);
+  opts.imag = std::vector<float>(300);
+
+  for (std::size_t k = 1; k < 300; ++k) {
+    opts.real->at(k) = 1.0f / k;
+    opts.imag->at(k) = (k % 3 == 0 ? -0.5f : 0.25f) / k;
+  }
+
+  opts.disableNormalization = true;
+  auto wave = PeriodicWave::create(ctx, opts);
+  auto tableSize = wave->getTableSize();
+
+  for (std::size_t level = 0; level < wave->getNumberOfLevels(); level += 5) {
+    auto *table = wave->getTable(level);
+
+    for (std::size_t t = 0; t < tableSize; t += 37) {
+      double expected = 0;
+
+      for (std::size_t k = 1; k <= wave->levelPartials_[level]; ++k) {
+        auto theta = 2 * std::numbers::pi * k * t / tableSize;
+        expected += opts.real->at(k) * std::cos(theta) +
+                    opts.imag->at(k) * std::sin(theta);
+      }
+
+      EXPECT_NEAR(table[t], expected, 1e-4) << "level " << level << ", " << t;
+    }
+
+    EXPECT_EQ(table[tableSize], table[0]);
+  }
 }
\ No newline at end of file
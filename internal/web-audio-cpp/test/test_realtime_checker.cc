@@ -0,0 +1,223 @@
+#include <gtest/gtest.h>
+
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "test_helper.hh"
+
+using namespace web_audio;
+using detail::RealtimeChecker;
+using detail::RealtimeViolation;
+
+namespace {
+/**
+ * Passes its input through with a std::vector temporary, or under a lock.
+ */
+class CarelessNode : public AudioNode {
+public:
+  static std::shared_ptr<CarelessNode>
+  create(std::shared_ptr<BaseAudioContext> context, bool lock) {
+    auto node = std::shared_ptr<CarelessNode>(new CarelessNode());
+    node->initialize(context);
+    node->numberOfInputs_ = 1;
+    node->numberOfOutputs_ = 1;
+    node->channelCount_ = 2;
+    node->channelCountMode_ = ChannelCountMode::eMax;
+    node->channelInterpretation_ = ChannelInterpretation::eSpeakers;
+    node->lock_ = lock;
+    return node;
+  }
+
+  void process(const std::vector<detail::RenderQuantum> &inputs,
+               std::vector<detail::RenderQuantum> &outputs,
+               const detail::ParamCollection &params) override {
+    if (lock_) {
+      std::lock_guard<std::mutex> lock(mutex_);
+      outputs[0] = inputs[0];
+    } else {
+      std::vector<float> scratch(inputs[0].getLength());
+      outputs[0] = inputs[0];
+    }
+  }
+
+private:
+  CarelessNode() = default;
+
+  bool lock_ = false;
+  std::mutex mutex_;
+};
+
+std::vector<RealtimeViolation>
+renderCollecting(std::shared_ptr<OfflineAudioContext> context) {
+  std::vector<RealtimeViolation> violations;
+  std::mutex mutex;
+
+  RealtimeChecker::setHandler([&](const RealtimeViolation &violation) {
+    // The render loop fills the sample buffer pool in the first quantum.
+    if (violation.node == "render loop") {
+      return;
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    violations.push_back(violation);
+  });
+  RealtimeChecker::setEnabled(true);
+  TestHelper::renderOffline(context);
+  RealtimeChecker::setEnabled(false);
+  RealtimeChecker::setHandler(nullptr);
+  return violations;
+}
+} // namespace
+
+TEST(TestRealtimeChecker, ReportsAllocation) {
+  ASSERT_TRUE(RealtimeChecker::isAvailable());
+  auto context = OfflineAudioContext::create(2, 128 * 4, 44100.0f);
+  auto source = ConstantSourceNode::create(context);
+  auto node = CarelessNode::create(context, false);
+  source->connect(node)->connect(context->getDestination());
+
+  auto violations = renderCollecting(context);
+
+  // An allocation and a deallocation per quantum.
+  ASSERT_EQ(violations.size(), 8);
+  EXPECT_EQ(violations[0].kind, "allocation");
+  EXPECT_EQ(violations[1].kind, "deallocation");
+  EXPECT_NE(violations[0].node.find("CarelessNode"), std::string::npos);
+  EXPECT_FALSE(violations[0].stack.empty());
+  EXPECT_EQ(violations[2].frame, 128);
+}
+
+#if defined(__linux__)
+TEST(TestRealtimeChecker, ReportsLock) {
+  auto context = OfflineAudioContext::create(2, 128, 44100.0f);
+  auto source = ConstantSourceNode::create(context);
+  auto node = CarelessNode::create(context, true);
+  source->connect(node)->connect(context->getDestination());
+
+  auto violations = renderCollecting(context);
+
+  ASSERT_EQ(violations.size(), 1);
+  EXPECT_EQ(violations[0].kind, "lock");
+}
+#endif
+
+TEST(TestRealtimeChecker, IgnoresOtherCode) {
+  auto context = TestHelper::createOfflineContext();
+  auto node = ConstantSourceNode::create(context);
+  detail::SampleBufferPool pool;
+  detail::SampleBufferPool::Scope poolScope(pool);
+  detail::RenderQuantum quantum(2, 128);
+  quantum[0][0] = 1.0f;
+  quantum.reset(2);
+  RealtimeChecker::setEnabled(true);
+  auto before = RealtimeChecker::getViolationCount();
+  // Neither the control thread nor samples reused from the pool count.
+  std::vector<float> allocated(128);
+
+  {
+    RealtimeChecker::NodeScope scope(*node, 0);
+    quantum[0][0] = 1.0f;
+    quantum.setConstant(1, 0.5f);
+  }
+
+  RealtimeChecker::setEnabled(false);
+  EXPECT_EQ(RealtimeChecker::getViolationCount(), before);
+}
+
+TEST(TestRealtimeChecker, ReportsRenderLoop) {
+  std::vector<RealtimeViolation> violations;
+  RealtimeChecker::setHandler([&](const RealtimeViolation &violation) {
+    violations.push_back(violation);
+  });
+  RealtimeChecker::setEnabled(true);
+
+  {
+    RealtimeChecker::RenderScope scope(256);
+    std::vector<float> allocated(128);
+  }
+
+  RealtimeChecker::setEnabled(false);
+  RealtimeChecker::setHandler(nullptr);
+
+  ASSERT_EQ(violations.size(), 2);
+  EXPECT_EQ(violations[0].kind, "allocation");
+  EXPECT_EQ(violations[0].node, "render loop");
+  EXPECT_EQ(violations[0].frame, 256);
+}
+
+TEST(TestRealtimeChecker, SourcesAndEffects) {
+  auto context = OfflineAudioContext::create(2, 128 * 8, 44100.0f);
+  auto oscillator = OscillatorNode::create(context);
+  auto constant = ConstantSourceNode::create(context);
+  auto gain = GainNode::create(context);
+  auto biquad = BiquadFilterNode::create(context);
+  auto panner = StereoPannerNode::create(context);
+  auto compressor = DynamicsCompressorNode::create(context);
+  auto shaper = WaveShaperNode::create(context);
+  shaper->setCurve(std::vector<float>{-1.0f, 0.0f, 1.0f});
+  oscillator->start();
+
+  oscillator->connect(gain);
+  constant->connect(gain->getGain());
+  gain->connect(biquad)->connect(panner)->connect(compressor);
+  compressor->connect(shaper)->connect(context->getDestination());
+
+  TestHelper::renderOfflineRealtimeSafe(context);
+}
+
+TEST(TestRealtimeChecker, RoutingAndSpatial) {
+  auto context = OfflineAudioContext::create(2, 128 * 8, 44100.0f);
+  auto buffer = AudioBuffer::create({
+      .numberOfChannels = 2,
+      .length = 256,
+      .sampleRate = 44100.0f,
+  });
+  buffer->getWritableChannelData(0)[0] = 1.0f;
+  buffer->getWritableChannelData(1)[1] = 1.0f;
+
+  auto source = AudioBufferSourceNode::create(context);
+  source->setBuffer(buffer);
+  source->setLoop(true);
+  source->start();
+
+  auto splitter = ChannelSplitterNode::create(context);
+  auto merger = ChannelMergerNode::create(context);
+  auto convolver = ConvolverNode::create(context);
+  convolver->setBuffer(buffer);
+  auto panner = PannerNode::create(context);
+
+  source->connect(splitter);
+  splitter->connect(merger, 0, 1);
+  splitter->connect(merger, 1, 0);
+  merger->connect(convolver)->connect(panner);
+  panner->connect(context->getDestination());
+
+  // The source and the listener become automated after the warm-up.
+  auto quantum = 128 / context->getSampleRate();
+  panner->getPositionX()->setValueAtTime(0.0f, 3 * quantum);
+  panner->getPositionX()->linearRampToValueAtTime(2.0f, 6 * quantum);
+  auto listener = context->getListener();
+  listener->positionZ->setValueAtTime(0.0f, 4 * quantum);
+  listener->positionZ->linearRampToValueAtTime(1.0f, 7 * quantum);
+
+  TestHelper::renderOfflineRealtimeSafe(context);
+}
+
+TEST(TestRealtimeChecker, GainChain) {
+  auto context = OfflineAudioContext::create(2, 128 * 8, 44100.0f);
+  auto oscillator = OscillatorNode::create(context);
+  oscillator->start();
+  std::shared_ptr<AudioNode> previous = oscillator;
+
+  // Unity gains pass the quantum of their input through.
+  for (int i = 0; i < 4; ++i) {
+    auto gain = GainNode::create(context);
+    previous->connect(gain);
+    previous = gain;
+  }
+
+  previous->connect(context->getDestination());
+
+  TestHelper::renderOfflineRealtimeSafe(context);
+}
\ No newline at end of file
@@ -1,6 +1,9 @@
 #include <gtest/gtest.h>
 
+#include <utility>
+
 #include "web_audio/detail/render_quantum.hh"
+#include "web_audio/detail/sample_buffer_pool.hh"
 
 using namespace web_audio;
 
@@ -155,4 +158,95 @@ TEST(TestRenderQuantum, Mix5_1ToQuad) {
   EXPECT_NEAR(rq[1][0], 0.5f + std::sqrt(0.5f) * 0.25f, 0.01f);
   EXPECT_NEAR(rq[2][0], 0.0625f, 0.01f);
   EXPECT_NEAR(rq[3][0], 0.03125f, 0.01f);
+}
+
+TEST(TestRenderQuantum, CopyOnWrite) {
+  detail::RenderQuantum rq(2, 128);
+  // Silent channels share one buffer until written.
+  EXPECT_TRUE(rq.isShared(0));
+  rq[0][0] = 1.0f;
+  EXPECT_FALSE(rq.isShared(0));
+
+  auto copy = rq;
+  const auto &constCopy = copy;
+  EXPECT_TRUE(rq.isShared(0));
+  EXPECT_EQ(constCopy[0].data(), std::as_const(rq)[0].data());
+
+  copy[0][0] = 2.0f;
+  EXPECT_FALSE(rq.isShared(0));
+  EXPECT_EQ(rq[0][0], 1.0f);
+  EXPECT_EQ(copy[0][0], 2.0f);
+}
+
+TEST(TestRenderQuantum, PooledSamples) {
+  detail::SampleBufferPool pool;
+  detail::SampleBufferPool::Scope scope(pool);
+
+  detail::RenderQuantum rq(1, 128);
+  rq[0][0] = 1.0f;
+  EXPECT_FALSE(rq.isShared(0));
+  auto *samples = std::as_const(rq)[0].data();
+
+  // Copies share pooled samples like any other until written.
+  auto copy = rq;
+  EXPECT_TRUE(rq.isShared(0));
+  copy[0][0] = 2.0f;
+  EXPECT_NE(std::as_const(copy)[0].data(), samples);
+  EXPECT_EQ(rq[0][0], 1.0f);
+
+  // Released samples are handed out again, filled in anew.
+  rq.reset(1);
+  rq.setConstant(0, 0.5f);
+  EXPECT_EQ(rq[0].data(), samples);
+  EXPECT_EQ(rq[0][127], 0.5f);
+}
+
+TEST(TestRenderQuantum, SetChannel) {
+  detail::RenderQuantum source(2, 128);
+  source[1][0] = 1.0f;
+
+  detail::RenderQuantum rq(1, 128);
+  rq.setChannel(0, source, 1);
+  EXPECT_EQ(std::as_const(rq)[0].data(), std::as_const(source)[1].data());
+
+  rq[0][0] = 0.5f;
+  EXPECT_EQ(source[1][0], 1.0f);
+  EXPECT_EQ(rq[0][0], 0.5f);
+}
+
+TEST(TestRenderQuantum, Constant) {
+  detail::RenderQuantum rq(2, 128);
+  rq.setConstant(0, 0.5f);
+  EXPECT_TRUE(rq.isConstant(0));
+  // Silence is constant too.
+  EXPECT_TRUE(rq.isConstant(1));
+
+  detail::RenderQuantum other(2, 128);
+  other.setConstant(0, 0.25f);
+  other[1][3] = 1.0f;
+  rq.add(other, ChannelInterpretation::eDiscrete);
+
+  EXPECT_TRUE(rq.isConstant(0));
+  EXPECT_EQ(rq.getConstant(0), 0.75f);
+  EXPECT_FALSE(rq.isConstant(1));
+
+  // Reading fills in the samples; writing makes the channel variable.
+  EXPECT_EQ(std::as_const(rq)[0][127], 0.75f);
+  EXPECT_TRUE(rq.isConstant(0));
+  rq[0][0] = 0.0f;
+  EXPECT_FALSE(rq.isConstant(0));
+  EXPECT_EQ(rq[0][1], 0.75f);
+}
+
+TEST(TestRenderQuantum, AddConstantToSamples) {
+  detail::RenderQuantum rq(1, 128);
+  rq[0][0] = 1.0f;
+  detail::RenderQuantum other(1, 128);
+  other.setConstant(0, 0.5f);
+
+  rq.add(other, ChannelInterpretation::eDiscrete);
+  EXPECT_EQ(rq[0][0], 1.5f);
+  EXPECT_EQ(rq[0][1], 0.5f);
+  // The constant was added as a scalar.
+  EXPECT_EQ(other.channelData_[0].samples, nullptr);
 }
\ No newline at end of file
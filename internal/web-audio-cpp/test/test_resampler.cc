@@ -0,0 +1,107 @@
+#include <gtest/gtest.h>
+
+#include <random>
+
+#include <web_audio.hh>
+
+namespace {
+std::vector<float> randomBlock(std::mt19937 &rng, std::size_t size) {
+  std::uniform_real_distribution<float> dist(-1.0f, 1.0f);
+  std::vector<float> block(size);
+
+  for (auto &v : block) {
+    v = dist(rng);
+  }
+
+  return block;
+}
+
+void compareResamplers(web_audio::detail::Resampler &expected,
+                       web_audio::detail::Resampler &actual,
+                       std::size_t blockSize) {
+  std::mt19937 rng(42);
+
+  for (int block = 0; block < 8; ++block) {
+    auto input = randomBlock(rng, blockSize);
+    std::vector<float> expectedOutput;
+    std::vector<float> actualOutput;
+    expected.process(input, expectedOutput);
+    actual.process(input, actualOutput);
+
+    ASSERT_EQ(expectedOutput.size(), actualOutput.size());
+
+    for (std::size_t i = 0; i < expectedOutput.size(); ++i) {
+      EXPECT_NEAR(expectedOutput[i], actualOutput[i], 1e-4f)
+          << "block " << block << ", index " << i;
+    }
+  }
+}
+} // namespace
+
+TEST(TestResampler, PolyphaseUpsamplerMatchesFFT) {
+  using web_audio::detail::Resampler;
+  using web_audio::detail::ResamplerType;
+
+  for (std::size_t factor : {2, 4}) {
+    auto fft = Resampler::createUpsampler(ResamplerType::eFFT, factor, 128);
+    auto polyphase =
+        Resampler::createUpsampler(ResamplerType::ePolyphase, factor, 128);
+    compareResamplers(*fft, *polyphase, 128);
+  }
+}
+
+TEST(TestResampler, PolyphaseDownsamplerMatchesFFT) {
+  using web_audio::detail::Resampler;
+  using web_audio::detail::ResamplerType;
+
+  for (std::size_t factor : {2, 4}) {
+    auto fft =
+        Resampler::createDownsampler(ResamplerType::eFFT, factor, 128 * factor);
+    auto polyphase = Resampler::createDownsampler(ResamplerType::ePolyphase,
+                                                  factor, 128 * factor);
+    compareResamplers(*fft, *polyphase, 128 * factor);
+  }
+}
+
+TEST(TestResampler, PolyphaseDownsamplerMatchesDirectConvolution) {
+  const auto &coefficients =
+      web_audio::detail::Downsampler2x::getFilterCoefficients();
+  web_audio::detail::PolyphaseDownsampler downsampler(coefficients, 2, 16);
+
+  std::mt19937 rng(1);
+  std::vector<float> signal;
+  std::vector<float> output;
+
+  for (int block = 0; block < 20; ++block) {
+    auto input = randomBlock(rng, 16);
+    signal.insert(signal.end(), input.begin(), input.end());
+    std::vector<float> outputBlock;
+    downsampler.process(input, outputBlock);
+    output.insert(output.end(), outputBlock.begin(), outputBlock.end());
+  }
+
+  for (std::size_t n = 0; n < output.size(); ++n) {
+    float expected = 0.0f;
+
+    for (std::size_t k = 0; k < coefficients.size() && k <= n * 2; ++k) {
+      expected += coefficients[k] * signal[n * 2 - k];
+    }
+
+    EXPECT_NEAR(output[n], expected, 1e-5f) << "index " << n;
+  }
+}
+
+TEST(TestResampler, Dot) {
+  std::vector<float> a(37);
+  std::vector<float> b(37);
+  float expected = 0.0f;
+
+  for (std::size_t i = 0; i < a.size(); ++i) {
+    a[i] = static_cast<float>(i) * 0.5f;
+    b[i] = 1.0f - static_cast<float>(i) * 0.25f;
+    expected += a[i] * b[i];
+  }
+
+  EXPECT_NEAR(web_audio::detail::VectorMath::dot(a.data(), b.data(), a.size()),
+              expected, 1e-3f);
+}
\ No newline at end of file
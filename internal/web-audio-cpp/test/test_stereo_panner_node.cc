@@ -0,0 +1,89 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <numbers>
+
+#include "test_helper.hh"
+#include "web_audio/detail/equal_power_panner.hh"
+
+using namespace web_audio;
+
+TEST(TestStereoPannerNode, QuarterCosine) {
+  std::vector<float> x(1001);
+
+  for (std::size_t i = 0; i < x.size(); ++i) {
+    x[i] = static_cast<float>(i) / 1000;
+  }
+
+  std::vector<float> output(x.size());
+  detail::EqualPowerPanner::quarterCosine(x.data(), output.data(), x.size());
+
+  for (std::size_t i = 0; i < x.size(); ++i) {
+    EXPECT_NEAR(output[i], std::cos(x[i] * std::numbers::pi / 2), 1e-6);
+  }
+}
+
+TEST(TestStereoPannerNode, MonoInput) {
+  auto context = TestHelper::createOfflineContext();
+  auto source = ConstantSourceNode::create(context);
+  StereoPannerOptions options;
+  options.pan = 0.5f;
+  auto panner = StereoPannerNode::create(context, options);
+
+  source->connect(panner);
+  panner->connect(context->getDestination());
+
+  auto rendered = TestHelper::renderOffline(context);
+  auto x = 0.75 * std::numbers::pi / 2;
+
+  for (std::uint32_t i = 0; i < rendered->getLength(); ++i) {
+    EXPECT_NEAR(rendered->getChannelData(0)[i], std::cos(x), 1e-6);
+    EXPECT_NEAR(rendered->getChannelData(1)[i], std::sin(x), 1e-6);
+  }
+}
+
+TEST(TestStereoPannerNode, AutomatedStereoInput) {
+  auto context = TestHelper::createOfflineContext();
+  constexpr std::uint32_t kFrames = 128;
+  auto buffer = AudioBuffer::create({
+      .numberOfChannels = 2,
+      .length = kFrames,
+      .sampleRate = 44100.0f,
+  });
+
+  for (std::uint32_t i = 0; i < kFrames; ++i) {
+    buffer->getWritableChannelData(0)[i] = 0.5f;
+    buffer->getWritableChannelData(1)[i] = 0.25f;
+  }
+
+  AudioBufferSourceOptions sourceOptions;
+  sourceOptions.buffer = buffer;
+  auto source = AudioBufferSourceNode::create(context, sourceOptions);
+  auto panner = StereoPannerNode::create(context);
+  panner->getPan()->setValueAtTime(-1.0f, 0.0);
+  panner->getPan()->linearRampToValueAtTime(1.0f, kFrames / 44100.0);
+
+  source->connect(panner);
+  panner->connect(context->getDestination());
+  source->start();
+
+  auto rendered = TestHelper::renderOffline(context);
+
+  for (std::uint32_t i = 0; i < kFrames; ++i) {
+    auto pan = -1.0 + 2.0 * i / kFrames;
+    double left, right;
+
+    if (pan <= 0) {
+      auto x = (pan + 1) * std::numbers::pi / 2;
+      left = 0.5 + 0.25 * std::cos(x);
+      right = 0.25 * std::sin(x);
+    } else {
+      auto x = pan * std::numbers::pi / 2;
+      left = 0.5 * std::cos(x);
+      right = 0.25 + 0.5 * std::sin(x);
+    }
+
+    EXPECT_NEAR(rendered->getChannelData(0)[i], left, 1e-5);
+    EXPECT_NEAR(rendered->getChannelData(1)[i], right, 1e-5);
+  }
+}
\ No newline at end of file
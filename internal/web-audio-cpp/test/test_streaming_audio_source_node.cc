@@ -0,0 +1,164 @@
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+
+#include "test_helper.hh"
+#include "web_audio/detail/audio_file_stream.hh"
+
+using namespace web_audio;
+
+namespace {
+constexpr std::uint32_t kLength = 5000;
+
+/**
+ * Writes a 16-bit stereo WAVE file whose left channel counts frames and whose
+ * right channel is the negated count.
+ */
+std::string writeTestFile(const std::string &name) {
+  auto path = (std::filesystem::temp_directory_path() / name).string();
+  std::ofstream file(path, std::ios::binary);
+
+  auto write32 = [&](std::uint32_t value) {
+    file.write(reinterpret_cast<const char *>(&value), 4);
+  };
+  auto write16 = [&](std::uint16_t value) {
+    file.write(reinterpret_cast<const char *>(&value), 2);
+  };
+
+  file.write("RIFF", 4);
+  write32(36 + kLength * 4);
+  file.write("WAVEfmt ", 8);
+  write32(16);
+  write16(1);
+  write16(2);
+  write32(44100);
+  write32(44100 * 4);
+  write16(4);
+  write16(16);
+  file.write("data", 4);
+  write32(kLength * 4);
+
+  for (std::uint32_t i = 0; i < kLength; ++i) {
+    write16(static_cast<std::uint16_t>(i));
+    write16(static_cast<std::uint16_t>(-static_cast<std::int16_t>(i)));
+  }
+
+  return path;
+}
+
+float sampleAt(std::uint32_t frame) { return frame / 32768.0f; }
+
+/**
+ * Reads `frames` frames of the left channel, waiting for the I/O thread
+ * whenever it falls behind.
+ */
+std::vector<float> readAll(detail::AudioFileStream &stream,
+                           std::uint32_t frames) {
+  std::vector<float> result;
+  std::vector<float> left(128);
+  std::vector<float> right(128);
+  float *destinations[] = {left.data(), right.data()};
+
+  while (result.size() < frames && !stream.isFinished()) {
+    auto wanted = std::min<std::uint32_t>(128, frames - result.size());
+    auto n = stream.read(destinations, wanted);
+    result.insert(result.end(), left.begin(), left.begin() + n);
+
+    if (n < wanted) {
+      stream.prime();
+    }
+  }
+
+  return result;
+}
+} // namespace
+
+TEST(TestStreamingAudioSourceNode, StreamsToEnd) {
+  auto path = writeTestFile("web_audio_stream_end.wav");
+  {
+    detail::AudioFileStream stream(path, 2);
+    ASSERT_EQ(stream.getFormat().length, kLength);
+
+    auto frames = readAll(stream, kLength * 2);
+    ASSERT_EQ(frames.size(), kLength);
+
+    for (std::uint32_t i = 0; i < kLength; ++i) {
+      ASSERT_EQ(frames[i], sampleAt(i));
+    }
+
+    EXPECT_TRUE(stream.isFinished());
+  }
+  std::filesystem::remove(path);
+}
+
+TEST(TestStreamingAudioSourceNode, LoopsAndSeeks) {
+  auto path = writeTestFile("web_audio_stream_loop.wav");
+  {
+    detail::AudioFileStream stream(path, 2);
+    stream.setLoop(true, 1000, 1300);
+    stream.seek(900);
+    stream.prime();
+
+    auto frames = readAll(stream, 2000);
+    ASSERT_EQ(frames.size(), 2000u);
+
+    for (std::uint32_t i = 0; i < frames.size(); ++i) {
+      auto expected = i < 100 ? 900 + i : 1000 + (i - 100) % 300;
+      ASSERT_EQ(frames[i], sampleAt(expected)) << i;
+    }
+
+    stream.setLoop(false, 0, 0);
+    stream.seek(4000);
+    stream.prime();
+    frames = readAll(stream, kLength);
+    ASSERT_EQ(frames.size(), 1000u);
+    EXPECT_EQ(frames.front(), sampleAt(4000));
+    EXPECT_EQ(frames.back(), sampleAt(kLength - 1));
+  }
+  std::filesystem::remove(path);
+}
+
+TEST(TestStreamingAudioSourceNode, StartsOnExactFrame) {
+  auto path = writeTestFile("web_audio_stream_node.wav");
+  {
+    auto context = OfflineAudioContext::create(2, 512, 44100.0f);
+    StreamingAudioSourceOptions options;
+    options.path = path;
+    auto node = StreamingAudioSourceNode::create(context, options);
+    EXPECT_EQ(node->getNumberOfChannels(), 2u);
+    EXPECT_DOUBLE_EQ(node->getDuration(), kLength / 44100.0);
+
+    node->connect(context->getDestination());
+    node->start(100.5 / 44100.0, 10 / 44100.0);
+    node->prime();
+
+    auto rendered = TestHelper::renderOffline(context);
+
+    for (std::uint32_t i = 0; i <= 100; ++i) {
+      ASSERT_EQ(rendered->getChannelData(0)[i], 0.0f);
+    }
+
+    for (std::uint32_t i = 101; i < 512; ++i) {
+      ASSERT_EQ(rendered->getChannelData(0)[i], sampleAt(i - 91));
+      ASSERT_EQ(rendered->getChannelData(1)[i], -sampleAt(i - 91));
+    }
+
+    EXPECT_EQ(node->getUnderrunCount(), 0u);
+  }
+  std::filesystem::remove(path);
+}
+
+TEST(TestStreamingAudioSourceNode, InvalidFile) {
+  auto context = TestHelper::createOfflineContext();
+  StreamingAudioSourceOptions options;
+  options.path = "/nonexistent/web_audio.wav";
+
+  try {
+    StreamingAudioSourceNode::create(context, options);
+    FAIL() << "Expected DOMException";
+  } catch (const DOMException &e) {
+    EXPECT_STREQ(e.getName(), "NotReadableError");
+  }
+}
\ No newline at end of file
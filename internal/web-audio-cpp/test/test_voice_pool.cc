@@ -0,0 +1,205 @@
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <thread>
+
+#include "test_helper.hh"
+
+using namespace web_audio;
+
+namespace {
+/**
+ * A ConstantSourceNode at 0.5 into a GainNode connected to the destination.
+ */
+VoiceBuilder createBuilder() {
+  return [](std::shared_ptr<BaseAudioContext> context) {
+    auto source = ConstantSourceNode::create(context);
+    source->getOffset()->setValue(0.5f);
+    auto gain = GainNode::create(context);
+    source->connect(gain);
+    gain->connect(context->getDestination());
+    return std::vector<std::shared_ptr<AudioNode>>{source, gain};
+  };
+}
+
+/**
+ * Released voices are recycled by the rendering thread.
+ */
+void waitForFreeVoices(const VoicePool &pool, std::size_t count) {
+  auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+
+  while (pool.getFreeVoiceCount() < count &&
+         std::chrono::steady_clock::now() < deadline) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+  }
+
+  ASSERT_EQ(pool.getFreeVoiceCount(), count);
+}
+} // namespace
+
+TEST(TestVoicePool, AcquireUpToMaxVoices) {
+  auto context = TestHelper::createOfflineContext();
+  auto pool = VoicePool::create(context, createBuilder(),
+                                {.initialVoices = 1, .maxVoices = 2});
+  EXPECT_EQ(pool->getVoiceCount(), 1);
+  EXPECT_EQ(pool->getFreeVoiceCount(), 1);
+
+  auto first = pool->acquire();
+  auto second = pool->acquire();
+  ASSERT_NE(first, nullptr);
+  ASSERT_NE(second, nullptr);
+  EXPECT_NE(first->getNodes()[0], second->getNodes()[0]);
+  EXPECT_EQ(pool->acquire(), nullptr);
+  EXPECT_EQ(pool->getVoiceCount(), 2);
+  EXPECT_EQ(pool->getFreeVoiceCount(), 0);
+}
+
+TEST(TestVoicePool, RecycleResetsParamsAndState) {
+  auto context = TestHelper::createOfflineContext();
+  auto pool = VoicePool::create(
+      context,
+      [](std::shared_ptr<BaseAudioContext> context) {
+        auto oscillator = OscillatorNode::create(context);
+        oscillator->getFrequency()->setValue(220.0f);
+        oscillator->connect(context->getDestination());
+        return std::vector<std::shared_ptr<AudioNode>>{oscillator};
+      },
+      {.maxVoices = 1});
+
+  auto voice = pool->acquire();
+  auto oscillator = voice->getNode<OscillatorNode>(0);
+  ASSERT_NE(oscillator, nullptr);
+  EXPECT_EQ(voice->getNode<GainNode>(0), nullptr);
+  oscillator->getFrequency()->setValue(880.0f);
+  oscillator->getFrequency()->linearRampToValueAtTime(440.0f, 1.0);
+  oscillator->start();
+  oscillator->kernel_.setPhase(12345);
+
+  voice.reset();
+  waitForFreeVoices(*pool, 1);
+
+  voice = pool->acquire();
+  EXPECT_EQ(voice->getNode<OscillatorNode>(0), oscillator);
+  EXPECT_EQ(pool->getVoiceCount(), 1);
+  EXPECT_FLOAT_EQ(oscillator->getFrequency()->getValue(), 220.0f);
+  EXPECT_EQ(oscillator->getFrequency()->events_.size(), 1);
+  EXPECT_EQ(oscillator->kernel_.getPhase(), 0);
+  // start() may be called again.
+  EXPECT_NO_THROW(oscillator->start());
+}
+
+TEST(TestVoicePool, ReleaseRemovesExternalConnections) {
+  auto context = TestHelper::createOfflineContext();
+  auto pool = VoicePool::create(context, createBuilder(), {.maxVoices = 1});
+  auto graph = context->getAudioGraph();
+  auto destination = context->getDestination();
+  auto other = GainNode::create(context);
+
+  auto voice = pool->acquire();
+  auto source = voice->getNode<ConstantSourceNode>(0);
+  auto gain = voice->getNode<GainNode>(1);
+  gain->connect(other);
+  other->connect(source->getOffset());
+  ASSERT_EQ(graph->getPreviousNodes(destination).size(), 1);
+
+  voice.reset();
+  EXPECT_FALSE(graph->hasNode(source));
+  EXPECT_FALSE(graph->hasNode(gain));
+  EXPECT_TRUE(graph->getPreviousNodes(destination).empty());
+  EXPECT_TRUE(graph->getPreviousNodes(other).empty());
+  EXPECT_TRUE(graph->getPreviousNodes(source->getOffset()).empty());
+  // Connections within the voice are kept.
+  EXPECT_EQ(graph->getPreviousNodes(gain).size(), 1);
+  waitForFreeVoices(*pool, 1);
+
+  voice = pool->acquire();
+  EXPECT_TRUE(graph->hasNode(source));
+  EXPECT_TRUE(graph->hasNode(gain));
+  // Only connections made by the builder are restored.
+  EXPECT_EQ(graph->getPreviousNodes(destination).size(), 1);
+  EXPECT_TRUE(graph->getPreviousNodes(other).empty());
+}
+
+TEST(TestVoicePool, ReleasedVoicesAreNotRendered) {
+  auto context = TestHelper::createOfflineContext();
+  auto pool = VoicePool::create(context, createBuilder(), {.maxVoices = 2});
+
+  auto playing = pool->acquire();
+  auto released = pool->acquire();
+  released.reset();
+  waitForFreeVoices(*pool, 1);
+
+  auto buffer = TestHelper::renderOffline(context);
+  auto data = buffer->getChannelData(0);
+
+  for (std::size_t i = 0; i < data.size(); ++i) {
+    ASSERT_FLOAT_EQ(data[i], 0.5f);
+  }
+}
+
+TEST(TestVoicePool, ResetStateClearsFilterMemory) {
+  auto context = TestHelper::createOfflineContext();
+  auto filter = BiquadFilterNode::create(context);
+  auto renderImpulse = [&] {
+    std::vector<detail::RenderQuantum> inputs(1, detail::RenderQuantum(1, 128));
+    std::vector<detail::RenderQuantum> outputs(1,
+                                               detail::RenderQuantum(1, 128));
+    inputs[0][0][0] = 1.0f;
+    detail::ParamCollection params;
+
+    for (auto &param : filter->getParams()) {
+      params.setValue(param, param->getValue(), 128);
+    }
+
+    filter->process(inputs, outputs, params);
+    return outputs[0][0];
+  };
+
+  auto first = renderImpulse();
+  EXPECT_NE(renderImpulse(), first);
+  filter->resetState();
+  EXPECT_EQ(renderImpulse(), first);
+}
+
+TEST(TestVoicePool, InvalidOptions) {
+  auto context = TestHelper::createOfflineContext();
+
+  try {
+    VoicePool::create(context, createBuilder(), {.maxVoices = 0});
+    FAIL();
+  } catch (const DOMException &e) {
+    EXPECT_STREQ(e.getName(), "NotSupportedError");
+  }
+
+  try {
+    VoicePool::create(context, createBuilder(),
+                      {.initialVoices = 3, .maxVoices = 2});
+    FAIL();
+  } catch (const DOMException &e) {
+    EXPECT_STREQ(e.getName(), "NotSupportedError");
+  }
+
+  auto pool = VoicePool::create(context, [](auto) {
+    return std::vector<std::shared_ptr<AudioNode>>{};
+  });
+
+  try {
+    pool->acquire();
+    FAIL();
+  } catch (const DOMException &e) {
+    EXPECT_STREQ(e.getName(), "NotSupportedError");
+  }
+}
+
+TEST(TestVoicePool, DestroyedAfterPendingRecycle) {
+  auto context = TestHelper::createOfflineContext();
+  auto pool = VoicePool::create(context, createBuilder(), {.maxVoices = 1});
+  std::weak_ptr<VoicePool> weak = pool;
+  auto voice = pool->acquire();
+
+  // The last voice holds the last reference, so the pool is destroyed on
+  // release, once the rendering thread has recycled the voice.
+  pool.reset();
+  voice.reset();
+  EXPECT_TRUE(weak.expired());
+}
\ No newline at end of file
@@ -76,4 +76,113 @@ TEST(TestWaveShaperNode, Offline_TwoPoints) {
       EXPECT_NEAR(data[i], 0.5f, 0.01f);
     }
   }
+}
+
+TEST(TestWaveShaperNode, Offline_Oversample) {
+  for (auto type : {web_audio::detail::ResamplerType::eFFT,
+                    web_audio::detail::ResamplerType::ePolyphase}) {
+    for (auto oversample :
+         {web_audio::OverSampleType::e2x, web_audio::OverSampleType::e4x}) {
+      auto context = TestHelper::createOfflineContext();
+      auto node = web_audio::ConstantSourceNode::create(context);
+      auto waveShaperNode = web_audio::WaveShaperNode::create(context);
+      node->getOffset()->setValue(0.5f);
+      node->connect(waveShaperNode);
+      waveShaperNode->connect(context->getDestination());
+      waveShaperNode->setCurve(std::vector<float>{-1.0f, 1.0f});
+      waveShaperNode->setResamplerType(type);
+      waveShaperNode->setOversample(oversample);
+
+      auto result = TestHelper::renderOffline(context);
+
+      for (std::uint32_t ch = 0; ch < result->getNumberOfChannels(); ++ch) {
+        auto &&data = result->getChannelData(ch);
+        // Skip the group delay of the resampling filters.
+        for (std::uint32_t i = 96; i < result->getLength(); ++i) {
+          EXPECT_NEAR(data[i], 0.5f, 0.01f);
+        }
+      }
+    }
+  }
+}
+
+TEST(TestWaveShaperNode, ApplyCurve) {
+  std::vector<float> curve = {-1.0f, 0.5f, 0.25f, 1.0f};
+  std::vector<float> slopes = {1.5f, -0.25f, 0.75f};
+  std::vector<float> data = {-2.0f, -1.0f, -0.5f, 0.0f, 0.2f, 0.9f, 1.0f, 3.0f};
+  auto expected = data;
+
+  for (auto &x : expected) {
+    auto N = curve.size();
+    auto v = (N - 1) / 2.0 * (x + 1.0f);
+
+    if (v <= 0) {
+      x = curve[0];
+    } else if (v >= N - 1) {
+      x = curve[N - 1];
+    } else {
+      auto k = static_cast<std::size_t>(v);
+      auto f = v - k;
+      x = static_cast<float>((1 - f) * curve[k] + f * curve[k + 1]);
+    }
+  }
+
+  web_audio::WaveShaperNode::applyCurve(curve, slopes, data.data(),
+                                        data.size());
+
+  for (std::size_t i = 0; i < data.size(); ++i) {
+    EXPECT_NEAR(data[i], expected[i], 1e-6f) << "index " << i;
+  }
+}
+
+TEST(TestWaveShaperNode, ChannelsAreIndependent) {
+  auto context = TestHelper::createOfflineContext();
+  // Through the options, as setOversample() hands the oversampler to the
+  // rendering thread, which process() is not called on here.
+  web_audio::WaveShaperOptions options;
+  options.curve = std::vector<float>{-1.0f, 0.0f, 1.0f, 0.0f};
+  options.oversample = web_audio::OverSampleType::e4x;
+  auto stereo = web_audio::WaveShaperNode::create(context, options);
+  auto mono = web_audio::WaveShaperNode::create(context, options);
+
+  web_audio::detail::ParamCollection params;
+
+  for (int block = 0; block < 4; ++block) {
+    std::vector<web_audio::detail::RenderQuantum> stereoInputs{
+        web_audio::detail::RenderQuantum(2, 128)};
+    std::vector<web_audio::detail::RenderQuantum> monoInputs{
+        web_audio::detail::RenderQuantum(1, 128)};
+
+    for (std::uint32_t i = 0; i < 128; ++i) {
+      stereoInputs[0][0][i] = 0.9f;
+      stereoInputs[0][1][i] = std::sin(0.1f * (block * 128 + i));
+      monoInputs[0][0][i] = stereoInputs[0][1][i];
+    }
+
+    std::vector<web_audio::detail::RenderQuantum> stereoOutputs{
+        web_audio::detail::RenderQuantum(2, 128)};
+    std::vector<web_audio::detail::RenderQuantum> monoOutputs{
+        web_audio::detail::RenderQuantum(1, 128)};
+    stereo->process(stereoInputs, stereoOutputs, params);
+    mono->process(monoInputs, monoOutputs, params);
+
+    for (std::uint32_t i = 0; i < 128; ++i) {
+      EXPECT_FLOAT_EQ(stereoOutputs[0][1][i], monoOutputs[0][0][i]);
+    }
+  }
+}
+
+TEST(TestWaveShaperNode, ShareCurve) {
+  auto context = TestHelper::createOfflineContext();
+  auto first = web_audio::WaveShaperNode::create(context);
+  auto second = web_audio::WaveShaperNode::create(context);
+  first->setCurve(std::vector<float>{-1.0f, 0.0f, 1.0f});
+  second->shareCurve(*first);
+
+  EXPECT_EQ(first->curve_, second->curve_);
+  EXPECT_EQ(second->getCurve(), first->getCurve());
+
+  first->setCurve(std::nullopt);
+  EXPECT_FALSE(first->getCurve().has_value());
+  EXPECT_TRUE(second->getCurve().has_value());
 }
\ No newline at end of file